@@ -0,0 +1,51 @@
+/* conv/common.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_conv.h>
+
+/*
+gsl_conv_length()
+  Return the number of output samples produced by convolving an input
+of length n with a kernel of length k
+
+Inputs: n    - input length
+        k    - kernel length
+        mode - which part of the full convolution is returned
+*/
+
+size_t
+gsl_conv_length(const size_t n, const size_t k, const gsl_conv_mode_t mode)
+{
+  switch (mode)
+    {
+      case GSL_CONV_FULL:
+        return n + k - 1;
+
+      case GSL_CONV_SAME:
+        return n;
+
+      case GSL_CONV_VALID:
+        return (n >= k) ? n - k + 1 : 0;
+
+      default:
+        return 0;
+    }
+}
@@ -0,0 +1,411 @@
+/* conv/conv.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module computes the discrete linear convolution
+ *
+ * z_i = sum_{j=0}^{K-1} k_j x_{i-j},  i = 0, ..., n + K - 2
+ *
+ * of an input vector x of length n with a kernel k of length K,
+ * where x is taken to be zero outside [0, n-1]. Short kernels are
+ * handled by direct summation; long kernels by the overlap-save
+ * method, in which the input is processed in blocks of length nfft
+ * using real FFTs and a spectrum of the kernel which is computed
+ * once, when the kernel is set.
+ *
+ * The correlation
+ *
+ * c_i = sum_{j=0}^{K-1} k_j x_{i+j-(K-1)}
+ *
+ * is related to the convolution of the reversed input by
+ * c_i = z'_{n+K-2-i}, so both operations share the same kernel
+ * spectrum.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_conv.h>
+
+#include "conv_common.c"
+
+static int conv_compute(const int reverse, const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+                        const gsl_vector * x, gsl_vector * y, gsl_conv_workspace * w);
+static void conv_direct(const int reverse, const size_t i0, const gsl_vector * x, gsl_vector * y,
+                        const gsl_conv_workspace * w);
+static void conv_fft(const int reverse, const size_t i0, const gsl_vector * x, gsl_vector * y,
+                     gsl_conv_workspace * w);
+static gsl_conv_method_t conv_select(const size_t ny, const size_t K, const size_t nfft);
+static void conv_hc_mul(double * a, const double * b, const size_t n);
+
+gsl_conv_workspace *
+gsl_conv_alloc(const gsl_vector * kernel)
+{
+  const size_t K = kernel->size;
+  gsl_conv_workspace *w;
+
+  if (K == 0)
+    {
+      GSL_ERROR_NULL ("kernel length must be positive", GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_conv_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->K = K;
+  w->nfft = conv_fft_length(K, 64);
+  w->L = w->nfft - K + 1;
+
+  w->kernel = malloc(K * sizeof(double));
+  if (w->kernel == 0)
+    {
+      gsl_conv_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel", GSL_ENOMEM);
+    }
+
+  w->kernel_fft = malloc(w->nfft * sizeof(double));
+  if (w->kernel_fft == 0)
+    {
+      gsl_conv_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel spectrum", GSL_ENOMEM);
+    }
+
+  w->block = malloc(w->nfft * sizeof(double));
+  if (w->block == 0)
+    {
+      gsl_conv_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for block", GSL_ENOMEM);
+    }
+
+  w->real_wavetable = gsl_fft_real_wavetable_alloc(w->nfft);
+  w->hc_wavetable = gsl_fft_halfcomplex_wavetable_alloc(w->nfft);
+  w->fft_workspace = gsl_fft_real_workspace_alloc(w->nfft);
+  if (w->real_wavetable == 0 || w->hc_wavetable == 0 || w->fft_workspace == 0)
+    {
+      gsl_conv_free(w);
+      GSL_ERROR_NULL ("failed to allocate FFT workspace", GSL_ENOMEM);
+    }
+
+  gsl_conv_set_kernel(kernel, w);
+
+  return w;
+}
+
+void
+gsl_conv_free(gsl_conv_workspace * w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->kernel)
+    free(w->kernel);
+
+  if (w->kernel_fft)
+    free(w->kernel_fft);
+
+  if (w->block)
+    free(w->block);
+
+  if (w->real_wavetable)
+    gsl_fft_real_wavetable_free(w->real_wavetable);
+
+  if (w->hc_wavetable)
+    gsl_fft_halfcomplex_wavetable_free(w->hc_wavetable);
+
+  if (w->fft_workspace)
+    gsl_fft_real_workspace_free(w->fft_workspace);
+
+  free(w);
+}
+
+/*
+gsl_conv_set_kernel()
+  Store a new kernel in the workspace and precompute its spectrum,
+so that subsequent calls to gsl_conv() and gsl_conv_corr() do not
+need to transform it again
+
+Inputs: kernel - kernel, length K
+        w      - workspace
+*/
+
+int
+gsl_conv_set_kernel(const gsl_vector * kernel, gsl_conv_workspace * w)
+{
+  if (kernel->size != w->K)
+    {
+      GSL_ERROR("kernel length does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t nfft = w->nfft;
+      const double scale = 1.0 / (double) nfft;
+      size_t i;
+
+      for (i = 0; i < w->K; ++i)
+        w->kernel[i] = gsl_vector_get(kernel, i);
+
+      /* zero padded kernel spectrum, scaled so that the inverse
+       * transform can use the unnormalized backward routine */
+      memcpy(w->kernel_fft, w->kernel, w->K * sizeof(double));
+      for (i = w->K; i < nfft; ++i)
+        w->kernel_fft[i] = 0.0;
+
+      gsl_fft_real_transform(w->kernel_fft, 1, nfft, w->real_wavetable, w->fft_workspace);
+
+      for (i = 0; i < nfft; ++i)
+        w->kernel_fft[i] *= scale;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_conv()
+  Convolve input vector with kernel
+
+Inputs: mode   - which part of the full convolution to return
+        method - direct, FFT or automatic selection
+        x      - input vector, length n
+        y      - (output) convolution, length gsl_conv_length(n, K, mode)
+        w      - workspace
+*/
+
+int
+gsl_conv(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+         const gsl_vector * x, gsl_vector * y, gsl_conv_workspace * w)
+{
+  return conv_compute(0, mode, method, x, y, w);
+}
+
+/*
+gsl_conv_corr()
+  Cross-correlate input vector with kernel
+
+Inputs: mode   - which part of the full correlation to return
+        method - direct, FFT or automatic selection
+        x      - input vector, length n
+        y      - (output) correlation, length gsl_conv_length(n, K, mode)
+        w      - workspace
+*/
+
+int
+gsl_conv_corr(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+              const gsl_vector * x, gsl_vector * y, gsl_conv_workspace * w)
+{
+  return conv_compute(1, mode, method, x, y, w);
+}
+
+static int
+conv_compute(const int reverse, const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+             const gsl_vector * x, gsl_vector * y, gsl_conv_workspace * w)
+{
+  const size_t n = x->size;
+  const size_t K = w->K;
+  const size_t ny = gsl_conv_length(n, K, mode);
+
+  if (n == 0)
+    {
+      GSL_ERROR("input vector must have positive length", GSL_EBADLEN);
+    }
+  else if (mode == GSL_CONV_VALID && n < K)
+    {
+      GSL_ERROR("input vector must be at least as long as kernel in valid mode", GSL_EBADLEN);
+    }
+  else if (y->size != ny)
+    {
+      GSL_ERROR("output vector has wrong length", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t offset = conv_offset(K, mode);
+      gsl_conv_method_t m = method;
+      size_t i0;
+
+      if (m == GSL_CONV_AUTO)
+        m = conv_select(ny, K, w->nfft);
+
+      /* first index of the full convolution to compute */
+      if (reverse)
+        i0 = n + K - 2 - offset - (ny - 1);
+      else
+        i0 = offset;
+
+      if (m == GSL_CONV_FFT)
+        conv_fft(reverse, i0, x, y, w);
+      else
+        conv_direct(reverse, i0, x, y, w);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+conv_direct()
+  Compute elements i0, ..., i0 + ny - 1 of the full convolution by
+direct summation
+
+Inputs: reverse - if set, convolve the reversed input and store the
+                  result in reverse order
+        i0      - first index of full convolution
+        x       - input vector, length n
+        y       - (output) result, length ny
+        w       - workspace
+*/
+
+static void
+conv_direct(const int reverse, const size_t i0, const gsl_vector * x, gsl_vector * y,
+            const gsl_conv_workspace * w)
+{
+  const size_t n = x->size;
+  const size_t ny = y->size;
+  const size_t K = w->K;
+  const double *k = w->kernel;
+  size_t m;
+
+  for (m = 0; m < ny; ++m)
+    {
+      const size_t i = i0 + m;
+      const size_t jmin = (i >= n) ? i - n + 1 : 0;
+      const size_t jmax = GSL_MIN(K - 1, i);
+      double sum = 0.0;
+      size_t j;
+
+      if (reverse)
+        {
+          for (j = jmin; j <= jmax; ++j)
+            sum += k[j] * gsl_vector_get(x, n - 1 - (i - j));
+
+          gsl_vector_set(y, ny - 1 - m, sum);
+        }
+      else
+        {
+          for (j = jmin; j <= jmax; ++j)
+            sum += k[j] * gsl_vector_get(x, i - j);
+
+          gsl_vector_set(y, m, sum);
+        }
+    }
+}
+
+/*
+conv_fft()
+  Compute elements i0, ..., i0 + ny - 1 of the full convolution with
+the overlap-save method. Each block of nfft input samples starting at
+index b - K + 1 yields the L = nfft - K + 1 outputs b, ..., b + L - 1,
+which are the elements of the circular convolution not affected by
+wrap-around.
+
+Inputs: reverse - if set, convolve the reversed input and store the
+                  result in reverse order
+        i0      - first index of full convolution
+        x       - input vector, length n
+        y       - (output) result, length ny
+        w       - workspace
+*/
+
+static void
+conv_fft(const int reverse, const size_t i0, const gsl_vector * x, gsl_vector * y,
+         gsl_conv_workspace * w)
+{
+  const size_t n = x->size;
+  const size_t ny = y->size;
+  const size_t K = w->K;
+  const size_t nfft = w->nfft;
+  double *block = w->block;
+  size_t b;
+
+  for (b = i0; b < i0 + ny; b += w->L)
+    {
+      const size_t nout = GSL_MIN(w->L, i0 + ny - b);
+      size_t j;
+
+      /* load input samples b - K + 1, ..., b - K + nfft */
+      for (j = 0; j < nfft; ++j)
+        {
+          const size_t p = b + j; /* input index shifted by K - 1 */
+
+          if (p >= K - 1 && p < n + K - 1)
+            {
+              const size_t q = p - (K - 1);
+              block[j] = gsl_vector_get(x, reverse ? n - 1 - q : q);
+            }
+          else
+            block[j] = 0.0;
+        }
+
+      gsl_fft_real_transform(block, 1, nfft, w->real_wavetable, w->fft_workspace);
+      conv_hc_mul(block, w->kernel_fft, nfft);
+      gsl_fft_halfcomplex_backward(block, 1, nfft, w->hc_wavetable, w->fft_workspace);
+
+      for (j = 0; j < nout; ++j)
+        {
+          const size_t m = b - i0 + j;
+          gsl_vector_set(y, reverse ? ny - 1 - m : m, block[K - 1 + j]);
+        }
+    }
+}
+
+/*
+conv_select()
+  Choose between direct summation and overlap-save by comparing
+approximate floating point operation counts. Direct summation costs
+2 K flops per output; each overlap-save block costs a forward and an
+inverse real FFT (about 2.5 nfft log2(nfft) flops each) plus the
+spectral product, and produces L outputs.
+*/
+
+static gsl_conv_method_t
+conv_select(const size_t ny, const size_t K, const size_t nfft)
+{
+  const size_t L = nfft - K + 1;
+  const double nblocks = ceil((double) ny / (double) L);
+  const double direct_cost = 2.0 * (double) ny * (double) K;
+  const double fft_cost = nblocks * (double) nfft * (5.0 * log((double) nfft) / M_LN2 + 6.0);
+
+  return (direct_cost <= fft_cost) ? GSL_CONV_DIRECT : GSL_CONV_FFT;
+}
+
+/* multiply halfcomplex sequence a by halfcomplex sequence b in place */
+static void
+conv_hc_mul(double * a, const double * b, const size_t n)
+{
+  size_t i;
+
+  a[0] *= b[0];
+
+  for (i = 1; i < (n + 1) / 2; ++i)
+    {
+      const double ar = a[2 * i - 1], ai = a[2 * i];
+      const double br = b[2 * i - 1], bi = b[2 * i];
+
+      a[2 * i - 1] = ar * br - ai * bi;
+      a[2 * i] = ar * bi + ai * br;
+    }
+
+  if (n % 2 == 0)
+    a[n - 1] *= b[n - 1];
+}
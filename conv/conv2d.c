@@ -0,0 +1,476 @@
+/* conv/conv2d.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Two dimensional convolution
+ *
+ * Z_{i1,i2} = sum_{a,b} K_{a,b} X_{i1-a,i2-b}
+ *
+ * and correlation, with the same conventions as the 1D routines in
+ * conv.c, applied along each dimension. The FFT method uses
+ * overlap-save on N1-by-N2 tiles. Since the kernel is real, two
+ * tiles are processed with each complex 2D transform by storing the
+ * first in the real part and the second in the imaginary part of the
+ * tile buffer.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_conv.h>
+
+#include "conv_common.c"
+
+static int conv2d_compute(const int reverse, const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+                          const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w);
+static void conv2d_direct(const int reverse, const size_t i01, const size_t i02,
+                          const gsl_matrix * X, gsl_matrix * Y, const gsl_conv2d_workspace * w);
+static void conv2d_fft(const int reverse, const size_t i01, const size_t i02,
+                       const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w);
+static void conv2d_load(const int reverse, const size_t part, const size_t b1, const size_t b2,
+                        const gsl_matrix * X, gsl_conv2d_workspace * w);
+static void conv2d_store(const int reverse, const size_t part, const size_t b1, const size_t b2,
+                         const size_t i01, const size_t i02, gsl_matrix * Y,
+                         const gsl_conv2d_workspace * w);
+static void conv2d_transform(double * data, const gsl_fft_direction sign, gsl_conv2d_workspace * w);
+static gsl_conv_method_t conv2d_select(const size_t ny1, const size_t ny2, const gsl_conv2d_workspace * w);
+
+gsl_conv2d_workspace *
+gsl_conv2d_alloc(const gsl_matrix * kernel)
+{
+  const size_t K1 = kernel->size1;
+  const size_t K2 = kernel->size2;
+  gsl_conv2d_workspace *w;
+
+  if (K1 == 0 || K2 == 0)
+    {
+      GSL_ERROR_NULL ("kernel dimensions must be positive", GSL_EINVAL);
+    }
+
+  w = calloc(1, sizeof(gsl_conv2d_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->K1 = K1;
+  w->K2 = K2;
+  w->N1 = conv_fft_length(K1, 16);
+  w->N2 = conv_fft_length(K2, 16);
+  w->L1 = w->N1 - K1 + 1;
+  w->L2 = w->N2 - K2 + 1;
+
+  w->kernel = gsl_matrix_alloc(K1, K2);
+  if (w->kernel == 0)
+    {
+      gsl_conv2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel", GSL_ENOMEM);
+    }
+
+  w->kernel_fft = malloc(2 * w->N1 * w->N2 * sizeof(double));
+  if (w->kernel_fft == 0)
+    {
+      gsl_conv2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel spectrum", GSL_ENOMEM);
+    }
+
+  w->tile = malloc(2 * w->N1 * w->N2 * sizeof(double));
+  if (w->tile == 0)
+    {
+      gsl_conv2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for tile", GSL_ENOMEM);
+    }
+
+  w->wavetable1 = gsl_fft_complex_wavetable_alloc(w->N1);
+  w->wavetable2 = gsl_fft_complex_wavetable_alloc(w->N2);
+  w->workspace1 = gsl_fft_complex_workspace_alloc(w->N1);
+  w->workspace2 = gsl_fft_complex_workspace_alloc(w->N2);
+  if (w->wavetable1 == 0 || w->wavetable2 == 0 ||
+      w->workspace1 == 0 || w->workspace2 == 0)
+    {
+      gsl_conv2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate FFT workspace", GSL_ENOMEM);
+    }
+
+  gsl_conv2d_set_kernel(kernel, w);
+
+  return w;
+}
+
+void
+gsl_conv2d_free(gsl_conv2d_workspace * w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->kernel)
+    gsl_matrix_free(w->kernel);
+
+  if (w->kernel_fft)
+    free(w->kernel_fft);
+
+  if (w->tile)
+    free(w->tile);
+
+  if (w->wavetable1)
+    gsl_fft_complex_wavetable_free(w->wavetable1);
+
+  if (w->wavetable2)
+    gsl_fft_complex_wavetable_free(w->wavetable2);
+
+  if (w->workspace1)
+    gsl_fft_complex_workspace_free(w->workspace1);
+
+  if (w->workspace2)
+    gsl_fft_complex_workspace_free(w->workspace2);
+
+  free(w);
+}
+
+/*
+gsl_conv2d_set_kernel()
+  Store a new kernel in the workspace and precompute its spectrum
+
+Inputs: kernel - kernel, K1-by-K2
+        w      - workspace
+*/
+
+int
+gsl_conv2d_set_kernel(const gsl_matrix * kernel, gsl_conv2d_workspace * w)
+{
+  if (kernel->size1 != w->K1 || kernel->size2 != w->K2)
+    {
+      GSL_ERROR("kernel dimensions do not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t N1 = w->N1;
+      const size_t N2 = w->N2;
+      const double scale = 1.0 / ((double) N1 * (double) N2);
+      size_t i, j;
+
+      gsl_matrix_memcpy(w->kernel, kernel);
+
+      for (i = 0; i < 2 * N1 * N2; ++i)
+        w->kernel_fft[i] = 0.0;
+
+      for (i = 0; i < w->K1; ++i)
+        {
+          for (j = 0; j < w->K2; ++j)
+            w->kernel_fft[2 * (i * N2 + j)] = gsl_matrix_get(kernel, i, j);
+        }
+
+      conv2d_transform(w->kernel_fft, gsl_fft_forward, w);
+
+      for (i = 0; i < 2 * N1 * N2; ++i)
+        w->kernel_fft[i] *= scale;
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_conv2d()
+  Convolve input matrix with kernel
+
+Inputs: mode   - which part of the full convolution to return,
+                 applied to both dimensions
+        method - direct, FFT or automatic selection
+        X      - input matrix, n1-by-n2
+        Y      - (output) convolution, with dimensions
+                 gsl_conv_length(n1, K1, mode)-by-gsl_conv_length(n2, K2, mode)
+        w      - workspace
+*/
+
+int
+gsl_conv2d(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+           const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w)
+{
+  return conv2d_compute(0, mode, method, X, Y, w);
+}
+
+/*
+gsl_conv2d_corr()
+  Cross-correlate input matrix with kernel
+
+Inputs: mode   - which part of the full correlation to return,
+                 applied to both dimensions
+        method - direct, FFT or automatic selection
+        X      - input matrix, n1-by-n2
+        Y      - (output) correlation
+        w      - workspace
+*/
+
+int
+gsl_conv2d_corr(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+                const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w)
+{
+  return conv2d_compute(1, mode, method, X, Y, w);
+}
+
+static int
+conv2d_compute(const int reverse, const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+               const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w)
+{
+  const size_t n1 = X->size1;
+  const size_t n2 = X->size2;
+  const size_t ny1 = gsl_conv_length(n1, w->K1, mode);
+  const size_t ny2 = gsl_conv_length(n2, w->K2, mode);
+
+  if (n1 == 0 || n2 == 0)
+    {
+      GSL_ERROR("input matrix must have positive dimensions", GSL_EBADLEN);
+    }
+  else if (mode == GSL_CONV_VALID && (n1 < w->K1 || n2 < w->K2))
+    {
+      GSL_ERROR("input matrix must be at least as large as kernel in valid mode", GSL_EBADLEN);
+    }
+  else if (Y->size1 != ny1 || Y->size2 != ny2)
+    {
+      GSL_ERROR("output matrix has wrong dimensions", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t offset1 = conv_offset(w->K1, mode);
+      const size_t offset2 = conv_offset(w->K2, mode);
+      gsl_conv_method_t m = method;
+      size_t i01, i02;
+
+      if (m == GSL_CONV_AUTO)
+        m = conv2d_select(ny1, ny2, w);
+
+      if (reverse)
+        {
+          i01 = n1 + w->K1 - 2 - offset1 - (ny1 - 1);
+          i02 = n2 + w->K2 - 2 - offset2 - (ny2 - 1);
+        }
+      else
+        {
+          i01 = offset1;
+          i02 = offset2;
+        }
+
+      if (m == GSL_CONV_FFT)
+        conv2d_fft(reverse, i01, i02, X, Y, w);
+      else
+        conv2d_direct(reverse, i01, i02, X, Y, w);
+
+      return GSL_SUCCESS;
+    }
+}
+
+static void
+conv2d_direct(const int reverse, const size_t i01, const size_t i02,
+              const gsl_matrix * X, gsl_matrix * Y, const gsl_conv2d_workspace * w)
+{
+  const size_t n1 = X->size1;
+  const size_t n2 = X->size2;
+  const size_t ny1 = Y->size1;
+  const size_t ny2 = Y->size2;
+  size_t m1, m2;
+
+  for (m1 = 0; m1 < ny1; ++m1)
+    {
+      const size_t i1 = i01 + m1;
+      const size_t amin = (i1 >= n1) ? i1 - n1 + 1 : 0;
+      const size_t amax = GSL_MIN(w->K1 - 1, i1);
+
+      for (m2 = 0; m2 < ny2; ++m2)
+        {
+          const size_t i2 = i02 + m2;
+          const size_t bmin = (i2 >= n2) ? i2 - n2 + 1 : 0;
+          const size_t bmax = GSL_MIN(w->K2 - 1, i2);
+          double sum = 0.0;
+          size_t a, b;
+
+          for (a = amin; a <= amax; ++a)
+            {
+              for (b = bmin; b <= bmax; ++b)
+                {
+                  const size_t p1 = i1 - a;
+                  const size_t p2 = i2 - b;
+                  const double xij = reverse ? gsl_matrix_get(X, n1 - 1 - p1, n2 - 1 - p2) :
+                                               gsl_matrix_get(X, p1, p2);
+
+                  sum += gsl_matrix_get(w->kernel, a, b) * xij;
+                }
+            }
+
+          if (reverse)
+            gsl_matrix_set(Y, ny1 - 1 - m1, ny2 - 1 - m2, sum);
+          else
+            gsl_matrix_set(Y, m1, m2, sum);
+        }
+    }
+}
+
+/*
+conv2d_fft()
+  Compute the full convolution over the index ranges
+[i01, i01 + ny1 - 1] x [i02, i02 + ny2 - 1] with overlap-save. Tiles
+are processed in pairs along the second dimension.
+*/
+
+static void
+conv2d_fft(const int reverse, const size_t i01, const size_t i02,
+           const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w)
+{
+  const size_t N = w->N1 * w->N2;
+  const size_t end1 = i01 + Y->size1;
+  const size_t end2 = i02 + Y->size2;
+  size_t b1, b2, i;
+
+  for (b1 = i01; b1 < end1; b1 += w->L1)
+    {
+      for (b2 = i02; b2 < end2; b2 += 2 * w->L2)
+        {
+          const size_t c2 = b2 + w->L2;
+          const int pair = (c2 < end2);
+
+          conv2d_load(reverse, 0, b1, b2, X, w);
+
+          if (pair)
+            conv2d_load(reverse, 1, b1, c2, X, w);
+          else
+            {
+              for (i = 0; i < N; ++i)
+                w->tile[2 * i + 1] = 0.0;
+            }
+
+          conv2d_transform(w->tile, gsl_fft_forward, w);
+
+          for (i = 0; i < N; ++i)
+            {
+              const double ar = w->tile[2 * i], ai = w->tile[2 * i + 1];
+              const double br = w->kernel_fft[2 * i], bi = w->kernel_fft[2 * i + 1];
+
+              w->tile[2 * i] = ar * br - ai * bi;
+              w->tile[2 * i + 1] = ar * bi + ai * br;
+            }
+
+          conv2d_transform(w->tile, gsl_fft_backward, w);
+
+          conv2d_store(reverse, 0, b1, b2, i01, i02, Y, w);
+
+          if (pair)
+            conv2d_store(reverse, 1, b1, c2, i01, i02, Y, w);
+        }
+    }
+}
+
+/* load input samples for the tile producing outputs starting at
+ * (b1,b2) into the real (part = 0) or imaginary (part = 1) part of
+ * the tile buffer */
+static void
+conv2d_load(const int reverse, const size_t part, const size_t b1, const size_t b2,
+            const gsl_matrix * X, gsl_conv2d_workspace * w)
+{
+  const size_t n1 = X->size1;
+  const size_t n2 = X->size2;
+  size_t r, c;
+
+  for (r = 0; r < w->N1; ++r)
+    {
+      const size_t p1 = b1 + r;
+      const int inside1 = (p1 >= w->K1 - 1 && p1 < n1 + w->K1 - 1);
+      double *row = w->tile + 2 * r * w->N2 + part;
+
+      for (c = 0; c < w->N2; ++c)
+        {
+          const size_t p2 = b2 + c;
+
+          if (inside1 && p2 >= w->K2 - 1 && p2 < n2 + w->K2 - 1)
+            {
+              const size_t q1 = p1 - (w->K1 - 1);
+              const size_t q2 = p2 - (w->K2 - 1);
+
+              row[2 * c] = reverse ? gsl_matrix_get(X, n1 - 1 - q1, n2 - 1 - q2) :
+                                     gsl_matrix_get(X, q1, q2);
+            }
+          else
+            row[2 * c] = 0.0;
+        }
+    }
+}
+
+/* store the outputs of a tile starting at (b1,b2) */
+static void
+conv2d_store(const int reverse, const size_t part, const size_t b1, const size_t b2,
+             const size_t i01, const size_t i02, gsl_matrix * Y,
+             const gsl_conv2d_workspace * w)
+{
+  const size_t ny1 = Y->size1;
+  const size_t ny2 = Y->size2;
+  const size_t nout1 = GSL_MIN(w->L1, i01 + ny1 - b1);
+  const size_t nout2 = GSL_MIN(w->L2, i02 + ny2 - b2);
+  size_t r, c;
+
+  for (r = 0; r < nout1; ++r)
+    {
+      const size_t m1 = b1 - i01 + r;
+      const double *row = w->tile + 2 * (r + w->K1 - 1) * w->N2 + part;
+
+      for (c = 0; c < nout2; ++c)
+        {
+          const size_t m2 = b2 - i02 + c;
+          const double val = row[2 * (c + w->K2 - 1)];
+
+          if (reverse)
+            gsl_matrix_set(Y, ny1 - 1 - m1, ny2 - 1 - m2, val);
+          else
+            gsl_matrix_set(Y, m1, m2, val);
+        }
+    }
+}
+
+/* unnormalized 2D complex transform of an N1-by-N2 row-major tile */
+static void
+conv2d_transform(double * data, const gsl_fft_direction sign, gsl_conv2d_workspace * w)
+{
+  size_t i;
+
+  for (i = 0; i < w->N1; ++i)
+    gsl_fft_complex_transform(data + 2 * i * w->N2, 1, w->N2, w->wavetable2, w->workspace2, sign);
+
+  for (i = 0; i < w->N2; ++i)
+    gsl_fft_complex_transform(data + 2 * i, w->N2, w->N1, w->wavetable1, w->workspace1, sign);
+}
+
+/*
+conv2d_select()
+  Cost model for the 2D case: direct summation costs 2 K1 K2 flops
+per output, while each pair of tiles costs a forward and an inverse
+complex 2D transform (about 5 N log2(N) flops each for N = N1 N2)
+plus the spectral product.
+*/
+
+static gsl_conv_method_t
+conv2d_select(const size_t ny1, const size_t ny2, const gsl_conv2d_workspace * w)
+{
+  const double N = (double) w->N1 * (double) w->N2;
+  const double ntiles1 = ceil((double) ny1 / (double) w->L1);
+  const double ntiles2 = ceil((double) ny2 / (double) (2 * w->L2));
+  const double direct_cost = 2.0 * (double) ny1 * (double) ny2 * (double) w->K1 * (double) w->K2;
+  const double fft_cost = ntiles1 * ntiles2 * N * (10.0 * log(N) / M_LN2 + 6.0);
+
+  return (direct_cost <= fft_cost) ? GSL_CONV_DIRECT : GSL_CONV_FFT;
+}
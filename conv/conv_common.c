@@ -0,0 +1,49 @@
+/* conv/conv_common.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* index of the full convolution at which the requested output starts */
+static size_t
+conv_offset(const size_t K, const gsl_conv_mode_t mode)
+{
+  switch (mode)
+    {
+      case GSL_CONV_SAME:
+        return (K - 1) / 2;
+
+      case GSL_CONV_VALID:
+        return K - 1;
+
+      default:
+        return 0;
+    }
+}
+
+/* FFT length used for a kernel of length K: the smallest power of
+ * 2 which is at least 4K (and at least nmin), so that each block
+ * produces at least 3/4 of its length as new output */
+static size_t
+conv_fft_length(const size_t K, const size_t nmin)
+{
+  size_t n = nmin;
+
+  while (n < 4 * K)
+    n *= 2;
+
+  return n;
+}
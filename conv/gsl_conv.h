@@ -0,0 +1,110 @@
+/* conv/gsl_conv.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_CONV_H__
+#define __GSL_CONV_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+#include <gsl/gsl_fft_complex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+/* which part of the full convolution to return */
+typedef enum
+{
+  GSL_CONV_FULL,     /* full convolution, length n + k - 1 */
+  GSL_CONV_SAME,     /* central part, same length as input */
+  GSL_CONV_VALID     /* part not influenced by zero padding, length n - k + 1 */
+} gsl_conv_mode_t;
+
+/* how to compute the convolution */
+typedef enum
+{
+  GSL_CONV_AUTO,     /* select method with a cost model */
+  GSL_CONV_DIRECT,   /* direct summation */
+  GSL_CONV_FFT       /* FFT overlap-save */
+} gsl_conv_method_t;
+
+typedef struct
+{
+  size_t K;                                   /* kernel length */
+  size_t nfft;                                /* FFT block length */
+  size_t L;                                   /* output samples per block, nfft - K + 1 */
+  double *kernel;                             /* kernel, size K */
+  double *kernel_fft;                         /* scaled halfcomplex spectrum of kernel, size nfft */
+  double *block;                              /* block buffer, size nfft */
+  gsl_fft_real_wavetable *real_wavetable;
+  gsl_fft_halfcomplex_wavetable *hc_wavetable;
+  gsl_fft_real_workspace *fft_workspace;
+} gsl_conv_workspace;
+
+typedef struct
+{
+  size_t K1;                                  /* kernel rows */
+  size_t K2;                                  /* kernel columns */
+  size_t N1;                                  /* FFT tile rows */
+  size_t N2;                                  /* FFT tile columns */
+  size_t L1;                                  /* output rows per tile, N1 - K1 + 1 */
+  size_t L2;                                  /* output columns per tile, N2 - K2 + 1 */
+  gsl_matrix *kernel;                         /* kernel, K1-by-K2 */
+  double *kernel_fft;                         /* scaled complex packed spectrum of kernel, N1*N2 */
+  double *tile;                               /* complex packed tile buffer, N1*N2 */
+  gsl_fft_complex_wavetable *wavetable1;      /* column transforms of length N1 */
+  gsl_fft_complex_wavetable *wavetable2;      /* row transforms of length N2 */
+  gsl_fft_complex_workspace *workspace1;
+  gsl_fft_complex_workspace *workspace2;
+} gsl_conv2d_workspace;
+
+size_t gsl_conv_length(const size_t n, const size_t k, const gsl_conv_mode_t mode);
+
+/* 1D */
+gsl_conv_workspace *gsl_conv_alloc(const gsl_vector * kernel);
+void gsl_conv_free(gsl_conv_workspace * w);
+int gsl_conv_set_kernel(const gsl_vector * kernel, gsl_conv_workspace * w);
+int gsl_conv(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+             const gsl_vector * x, gsl_vector * y, gsl_conv_workspace * w);
+int gsl_conv_corr(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+                  const gsl_vector * x, gsl_vector * y, gsl_conv_workspace * w);
+
+/* 2D */
+gsl_conv2d_workspace *gsl_conv2d_alloc(const gsl_matrix * kernel);
+void gsl_conv2d_free(gsl_conv2d_workspace * w);
+int gsl_conv2d_set_kernel(const gsl_matrix * kernel, gsl_conv2d_workspace * w);
+int gsl_conv2d(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+               const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w);
+int gsl_conv2d_corr(const gsl_conv_mode_t mode, const gsl_conv_method_t method,
+                    const gsl_matrix * X, gsl_matrix * Y, gsl_conv2d_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_CONV_H__ */
@@ -0,0 +1,259 @@
+/* conv/test.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_conv.h>
+
+static const char *
+mode_str(const gsl_conv_mode_t mode)
+{
+  switch (mode)
+    {
+      case GSL_CONV_FULL:
+        return "full";
+      case GSL_CONV_SAME:
+        return "same";
+      default:
+        return "valid";
+    }
+}
+
+static void
+random_vector(gsl_vector * v, gsl_rng * r)
+{
+  size_t i;
+
+  for (i = 0; i < v->size; ++i)
+    gsl_vector_set(v, i, 2.0 * gsl_rng_uniform(r) - 1.0);
+}
+
+static void
+random_matrix(gsl_matrix * m, gsl_rng * r)
+{
+  size_t i, j;
+
+  for (i = 0; i < m->size1; ++i)
+    for (j = 0; j < m->size2; ++j)
+      gsl_matrix_set(m, i, j, 2.0 * gsl_rng_uniform(r) - 1.0);
+}
+
+static size_t
+test_offset(const size_t K, const gsl_conv_mode_t mode)
+{
+  if (mode == GSL_CONV_SAME)
+    return (K - 1) / 2;
+  else if (mode == GSL_CONV_VALID)
+    return K - 1;
+  else
+    return 0;
+}
+
+/* reference convolution (corr = 0) or correlation (corr = 1) */
+static void
+slow_conv(const int corr, const gsl_conv_mode_t mode, const gsl_vector * x,
+          const gsl_vector * k, gsl_vector * y)
+{
+  const size_t n = x->size;
+  const size_t K = k->size;
+  const size_t offset = test_offset(K, mode);
+  size_t m, j;
+
+  for (m = 0; m < y->size; ++m)
+    {
+      const int i = (int) (m + offset);
+      double sum = 0.0;
+
+      for (j = 0; j < K; ++j)
+        {
+          int p = corr ? i + (int) j - (int) (K - 1) : i - (int) j;
+
+          if (p >= 0 && p < (int) n)
+            sum += gsl_vector_get(k, j) * gsl_vector_get(x, p);
+        }
+
+      gsl_vector_set(y, m, sum);
+    }
+}
+
+static void
+slow_conv2d(const int corr, const gsl_conv_mode_t mode, const gsl_matrix * X,
+            const gsl_matrix * k, gsl_matrix * Y)
+{
+  const size_t offset1 = test_offset(k->size1, mode);
+  const size_t offset2 = test_offset(k->size2, mode);
+  size_t m1, m2, a, b;
+
+  for (m1 = 0; m1 < Y->size1; ++m1)
+    {
+      for (m2 = 0; m2 < Y->size2; ++m2)
+        {
+          const int i1 = (int) (m1 + offset1);
+          const int i2 = (int) (m2 + offset2);
+          double sum = 0.0;
+
+          for (a = 0; a < k->size1; ++a)
+            {
+              for (b = 0; b < k->size2; ++b)
+                {
+                  int p1 = corr ? i1 + (int) a - (int) (k->size1 - 1) : i1 - (int) a;
+                  int p2 = corr ? i2 + (int) b - (int) (k->size2 - 1) : i2 - (int) b;
+
+                  if (p1 >= 0 && p1 < (int) X->size1 && p2 >= 0 && p2 < (int) X->size2)
+                    sum += gsl_matrix_get(k, a, b) * gsl_matrix_get(X, p1, p2);
+                }
+            }
+
+          gsl_matrix_set(Y, m1, m2, sum);
+        }
+    }
+}
+
+static void
+test_conv(const size_t n, const size_t K, const gsl_conv_mode_t mode, gsl_rng * r)
+{
+  const double tol = 1.0e-10;
+  const size_t ny = gsl_conv_length(n, K, mode);
+  const gsl_conv_method_t methods[] = { GSL_CONV_DIRECT, GSL_CONV_FFT, GSL_CONV_AUTO };
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *k = gsl_vector_alloc(K);
+  gsl_vector *y = gsl_vector_alloc(ny);
+  gsl_vector *y_expected = gsl_vector_alloc(ny);
+  gsl_conv_workspace *w = gsl_conv_alloc(k);
+  size_t corr, im, i;
+
+  random_vector(x, r);
+  random_vector(k, r);
+  gsl_conv_set_kernel(k, w);
+
+  for (corr = 0; corr < 2; ++corr)
+    {
+      slow_conv(corr, mode, x, k, y_expected);
+
+      for (im = 0; im < 3; ++im)
+        {
+          if (corr)
+            gsl_conv_corr(mode, methods[im], x, y, w);
+          else
+            gsl_conv(mode, methods[im], x, y, w);
+
+          for (i = 0; i < ny; ++i)
+            {
+              gsl_test_abs(gsl_vector_get(y, i), gsl_vector_get(y_expected, i), tol,
+                           "%s n=%zu K=%zu mode=%s method=%zu i=%zu",
+                           corr ? "corr" : "conv", n, K, mode_str(mode), im, i);
+            }
+        }
+    }
+
+  gsl_vector_free(x);
+  gsl_vector_free(k);
+  gsl_vector_free(y);
+  gsl_vector_free(y_expected);
+  gsl_conv_free(w);
+}
+
+static void
+test_conv2d(const size_t n1, const size_t n2, const size_t K1, const size_t K2,
+            const gsl_conv_mode_t mode, gsl_rng * r)
+{
+  const double tol = 1.0e-10;
+  const size_t ny1 = gsl_conv_length(n1, K1, mode);
+  const size_t ny2 = gsl_conv_length(n2, K2, mode);
+  const gsl_conv_method_t methods[] = { GSL_CONV_DIRECT, GSL_CONV_FFT, GSL_CONV_AUTO };
+  gsl_matrix *X = gsl_matrix_alloc(n1, n2);
+  gsl_matrix *k = gsl_matrix_alloc(K1, K2);
+  gsl_matrix *Y = gsl_matrix_alloc(ny1, ny2);
+  gsl_matrix *Y_expected = gsl_matrix_alloc(ny1, ny2);
+  gsl_conv2d_workspace *w;
+  size_t corr, im, i, j;
+
+  random_matrix(X, r);
+  random_matrix(k, r);
+  w = gsl_conv2d_alloc(k);
+
+  for (corr = 0; corr < 2; ++corr)
+    {
+      slow_conv2d(corr, mode, X, k, Y_expected);
+
+      for (im = 0; im < 3; ++im)
+        {
+          if (corr)
+            gsl_conv2d_corr(mode, methods[im], X, Y, w);
+          else
+            gsl_conv2d(mode, methods[im], X, Y, w);
+
+          for (i = 0; i < ny1; ++i)
+            {
+              for (j = 0; j < ny2; ++j)
+                {
+                  gsl_test_abs(gsl_matrix_get(Y, i, j), gsl_matrix_get(Y_expected, i, j), tol,
+                               "%s2d n=%zu,%zu K=%zu,%zu mode=%s method=%zu (%zu,%zu)",
+                               corr ? "corr" : "conv", n1, n2, K1, K2, mode_str(mode),
+                               im, i, j);
+                }
+            }
+        }
+    }
+
+  gsl_matrix_free(X);
+  gsl_matrix_free(k);
+  gsl_matrix_free(Y);
+  gsl_matrix_free(Y_expected);
+  gsl_conv2d_free(w);
+}
+
+int
+main()
+{
+  const gsl_conv_mode_t modes[] = { GSL_CONV_FULL, GSL_CONV_SAME, GSL_CONV_VALID };
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  size_t i;
+
+  gsl_ieee_env_setup();
+
+  for (i = 0; i < 3; ++i)
+    {
+      test_conv(1, 1, modes[i], r);
+      test_conv(10, 1, modes[i], r);
+      test_conv(10, 4, modes[i], r);
+      test_conv(17, 17, modes[i], r);
+      test_conv(100, 7, modes[i], r);
+      test_conv(300, 30, modes[i], r);
+      test_conv(1000, 65, modes[i], r);
+      test_conv(2000, 300, modes[i], r);
+
+      test_conv2d(1, 1, 1, 1, modes[i], r);
+      test_conv2d(8, 11, 3, 2, modes[i], r);
+      test_conv2d(40, 25, 5, 4, modes[i], r);
+      test_conv2d(50, 70, 9, 12, modes[i], r);
+    }
+
+  gsl_rng_free(r);
+
+  exit (gsl_test_summary());
+}
@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+#include <gsl/gsl_histogram.h>
+
+int
+main (void)
+{
+  const size_t N = 1000000;
+  const int nt = 4;             /* number of threads */
+
+  double * x = malloc (N * sizeof(double));
+  gsl_histogram * h = gsl_histogram_alloc (10);
+  gsl_histogram * ht[4];
+  gsl_rng * r;
+  size_t i;
+  int t;
+
+  gsl_rng_env_setup();
+  r = gsl_rng_alloc (gsl_rng_default);
+
+  for (i = 0; i < N; i++)
+    {
+      x[i] = gsl_ran_gaussian (r, 1.0);
+    }
+
+  gsl_histogram_set_ranges_uniform (h, -3.0, 3.0);
+
+  /* one histogram per thread, with the same bins */
+
+  for (t = 0; t < nt; t++)
+    {
+      ht[t] = gsl_histogram_clone (h);
+    }
+
+  /* values outside [-3,3) are skipped */
+
+#pragma omp parallel for
+  for (t = 0; t < nt; t++)
+    {
+      size_t lo = N * t / nt, hi = N * (t + 1) / nt;
+      gsl_histogram_accumulate_array (ht[t], x + lo, 1, NULL, 1, hi - lo);
+    }
+
+  for (t = 0; t < nt; t++)
+    {
+      gsl_histogram_add (h, ht[t]);
+      gsl_histogram_free (ht[t]);
+    }
+
+  gsl_histogram_fprintf (stdout, h, "%5.2f", "%g");
+  printf ("total = %g\n", gsl_histogram_sum (h));
+
+  free (x);
+  gsl_histogram_free (h);
+  gsl_rng_free (r);
+  return 0;
+}
@@ -0,0 +1,89 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_sort_double.h>
+
+/* merge a[0..n1) and b[0..n2) into dest, dividing the output
+   into nt parts which are merged independently */
+void
+parallel_merge (double * dest, const double * a, size_t n1,
+                const double * b, size_t n2, int nt)
+{
+  int t;
+
+#pragma omp parallel for
+  for (t = 0; t < nt; t++)
+    {
+      size_t k0 = (n1 + n2) * t / nt;
+      size_t k1 = (n1 + n2) * (t + 1) / nt;
+      size_t i0 = gsl_sort_merge_split (k0, a, 1, n1, b, 1, n2);
+      size_t i1 = gsl_sort_merge_split (k1, a, 1, n1, b, 1, n2);
+
+      gsl_sort_merge (dest + k0, 1, a + i0, 1, i1 - i0,
+                      b + (k0 - i0), 1, (k1 - i1) - (k0 - i0));
+    }
+}
+
+int
+main (void)
+{
+  const size_t N = 1000000;
+  const int nb = 8;             /* number of blocks, a power of 2 */
+
+  double * x = malloc (N * sizeof(double));
+  double * y = malloc (N * sizeof(double));
+  double * tmp;
+  gsl_rng * r;
+  size_t i;
+  int b, w;
+
+  gsl_rng_env_setup();
+  r = gsl_rng_alloc (gsl_rng_default);
+
+  for (i = 0; i < N; i++)
+    {
+      x[i] = gsl_rng_uniform(r);
+    }
+
+  /* sort each block */
+
+#pragma omp parallel for
+  for (b = 0; b < nb; b++)
+    {
+      size_t lo = N * b / nb, hi = N * (b + 1) / nb;
+      gsl_sort (x + lo, 1, hi - lo);
+    }
+
+  /* merge pairs of blocks until one remains */
+
+  for (w = 1; w < nb; w *= 2)
+    {
+      for (b = 0; b < nb; b += 2 * w)
+        {
+          size_t lo = N * b / nb;
+          size_t mid = N * (b + w) / nb;
+          size_t hi = N * (b + 2 * w) / nb;
+
+          parallel_merge (y + lo, x + lo, mid - lo,
+                          x + mid, hi - mid, nb);
+        }
+
+      tmp = x; x = y; y = tmp;
+    }
+
+  for (i = 1; i < N; i++)
+    {
+      if (x[i] < x[i - 1])
+        break;
+    }
+
+  printf ("%zu values, %s\n", N, (i == N) ? "sorted" : "not sorted");
+  printf ("smallest = %.8f\n", x[0]);
+  printf ("median   = %.8f\n", x[N / 2]);
+  printf ("largest  = %.8f\n", x[N - 1]);
+
+  free (x);
+  free (y);
+  gsl_rng_free (r);
+  return 0;
+}
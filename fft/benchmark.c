@@ -1,155 +1,460 @@
 /* fft/benchmark.c
- * 
+ *
  * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
- * 
+ * Copyright (C) 2026 The GSL Team
+ *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
  * the Free Software Foundation; either version 3 of the License, or (at
  * your option) any later version.
- * 
+ *
  * This program is distributed in the hope that it will be useful, but
  * WITHOUT ANY WARRANTY; without even the implied warranty of
  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
  * General Public License for more details.
- * 
+ *
  * You should have received a copy of the GNU General Public License
  * along with this program; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* Benchmark of the FFT routines.
+
+   Usage: benchmark [--csv | --json] [--min-time SECONDS] [N ...]
+
+   For each length N (by default a sweep of power-of-two, mixed-radix
+   and prime lengths) the forward transform is timed for complex and
+   real data, in double and single precision, with the mixed-radix and
+   (for powers of two) the radix-2 routines.  Each transform is timed
+   in-place, and out-of-place, where the input is copied into the
+   output buffer before every transform since the library routines
+   work in-place.
+
+   The results are reported as the time per transform, the time per
+   point, and the normalized rate 5 N log2(N) / t for complex data
+   (2.5 N log2(N) / t for real data) in GFLOP/s, the convention used
+   by benchFFT, so that results can be compared with other libraries.
+   The output is a table, or CSV or JSON for tracking regressions.
+
+   The program is not built by default; use "make benchmark" in this
+   directory. */
+
 #include <config.h>
 #include <stddef.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
 #include <math.h>
-#include <float.h>
-
 #include <time.h>
 
-#include <gsl/gsl_complex.h>
-#include <gsl/gsl_fft_complex.h>
-
 #include <gsl/gsl_errno.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_fft_complex_float.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_real_float.h>
 
-#include "complex_internal.h"
-#include "bitreverse.h"
 #include "urand.c"
 
-void my_error_handler (const char *reason, const char *file,
-                       int line, int err);
+enum { OUTPUT_TABLE, OUTPUT_CSV, OUTPUT_JSON };
 
-int
-main (int argc, char *argv[])
+typedef struct
+{
+  size_t n;
+  size_t nbytes;                /* size of input and output buffers */
+  void *in;
+  void *data;
+  void *wavetable;
+  void *workspace;
+} bench_state;
+
+typedef struct
+{
+  const char *name;
+  const char *precision;
+  int is_complex;
+  int pow2_only;
+  int (*init) (bench_state * s);
+  void (*free) (bench_state * s);
+  int (*run) (bench_state * s);
+} bench_type;
+
+static int
+complex_init (bench_state * s)
+{
+  s->wavetable = gsl_fft_complex_wavetable_alloc (s->n);
+  s->workspace = gsl_fft_complex_workspace_alloc (s->n);
+  return (s->wavetable == 0 || s->workspace == 0);
+}
+
+static void
+complex_free (bench_state * s)
+{
+  gsl_fft_complex_wavetable_free (s->wavetable);
+  gsl_fft_complex_workspace_free (s->workspace);
+}
+
+static int
+complex_run (bench_state * s)
+{
+  return gsl_fft_complex_forward (s->data, 1, s->n, s->wavetable, s->workspace);
+}
+
+static int
+complex_float_init (bench_state * s)
+{
+  s->wavetable = gsl_fft_complex_wavetable_float_alloc (s->n);
+  s->workspace = gsl_fft_complex_workspace_float_alloc (s->n);
+  return (s->wavetable == 0 || s->workspace == 0);
+}
+
+static void
+complex_float_free (bench_state * s)
+{
+  gsl_fft_complex_wavetable_float_free (s->wavetable);
+  gsl_fft_complex_workspace_float_free (s->workspace);
+}
+
+static int
+complex_float_run (bench_state * s)
+{
+  return gsl_fft_complex_float_forward (s->data, 1, s->n, s->wavetable, s->workspace);
+}
+
+static int
+real_init (bench_state * s)
+{
+  s->wavetable = gsl_fft_real_wavetable_alloc (s->n);
+  s->workspace = gsl_fft_real_workspace_alloc (s->n);
+  return (s->wavetable == 0 || s->workspace == 0);
+}
+
+static void
+real_free (bench_state * s)
+{
+  gsl_fft_real_wavetable_free (s->wavetable);
+  gsl_fft_real_workspace_free (s->workspace);
+}
+
+static int
+real_run (bench_state * s)
+{
+  return gsl_fft_real_transform (s->data, 1, s->n, s->wavetable, s->workspace);
+}
+
+static int
+real_float_init (bench_state * s)
+{
+  s->wavetable = gsl_fft_real_wavetable_float_alloc (s->n);
+  s->workspace = gsl_fft_real_workspace_float_alloc (s->n);
+  return (s->wavetable == 0 || s->workspace == 0);
+}
+
+static void
+real_float_free (bench_state * s)
+{
+  gsl_fft_real_wavetable_float_free (s->wavetable);
+  gsl_fft_real_workspace_float_free (s->workspace);
+}
+
+static int
+real_float_run (bench_state * s)
+{
+  return gsl_fft_real_float_transform (s->data, 1, s->n, s->wavetable, s->workspace);
+}
+
+static int
+radix2_init (bench_state * s)
+{
+  s->wavetable = 0;
+  s->workspace = 0;
+  return 0;
+}
+
+static void
+radix2_free (bench_state * s)
+{
+  (void) s;
+}
+
+static int
+complex_radix2_run (bench_state * s)
+{
+  return gsl_fft_complex_radix2_forward (s->data, 1, s->n);
+}
+
+static int
+complex_float_radix2_run (bench_state * s)
+{
+  return gsl_fft_complex_float_radix2_forward (s->data, 1, s->n);
+}
+
+static int
+real_radix2_run (bench_state * s)
 {
-  double *data, *fft_data;
-  gsl_fft_complex_wavetable * cw;
-  unsigned int i, logn;
-  int result;
-  int status;
-  clock_t start, end;
-  int resolution = CLOCKS_PER_SEC;
-  unsigned int n = 1;
+  return gsl_fft_real_radix2_transform (s->data, 1, s->n);
+}
+
+static int
+real_float_radix2_run (bench_state * s)
+{
+  return gsl_fft_real_float_radix2_transform (s->data, 1, s->n);
+}
+
+static const bench_type bench_types[] = {
+  { "complex", "double", 1, 0, complex_init, complex_free, complex_run },
+  { "complex", "float", 1, 0, complex_float_init, complex_float_free, complex_float_run },
+  { "complex_radix2", "double", 1, 1, radix2_init, radix2_free, complex_radix2_run },
+  { "complex_radix2", "float", 1, 1, radix2_init, radix2_free, complex_float_radix2_run },
+  { "real", "double", 0, 0, real_init, real_free, real_run },
+  { "real", "float", 0, 0, real_float_init, real_float_free, real_float_run },
+  { "real_radix2", "double", 0, 1, radix2_init, radix2_free, real_radix2_run },
+  { "real_radix2", "float", 0, 1, radix2_init, radix2_free, real_float_radix2_run },
+  { 0, 0, 0, 0, 0, 0, 0 }
+};
+
+/* default sweep: powers of two, products of small primes, primes */
+static const size_t default_sizes[] = {
+  16, 64, 256, 1024, 4096, 16384, 65536, 262144,
+  12, 60, 360, 1000, 3600, 10000, 100000,
+  17, 127, 1009, 4099,
+  0
+};
+
+static int
+is_pow2 (size_t n)
+{
+  return (n > 0 && (n & (n - 1)) == 0);
+}
+
+/* Number of consecutive in-place transforms which can be applied to
+   data of magnitude 1 without overflow, since each transform can
+   increase the magnitude by at most a factor of n.  The input is
+   restored (outside of the timed region) after each batch. */
+static size_t
+inplace_batch (size_t n, int is_float)
+{
+  const double log_max = is_float ? 25.0 * M_LN10 : 200.0 * M_LN10;
+  double r;
+
+  if (n < 2)
+    return 1000;
+
+  r = log_max / log ((double) n);
+
+  return (r < 1.0) ? 1 : (size_t) r;
+}
+
+/* Time one case, returning the mean time per transform in seconds,
+   or a negative value on error. */
+static double
+bench_time (const bench_type * t, const size_t n, const int inplace,
+            const double min_time)
+{
+  const int is_float = (strcmp (t->precision, "float") == 0);
+  const size_t elem = is_float ? sizeof (float) : sizeof (double);
+  const size_t nelem = t->is_complex ? 2 * n : n;
+  const clock_t min_clocks = (clock_t) (min_time * CLOCKS_PER_SEC);
+  bench_state s;
+  size_t batch, count = 0, i;
+  clock_t total = 0;
+  int status = 0;
 
-  gsl_set_error_handler (&my_error_handler);
+  s.n = n;
+  s.nbytes = nelem * elem;
+  s.in = malloc (s.nbytes);
+  s.data = malloc (s.nbytes);
 
-  if (argc == 2)
+  if (s.in == 0 || s.data == 0 || t->init (&s))
     {
-      n = strtol (argv[1], NULL, 0);
+      free (s.in);
+      free (s.data);
+      return -1.0;
     }
-  else
+
+  for (i = 0; i < nelem; i++)
     {
-      printf ("test n\n");
-      exit (EXIT_FAILURE);
+      double x = urand () - 0.5;
+
+      if (is_float)
+        ((float *) s.in)[i] = (float) x;
+      else
+        ((double *) s.in)[i] = x;
     }
 
-  cw = gsl_fft_complex_wavetable_alloc (n);
-  cwork = gsl_fft_complex_wavetable_workspace_alloc (n);
-  status = gsl_fft_complex_init (n, cw, cwork);
-  status = gsl_fft_complex_generate (n, cw, cwork);
+  batch = 16384 / n + 1;
 
-  data = (double *) malloc (n * 2 * sizeof (double));
-  fft_data = (double *) malloc (n * 2 * sizeof (double));
+  if (inplace && inplace_batch (n, is_float) < batch)
+    batch = inplace_batch (n, is_float);
 
-  for (i = 0; i < n; i++)
+  /* warm up the cache and the wavetable */
+  memcpy (s.data, s.in, s.nbytes);
+  status = t->run (&s);
+
+  while (status == 0 && total < min_clocks)
     {
-      REAL(data,1,i) = urand ();
-      IMAG(data,1,i) = urand ();
-    }
+      clock_t start, end;
 
+      memcpy (s.data, s.in, s.nbytes);
 
-  /* compute the fft */
+      start = clock ();
 
-  memcpy (fft_data, data, n * 2 * sizeof (double));
+      for (i = 0; i < batch && status == 0; i++)
+        {
+          if (!inplace)
+            memcpy (s.data, s.in, s.nbytes);
+
+          status = t->run (&s);
+        }
 
-  start = clock ();
-  i = 0;
-  do
-    {
-      status = gsl_fft_complex_forward (fft_data, 1, n, cw, cwork);
-      i++;
       end = clock ();
+
+      total += end - start;
+      count += batch;
     }
-  while (end < start + resolution && status == 0);
 
-  if (status == 0)
+  t->free (&s);
+  free (s.in);
+  free (s.data);
+
+  if (status)
+    return -1.0;
+
+  return ((double) total / CLOCKS_PER_SEC) / (double) count;
+}
+
+static void
+print_header (int format)
+{
+  if (format == OUTPUT_CSV)
+    {
+      printf ("transform,precision,placement,n,seconds,ns_per_point,gflops\n");
+    }
+  else if (format == OUTPUT_JSON)
     {
-      printf ("n = %d gsl_fft_complex_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      printf ("[\n");
     }
   else
     {
-      printf ("MR fft failed\n");
+      printf ("%-15s %-9s %-12s %8s %12s %10s %9s\n",
+              "transform", "precision", "placement", "n",
+              "seconds", "ns/point", "GFLOP/s");
     }
+}
 
+static void
+print_result (int format, int first, const bench_type * t, const char *placement,
+              size_t n, double seconds)
+{
+  const double flops = (t->is_complex ? 5.0 : 2.5) * n * log ((double) n) / M_LN2;
+  const double ns_per_point = 1.0e9 * seconds / (double) n;
+  const double gflops = (seconds > 0.0) ? 1.0e-9 * flops / seconds : 0.0;
 
-  /* compute the fft with radix2 */
-  memcpy (fft_data, data, n * 2 * sizeof (double));
-
-  result = fft_binary_logn(n) ;
-
-  if (result == -1) {
-    exit(EXIT_SUCCESS) ;
-  } else {
-    logn = result ;
-  }
-
-  start = clock ();
-  i = 0;
-  do
+  if (format == OUTPUT_CSV)
     {
-      status = gsl_fft_complex_radix2_forward (fft_data, 1, n);
-      i++;
-      end = clock ();
+      printf ("%s,%s,%s,%lu,%.6e,%.4f,%.4f\n", t->name, t->precision,
+              placement, (unsigned long) n, seconds, ns_per_point, gflops);
     }
-  while (end < start + resolution && status == 0);
-
-  if (status == 0)
+  else if (format == OUTPUT_JSON)
     {
-      printf ("n = %d gsl_fft_complex_radix2_forward %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+      printf ("%s  {\"transform\": \"%s\", \"precision\": \"%s\", "
+              "\"placement\": \"%s\", \"n\": %lu, \"seconds\": %.6e, "
+              "\"ns_per_point\": %.4f, \"gflops\": %.4f}",
+              first ? "" : ",\n", t->name, t->precision, placement,
+              (unsigned long) n, seconds, ns_per_point, gflops);
     }
   else
     {
-      printf ("fft_radix2: not a power of 2\n");
+      printf ("%-15s %-9s %-12s %8lu %12.4e %10.3f %9.3f\n", t->name,
+              t->precision, placement, (unsigned long) n, seconds,
+              ns_per_point, gflops);
+    }
+
+  fflush (stdout);
+}
+
+static void
+usage (void)
+{
+  fprintf (stderr, "usage: benchmark [--csv | --json] [--min-time SECONDS] [N ...]\n");
+  exit (EXIT_FAILURE);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const char *placements[] = { "in-place", "out-of-place" };
+  int format = OUTPUT_TABLE;
+  double min_time = 0.1;
+  size_t *sizes = malloc ((argc + 1) * sizeof (size_t));
+  size_t nsizes = 0, i, p;
+  int first = 1, a;
+  const bench_type *t;
+
+  for (a = 1; a < argc; a++)
+    {
+      if (strcmp (argv[a], "--csv") == 0)
+        {
+          format = OUTPUT_CSV;
+        }
+      else if (strcmp (argv[a], "--json") == 0)
+        {
+          format = OUTPUT_JSON;
+        }
+      else if (strcmp (argv[a], "--min-time") == 0 && a + 1 < argc)
+        {
+          min_time = strtod (argv[++a], NULL);
+        }
+      else
+        {
+          char *end;
+          unsigned long n = strtoul (argv[a], &end, 0);
+
+          if (*end != '\0' || n == 0)
+            usage ();
+
+          sizes[nsizes++] = n;
+        }
     }
 
-  start = clock ();
-  i = 0;
-  do
+  if (nsizes == 0)
     {
-      status = fft_complex_bitreverse_order (fft_data, 1, n, logn);
-      i++;
-      end = clock ();
+      for (i = 0; default_sizes[i] != 0; i++)
+        sizes[nsizes++] = default_sizes[i];
     }
-  while (end < start + resolution && status == 0);
 
-  printf ("n = %d gsl_fft_complex_bitreverse_order %f seconds\n", n, (end - start) / ((double) i) / ((double) CLOCKS_PER_SEC));
+  /* lengths which the routines reject are reported, not fatal */
+  gsl_set_error_handler_off ();
 
+  print_header (format);
 
-  return 0;
-}
+  for (i = 0; i < nsizes; i++)
+    {
+      for (t = bench_types; t->name != 0; t++)
+        {
+          if (t->pow2_only && !is_pow2 (sizes[i]))
+            continue;
 
+          for (p = 0; p < 2; p++)
+            {
+              double seconds = bench_time (t, sizes[i], p == 0, min_time);
 
-void
-my_error_handler (const char *reason, const char *file, int line, int err)
-{
-  printf ("error: %s in %s at %d (gsl_errno=%d)\n", reason, file, line, err);
+              if (seconds < 0.0)
+                {
+                  fprintf (stderr, "%s %s n=%lu failed\n", t->name,
+                           t->precision, (unsigned long) sizes[i]);
+                  continue;
+                }
+
+              print_result (format, first, t, placements[p], sizes[i], seconds);
+              first = 0;
+            }
+        }
+    }
+
+  if (format == OUTPUT_JSON)
+    printf ("\n]\n");
+
+  free (sizes);
+
+  return 0;
 }
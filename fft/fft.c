@@ -23,6 +23,7 @@
 #undef  BASE_FLOAT
 
 #include "factorize.c"
+#include "trig_table.c"
 
 #define BASE_DOUBLE
 #include "templates_on.h"
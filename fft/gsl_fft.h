@@ -46,6 +46,19 @@ gsl_fft_direction;
        
    where - is the forward transform direction and + the inverse direction */
 
+typedef enum
+  {
+    gsl_fft_dct_1, gsl_fft_dct_2, gsl_fft_dct_3, gsl_fft_dct_4,
+    gsl_fft_dst_1, gsl_fft_dst_2, gsl_fft_dst_3, gsl_fft_dst_4
+  }
+gsl_fft_trig_type;
+
+/* real-to-real trigonometric transforms, e.g. for the DCT-II
+
+   y(k) = 2 \sum x(n) cos(pi (n + 1/2) k / N)
+
+   see the documentation for the definitions of the other types */
+
 __END_DECLS
 
 #endif /* __GSL_FFT_H__ */
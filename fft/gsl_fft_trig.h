@@ -0,0 +1,63 @@
+/* fft/gsl_fft_trig.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_TRIG_H__
+#define __GSL_FFT_TRIG_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_real.h>
+#include <gsl/gsl_fft_halfcomplex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef struct
+  {
+    size_t n;
+    gsl_fft_trig_type type;
+    size_t nfft;
+    double *trig;
+    double *scratch;
+    gsl_fft_real_wavetable *real_wavetable;
+    gsl_fft_halfcomplex_wavetable *hc_wavetable;
+    gsl_fft_real_workspace *fft_workspace;
+  }
+gsl_fft_trig_workspace;
+
+gsl_fft_trig_workspace * gsl_fft_trig_workspace_alloc (size_t n, gsl_fft_trig_type type);
+
+void gsl_fft_trig_workspace_free (gsl_fft_trig_workspace * workspace);
+
+int gsl_fft_trig_transform (double data[], const size_t stride, const size_t n,
+                            gsl_fft_trig_workspace * work);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_TRIG_H__ */
@@ -0,0 +1,63 @@
+/* fft/gsl_fft_trig_float.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_FFT_TRIG_FLOAT_H__
+#define __GSL_FFT_TRIG_FLOAT_H__
+
+#include <stddef.h>
+
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_real_float.h>
+#include <gsl/gsl_fft_halfcomplex_float.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef struct
+  {
+    size_t n;
+    gsl_fft_trig_type type;
+    size_t nfft;
+    float *trig;
+    float *scratch;
+    gsl_fft_real_wavetable_float *real_wavetable;
+    gsl_fft_halfcomplex_wavetable_float *hc_wavetable;
+    gsl_fft_real_workspace_float *fft_workspace;
+  }
+gsl_fft_trig_workspace_float;
+
+gsl_fft_trig_workspace_float * gsl_fft_trig_workspace_float_alloc (size_t n, gsl_fft_trig_type type);
+
+void gsl_fft_trig_workspace_float_free (gsl_fft_trig_workspace_float * workspace);
+
+int gsl_fft_trig_float_transform (float data[], const size_t stride, const size_t n,
+                                  gsl_fft_trig_workspace_float * work);
+
+__END_DECLS
+
+#endif /* __GSL_FFT_TRIG_FLOAT_H__ */
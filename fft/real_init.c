@@ -24,7 +24,7 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
   size_t i;
   size_t n_factors;
   size_t t, product, product_1, q;
-  double d_theta;
+  fft_trig_table table;
 
   TYPE(gsl_fft_real_wavetable) * wavetable;
 
@@ -77,7 +77,17 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
 
   wavetable->nf = n_factors;
 
-  d_theta = 2.0 * M_PI / ((double) n);
+  status = fft_trig_table_init (&table, n);
+
+  if (status)
+    {
+      /* error in constructor, prevent memory leak */
+
+      free (wavetable->trig);
+      free (wavetable);
+
+      GSL_ERROR_VAL ("failed to allocate trigonometric table", GSL_ENOMEM, 0);
+    }
 
   t = 0;
   product = 1;
@@ -96,18 +106,20 @@ FUNCTION(gsl_fft_real_wavetable,alloc) (size_t n)
           size_t m = 0;
           for (k = 1; k < (product_1 + 1) / 2; k++)
             {
-              double theta;
+              double c, s;
               m = m + j * q;
               m = m % n;
-              theta = d_theta * m;      /*  d_theta*j*k*q */
-              GSL_REAL(wavetable->trig[t]) = cos (theta);
-              GSL_IMAG(wavetable->trig[t]) = sin (theta);
+              fft_trig_table_get (&table, m, &c, &s);  /* theta = 2 pi m/n */
+              GSL_REAL(wavetable->trig[t]) = c;
+              GSL_IMAG(wavetable->trig[t]) = s;
 
               t++;
             }
         }
     }
 
+  fft_trig_table_free (&table);
+
   if (t > (n / 2))
     {
       /* error in constructor, prevent memory leak */
@@ -34,12 +34,16 @@
 #include <gsl/gsl_fft_real_float.h>
 #include <gsl/gsl_fft_halfcomplex.h>
 #include <gsl/gsl_fft_halfcomplex_float.h>
+#include <gsl/gsl_fft_trig.h>
+#include <gsl/gsl_fft_trig_float.h>
 #include <gsl/gsl_ieee_utils.h>
 #include <gsl/gsl_test.h>
 
 void my_error_handler (const char *reason, const char *file,
                        int line, int err);
 
+double urand (void);
+
 #include "complex_internal.h"
 
 /* Usage: test [n]
@@ -53,6 +57,7 @@ void my_error_handler (const char *reason, const char *file,
 #include "test_complex_source.c"
 #include "test_real_source.c"
 #include "test_trap_source.c"
+#include "test_trig_source.c"
 #include "templates_off.h"
 #undef  BASE_DOUBLE
 
@@ -63,6 +68,7 @@ void my_error_handler (const char *reason, const char *file,
 #include "test_complex_source.c"
 #include "test_real_source.c"
 #include "test_trap_source.c"
+#include "test_trig_source.c"
 #include "templates_off.h"
 #undef  BASE_FLOAT
 
@@ -108,6 +114,8 @@ main (int argc, char *argv[])
           test_complex_float_func (stride, i) ;
           test_real_func (stride, i) ;
           test_real_float_func (stride, i) ;
+          test_trig_func (stride, i) ;
+          test_trig_float_func (stride, i) ;
         }
     }
 
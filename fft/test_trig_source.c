@@ -0,0 +1,135 @@
+/* fft/test_trig_source.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include "compare.h"
+
+void FUNCTION(test_trig,func) (size_t stride, size_t n);
+void FUNCTION(test_trig,dft) (gsl_fft_trig_type type, const BASE data[],
+                              BASE result[], size_t stride, size_t n);
+
+/* direct evaluation of the trigonometric transforms, in double precision */
+
+void
+FUNCTION(test_trig,dft) (gsl_fft_trig_type type, const BASE data[],
+                         BASE result[], size_t stride, size_t n)
+{
+  size_t j, k;
+  const double N = (double) n;
+
+  for (k = 0; k < n; k++)
+    {
+      double sum = 0.0;
+
+      for (j = 0; j < n; j++)
+        {
+          const double x = data[stride * j];
+          const double dj = (double) j, dk = (double) k;
+
+          switch (type)
+            {
+            case gsl_fft_dct_1:
+              if (j == 0 || j == n - 1)
+                sum += x * cos (M_PI * dj * dk / (N - 1));
+              else
+                sum += 2 * x * cos (M_PI * dj * dk / (N - 1));
+              break;
+            case gsl_fft_dct_2:
+              sum += 2 * x * cos (M_PI * (dj + 0.5) * dk / N);
+              break;
+            case gsl_fft_dct_3:
+              if (j == 0)
+                sum += x;
+              else
+                sum += 2 * x * cos (M_PI * dj * (dk + 0.5) / N);
+              break;
+            case gsl_fft_dct_4:
+              sum += 2 * x * cos (M_PI * (dj + 0.5) * (dk + 0.5) / N);
+              break;
+            case gsl_fft_dst_1:
+              sum += 2 * x * sin (M_PI * (dj + 1) * (dk + 1) / (N + 1));
+              break;
+            case gsl_fft_dst_2:
+              sum += 2 * x * sin (M_PI * (dj + 0.5) * (dk + 1) / N);
+              break;
+            case gsl_fft_dst_3:
+              if (j == n - 1)
+                sum += ((k % 2) ? -x : x);
+              else
+                sum += 2 * x * sin (M_PI * (dj + 1) * (dk + 0.5) / N);
+              break;
+            case gsl_fft_dst_4:
+              sum += 2 * x * sin (M_PI * (dj + 0.5) * (dk + 0.5) / N);
+              break;
+            }
+        }
+
+      result[stride * k] = (BASE) sum;
+    }
+}
+
+void
+FUNCTION(test_trig,func) (size_t stride, size_t n)
+{
+  static const char *names[] = { "dct_1", "dct_2", "dct_3", "dct_4",
+                                 "dst_1", "dst_2", "dst_3", "dst_4" };
+  int t;
+  size_t i;
+
+  BASE * data = (BASE *) malloc (n * stride * sizeof (BASE));
+  BASE * copy = (BASE *) malloc (n * stride * sizeof (BASE));
+  BASE * result = (BASE *) malloc (n * stride * sizeof (BASE));
+
+  gsl_set_error_handler (NULL); /* abort on any errors */
+
+  for (t = gsl_fft_dct_1; t <= gsl_fft_dst_4; t++)
+    {
+      const gsl_fft_trig_type type = (gsl_fft_trig_type) t;
+      TYPE(gsl_fft_trig_workspace) * work;
+      int status;
+
+      if (type == gsl_fft_dct_1 && n < 2)
+        continue;
+
+      for (i = 0; i < n * stride; i++)
+        {
+          data[i] = (BASE) (urand () - 0.5);
+          copy[i] = data[i];
+        }
+
+      work = FUNCTION(gsl_fft_trig_workspace,alloc) (n, type);
+      gsl_test (work == 0, NAME(gsl_fft_trig_workspace)
+                "_alloc, %s n = %d", names[t], n);
+
+      FUNCTION(gsl_fft_trig,transform) (data, stride, n, work);
+      FUNCTION(test_trig,dft) (type, copy, result, stride, n);
+
+      status = FUNCTION(compare_real,results) ("dft", result,
+                                               "fft", data,
+                                               stride, n, 1e6);
+      gsl_test (status, NAME(gsl_fft_trig)
+                " %s with noise, n = %d, stride = %d",
+                names[t], n, stride);
+
+      FUNCTION(gsl_fft_trig_workspace,free) (work);
+    }
+
+  free (data);
+  free (copy);
+  free (result);
+}
@@ -0,0 +1,41 @@
+/* fft/trig.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <math.h>
+
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+
+#include <gsl/gsl_fft_trig.h>
+#include <gsl/gsl_fft_trig_float.h>
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "trig_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "trig_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
@@ -0,0 +1,472 @@
+/* fft/trig_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Real-to-real trigonometric transforms computed with a single real
+   FFT of (nearly) the same length as the data.
+
+   The DCT-II uses the reordering of Makhoul (IEEE Trans. ASSP 28,
+   27-34, 1980): v(k) = x(2k), v(n-1-k) = x(2k+1), followed by a real
+   FFT of length n and a post-twiddle by exp(-i pi k/2n).  The DCT-III
+   reverses these steps with the halfcomplex FFT.
+
+   The DCT-IV uses the identity DCT-II(u)(k) = y(k) + y(k-1) where
+   u(j) = 2 cos(pi (2j+1)/4n) x(j), solved by forward substitution.
+
+   The DCT-I and DST-I of length n use a real FFT of length n-1 and
+   n+1 respectively.  The input is split into its symmetric and
+   antisymmetric parts, which map to the real and imaginary parts of
+   the FFT; the odd (respectively even) outputs are then recovered by
+   a recurrence, as in FFTW.
+
+   The DST-II, DST-III and DST-IV are obtained from the corresponding
+   DCT by reversing the input and/or negating alternate elements. */
+
+static void FUNCTION(fft_trig,dct2) (BASE x[], BASE v[],
+                                     const TYPE(gsl_fft_trig_workspace) * work);
+static void FUNCTION(fft_trig,dct3) (BASE x[], BASE v[],
+                                     const TYPE(gsl_fft_trig_workspace) * work);
+static void FUNCTION(fft_trig,dct4) (BASE x[], BASE v[],
+                                     const TYPE(gsl_fft_trig_workspace) * work);
+static void FUNCTION(fft_trig,dct1) (BASE x[], BASE u[],
+                                     const TYPE(gsl_fft_trig_workspace) * work);
+static void FUNCTION(fft_trig,dst1) (BASE x[], BASE u[],
+                                     const TYPE(gsl_fft_trig_workspace) * work);
+
+TYPE(gsl_fft_trig_workspace) *
+FUNCTION(gsl_fft_trig_workspace,alloc) (size_t n, gsl_fft_trig_type type)
+{
+  TYPE(gsl_fft_trig_workspace) * work;
+  size_t i, h, nfft;
+
+  BASE *cos_tab, *sin_tab, *quarter_tab;
+
+  if (n == 0)
+    {
+      GSL_ERROR_VAL ("length n must be positive integer", GSL_EDOM, 0);
+    }
+
+  switch (type)
+    {
+    case gsl_fft_dct_1:
+      if (n < 2)
+        {
+          GSL_ERROR_VAL ("length n must be at least 2 for DCT-I", GSL_EDOM, 0);
+        }
+      nfft = n - 1;
+      break;
+
+    case gsl_fft_dst_1:
+      nfft = n + 1;
+      break;
+
+    case gsl_fft_dct_2:
+    case gsl_fft_dct_3:
+    case gsl_fft_dct_4:
+    case gsl_fft_dst_2:
+    case gsl_fft_dst_3:
+    case gsl_fft_dst_4:
+      nfft = n;
+      break;
+
+    default:
+      GSL_ERROR_VAL ("unknown transform type", GSL_EINVAL, 0);
+    }
+
+  work = (TYPE(gsl_fft_trig_workspace) *)
+    calloc (1, sizeof (TYPE(gsl_fft_trig_workspace)));
+
+  if (work == NULL)
+    {
+      GSL_ERROR_VAL ("failed to allocate struct", GSL_ENOMEM, 0);
+    }
+
+  work->n = n;
+  work->type = type;
+  work->nfft = nfft;
+
+  /* three tables of length nfft + 1 for the pre- and post-processing */
+
+  h = nfft + 1;
+
+  work->trig = (BASE *) malloc (3 * h * sizeof (BASE));
+  work->scratch = (BASE *) malloc (2 * h * sizeof (BASE));
+  work->real_wavetable = FUNCTION(gsl_fft_real_wavetable,alloc) (nfft);
+  work->fft_workspace = FUNCTION(gsl_fft_real_workspace,alloc) (nfft);
+
+  if (type == gsl_fft_dct_3 || type == gsl_fft_dst_3)
+    {
+      work->hc_wavetable = FUNCTION(gsl_fft_halfcomplex_wavetable,alloc) (nfft);
+    }
+
+  if (work->trig == NULL || work->scratch == NULL
+      || work->real_wavetable == NULL || work->fft_workspace == NULL
+      || ((type == gsl_fft_dct_3 || type == gsl_fft_dst_3) && work->hc_wavetable == NULL))
+    {
+      /* error in constructor, prevent memory leak */
+
+      FUNCTION(gsl_fft_trig_workspace,free) (work);
+
+      GSL_ERROR_VAL ("failed to allocate trigonometric transform workspace",
+                        GSL_ENOMEM, 0);
+    }
+
+  cos_tab = work->trig;
+  sin_tab = work->trig + h;
+  quarter_tab = work->trig + 2 * h;
+
+  for (i = 0; i < 3 * h; i++)
+    {
+      work->trig[i] = 0;
+    }
+
+  if (type == gsl_fft_dct_1 || type == gsl_fft_dst_1)
+    {
+      /* cos(pi j/nfft), sin(pi j/nfft) */
+
+      for (i = 0; i < nfft; i++)
+        {
+          const double theta = M_PI * (double) i / (double) nfft;
+          cos_tab[i] = cos (theta);
+          sin_tab[i] = sin (theta);
+        }
+    }
+  else
+    {
+      /* cos(pi k/2n), sin(pi k/2n) for the DCT-II post-twiddle */
+
+      for (i = 0; i <= n / 2; i++)
+        {
+          const double theta = M_PI * (double) i / (2.0 * (double) n);
+          cos_tab[i] = cos (theta);
+          sin_tab[i] = sin (theta);
+        }
+
+      /* 2 cos(pi (2j+1)/4n) for the DCT-IV pre-twiddle */
+
+      if (type == gsl_fft_dct_4 || type == gsl_fft_dst_4)
+        {
+          for (i = 0; i < n; i++)
+            {
+              const double theta = M_PI * (2.0 * (double) i + 1.0) / (4.0 * (double) n);
+              quarter_tab[i] = 2.0 * cos (theta);
+            }
+        }
+    }
+
+  return work;
+}
+
+void
+FUNCTION(gsl_fft_trig_workspace,free) (TYPE(gsl_fft_trig_workspace) * work)
+{
+  RETURN_IF_NULL (work);
+
+  free (work->trig);
+  free (work->scratch);
+
+  FUNCTION(gsl_fft_real_wavetable,free) (work->real_wavetable);
+  FUNCTION(gsl_fft_halfcomplex_wavetable,free) (work->hc_wavetable);
+  FUNCTION(gsl_fft_real_workspace,free) (work->fft_workspace);
+
+  free (work);
+}
+
+int
+FUNCTION(gsl_fft_trig,transform) (BASE data[], const size_t stride, const size_t n,
+                                  TYPE(gsl_fft_trig_workspace) * work)
+{
+  BASE *const x = work->scratch;
+  BASE *const v = work->scratch + work->nfft + 1;
+  size_t i;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("length n must be positive integer", GSL_EDOM);
+    }
+
+  if (n != work->n)
+    {
+      GSL_ERROR ("workspace does not match length of data", GSL_EINVAL);
+    }
+
+  /* gather the input, reversing it for the DST-III and DST-IV */
+
+  switch (work->type)
+    {
+    case gsl_fft_dst_3:
+    case gsl_fft_dst_4:
+      for (i = 0; i < n; i++)
+        {
+          x[i] = data[stride * (n - 1 - i)];
+        }
+      break;
+
+    case gsl_fft_dst_2:
+      for (i = 0; i < n; i++)
+        {
+          x[i] = (i % 2) ? -data[stride * i] : data[stride * i];
+        }
+      break;
+
+    default:
+      for (i = 0; i < n; i++)
+        {
+          x[i] = data[stride * i];
+        }
+    }
+
+  switch (work->type)
+    {
+    case gsl_fft_dct_1:
+      FUNCTION(fft_trig,dct1) (x, v, work);
+      break;
+
+    case gsl_fft_dst_1:
+      FUNCTION(fft_trig,dst1) (x, v, work);
+      break;
+
+    case gsl_fft_dct_2:
+    case gsl_fft_dst_2:
+      FUNCTION(fft_trig,dct2) (x, v, work);
+      break;
+
+    case gsl_fft_dct_3:
+    case gsl_fft_dst_3:
+      FUNCTION(fft_trig,dct3) (x, v, work);
+      break;
+
+    case gsl_fft_dct_4:
+    case gsl_fft_dst_4:
+      FUNCTION(fft_trig,dct4) (x, v, work);
+      break;
+    }
+
+  /* scatter the output, reversing it for the DST-II and negating
+     odd elements for the DST-III and DST-IV */
+
+  switch (work->type)
+    {
+    case gsl_fft_dst_2:
+      for (i = 0; i < n; i++)
+        {
+          data[stride * i] = x[n - 1 - i];
+        }
+      break;
+
+    case gsl_fft_dst_3:
+    case gsl_fft_dst_4:
+      for (i = 0; i < n; i++)
+        {
+          data[stride * i] = (i % 2) ? -x[i] : x[i];
+        }
+      break;
+
+    default:
+      for (i = 0; i < n; i++)
+        {
+          data[stride * i] = x[i];
+        }
+    }
+
+  return 0;
+}
+
+/* DCT-II in place on x[0..n-1], using v[0..n-1] as scratch space */
+
+static void
+FUNCTION(fft_trig,dct2) (BASE x[], BASE v[],
+                         const TYPE(gsl_fft_trig_workspace) * work)
+{
+  const size_t n = work->n;
+  const BASE *cos_tab = work->trig;
+  const BASE *sin_tab = work->trig + work->nfft + 1;
+  size_t k;
+
+  for (k = 0; k < (n + 1) / 2; k++)
+    {
+      v[k] = x[2 * k];
+    }
+
+  for (k = 0; k < n / 2; k++)
+    {
+      v[n - 1 - k] = x[2 * k + 1];
+    }
+
+  FUNCTION(gsl_fft_real,transform) (v, 1, n, work->real_wavetable, work->fft_workspace);
+
+  x[0] = 2 * v[0];
+
+  for (k = 1; k < (n + 1) / 2; k++)
+    {
+      const ATOMIC a = v[2 * k - 1], b = v[2 * k];
+      const ATOMIC c = cos_tab[k], s = sin_tab[k];
+      x[k] = 2 * (c * a + s * b);
+      x[n - k] = 2 * (s * a - c * b);
+    }
+
+  if (n % 2 == 0)
+    {
+      x[n / 2] = 2 * cos_tab[n / 2] * v[n - 1];
+    }
+}
+
+/* DCT-III in place on x[0..n-1], the inverse of dct2 up to a factor 2n */
+
+static void
+FUNCTION(fft_trig,dct3) (BASE x[], BASE v[],
+                         const TYPE(gsl_fft_trig_workspace) * work)
+{
+  const size_t n = work->n;
+  const BASE *cos_tab = work->trig;
+  const BASE *sin_tab = work->trig + work->nfft + 1;
+  size_t k;
+
+  v[0] = x[0];
+
+  for (k = 1; k < (n + 1) / 2; k++)
+    {
+      const ATOMIC c = cos_tab[k], s = sin_tab[k];
+      v[2 * k - 1] = c * x[k] + s * x[n - k];
+      v[2 * k] = s * x[k] - c * x[n - k];
+    }
+
+  if (n % 2 == 0)
+    {
+      v[n - 1] = 2 * cos_tab[n / 2] * x[n / 2];
+    }
+
+  FUNCTION(gsl_fft_halfcomplex,transform) (v, 1, n, work->hc_wavetable, work->fft_workspace);
+
+  for (k = 0; k < (n + 1) / 2; k++)
+    {
+      x[2 * k] = v[k];
+    }
+
+  for (k = 0; k < n / 2; k++)
+    {
+      x[2 * k + 1] = v[n - 1 - k];
+    }
+}
+
+/* DCT-IV in place on x[0..n-1] */
+
+static void
+FUNCTION(fft_trig,dct4) (BASE x[], BASE v[],
+                         const TYPE(gsl_fft_trig_workspace) * work)
+{
+  const size_t n = work->n;
+  const BASE *quarter_tab = work->trig + 2 * (work->nfft + 1);
+  size_t k;
+
+  for (k = 0; k < n; k++)
+    {
+      x[k] *= quarter_tab[k];
+    }
+
+  FUNCTION(fft_trig,dct2) (x, v, work);
+
+  x[0] *= 0.5;
+
+  for (k = 1; k < n; k++)
+    {
+      x[k] -= x[k - 1];
+    }
+}
+
+/* DCT-I of x[0..n-1], using u[0..n-2] for a real FFT of length n-1 */
+
+static void
+FUNCTION(fft_trig,dct1) (BASE x[], BASE u[],
+                         const TYPE(gsl_fft_trig_workspace) * work)
+{
+  const size_t m = work->nfft;
+  const BASE *cos_tab = work->trig;
+  const BASE *sin_tab = work->trig + m + 1;
+  ATOMIC y1 = x[0] - x[m];
+  size_t j, k;
+
+  u[0] = x[0] + x[m];
+
+  for (j = 1; j < m; j++)
+    {
+      const ATOMIC s = x[j] + x[m - j];
+      const ATOMIC d = x[j] - x[m - j];
+      u[j] = s - 2 * sin_tab[j] * d;
+      y1 += d * cos_tab[j];
+    }
+
+  FUNCTION(gsl_fft_real,transform) (u, 1, m, work->real_wavetable, work->fft_workspace);
+
+  /* even outputs are the real parts of the transform */
+
+  x[0] = u[0];
+
+  for (k = 1; 2 * k <= m; k++)
+    {
+      x[2 * k] = (2 * k == m) ? u[m - 1] : u[2 * k - 1];
+    }
+
+  /* odd outputs follow from the imaginary parts by recurrence */
+
+  x[1] = y1;
+
+  for (k = 1; 2 * k + 1 <= m; k++)
+    {
+      x[2 * k + 1] = x[2 * k - 1] - u[2 * k];
+    }
+}
+
+/* DST-I of x[0..n-1], using u[0..n] for a real FFT of length n+1 */
+
+static void
+FUNCTION(fft_trig,dst1) (BASE x[], BASE u[],
+                         const TYPE(gsl_fft_trig_workspace) * work)
+{
+  const size_t m = work->nfft;
+  const BASE *sin_tab = work->trig + m + 1;
+  size_t j, k;
+
+  /* the input is x~(j) = x(j-1) for j = 1..m-1, with x~(0) = 0 */
+
+  u[0] = 0;
+
+  for (j = 1; j < m; j++)
+    {
+      const ATOMIC s = x[j - 1] + x[m - j - 1];
+      const ATOMIC d = x[j - 1] - x[m - j - 1];
+      u[j] = d + 2 * sin_tab[j] * s;
+    }
+
+  FUNCTION(gsl_fft_real,transform) (u, 1, m, work->real_wavetable, work->fft_workspace);
+
+  /* output y(k-1) = Y(k) for k = 1..m-1, odd k by recurrence on the
+     real parts and even k from the imaginary parts */
+
+  x[0] = 0.5 * u[0];
+
+  for (k = 1; 2 * k + 1 <= m - 1; k++)
+    {
+      x[2 * k] = x[2 * k - 2] + u[2 * k - 1];
+    }
+
+  for (k = 1; 2 * k <= m - 1; k++)
+    {
+      x[2 * k - 1] = -u[2 * k];
+    }
+}
@@ -0,0 +1,127 @@
+/* fft/trig_table.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Temporary table of cos(2 pi m/n) and sin(2 pi m/n) used while
+   building the wavetables.
+
+   The angle 2 pi m/n = (pi/4) u/n with u = 8m is reduced to the first
+   octant [0, pi/4] by the exact integer reflections u -> 8n - u,
+   u -> 4n - u and u -> 2n - u.  The reduced values of u are multiples
+   of g = gcd(8, 2n), so at most n/g + 1 distinct sines and cosines
+   are needed (n/8 + 1 when n is a multiple of 4).  They are computed
+   on first use, so each is evaluated once instead of once per
+   twiddle factor, and the arguments passed to the library functions
+   are small and free of rounding from range reduction. */
+
+#include "trig_table.h"
+
+static int
+fft_trig_table_init (fft_trig_table * table, size_t n)
+{
+  size_t i, shift;
+
+  if (n % 4 == 0)
+    {
+      shift = 3;
+    }
+  else if (n % 2 == 0)
+    {
+      shift = 2;
+    }
+  else
+    {
+      shift = 1;
+    }
+
+  table->n = n;
+  table->shift = shift;
+  table->c = (double *) malloc (2 * ((n >> shift) + 1) * sizeof (double));
+
+  if (table->c == NULL)
+    {
+      return GSL_ENOMEM;
+    }
+
+  table->s = table->c + ((n >> shift) + 1);
+
+  /* mark all entries as not yet computed */
+
+  for (i = 0; i <= (n >> shift); i++)
+    {
+      table->c[i] = -1.0;
+    }
+
+  return 0;
+}
+
+static void
+fft_trig_table_free (fft_trig_table * table)
+{
+  free (table->c);
+  table->c = NULL;
+  table->s = NULL;
+}
+
+/* return cos(2 pi m/n) and sin(2 pi m/n) for 0 <= m < n */
+
+static void
+fft_trig_table_get (fft_trig_table * table, size_t m,
+                    double *c, double *s)
+{
+  const size_t n = table->n;
+  size_t u = 8 * m;
+  size_t i;
+  double sign_c = 1.0, sign_s = 1.0;
+  int swap = 0;
+  double cphi, sphi;
+
+  if (u > 4 * n)
+    {
+      u = 8 * n - u;            /* 2 pi - phi */
+      sign_s = -1.0;
+    }
+
+  if (u > 2 * n)
+    {
+      u = 4 * n - u;            /* pi - phi */
+      sign_c = -1.0;
+    }
+
+  if (u > n)
+    {
+      u = 2 * n - u;            /* pi/2 - phi */
+      swap = 1;
+    }
+
+  i = u >> table->shift;
+
+  if (table->c[i] < 0.0)
+    {
+      /* cos(phi) >= cos(pi/4) on the first octant */
+      const double phi = (M_PI / 4.0) * ((double) u / (double) n);
+      table->c[i] = cos (phi);
+      table->s[i] = sin (phi);
+    }
+
+  cphi = table->c[i];
+  sphi = table->s[i];
+
+  *c = sign_c * (swap ? sphi : cphi);
+  *s = sign_s * (swap ? cphi : sphi);
+}
@@ -0,0 +1,34 @@
+/* fft/trig_table.h
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+typedef struct
+{
+  size_t n;
+  size_t shift;
+  double *c;
+  double *s;
+}
+fft_trig_table;
+
+static int fft_trig_table_init (fft_trig_table * table, size_t n);
+
+static void fft_trig_table_free (fft_trig_table * table);
+
+static void fft_trig_table_get (fft_trig_table * table, size_t m,
+                                double *c, double *s);
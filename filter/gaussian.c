@@ -0,0 +1,290 @@
+/* filter/gaussian.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module applies a Gaussian filter, or one of its derivatives,
+ *
+ * y_i = sum_{j=-H}^{H} G_j x_{i-j}
+ *
+ * to an input vector, with the kernel
+ *
+ * G_j = (-1/sigma)^d He_d(j/sigma) g_j / sum_j g_j,  g_j = exp(-j^2 / (2 sigma^2))
+ *
+ * for the derivative of order d, where He_d is the probabilists' Hermite
+ * polynomial and sigma = (K - 1) / (2 alpha) for a window of K = 2H + 1
+ * samples. The filter is computed with the convolution routines, which
+ * use direct summation for short windows and the overlap-save FFT method
+ * for long ones, so the cost per sample grows only as log K. The first
+ * and last H outputs, whose windows extend past the data, are then
+ * recomputed directly for the requested end handling.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_conv.h>
+#include <gsl/gsl_filter.h>
+
+static double gaussian_edge(const gsl_filter_end_t endtype, const double alpha, const size_t i,
+                            const gsl_vector * x, const gsl_filter_gaussian_workspace * w);
+
+/*
+gsl_filter_gaussian_alloc()
+  Allocate a workspace for Gaussian filtering with a window of K
+samples. If K is even it is rounded up to the next odd number.
+*/
+
+gsl_filter_gaussian_workspace *
+gsl_filter_gaussian_alloc(const size_t K)
+{
+  const size_t H = K / 2;
+  gsl_filter_gaussian_workspace *w;
+
+  w = calloc(1, sizeof(gsl_filter_gaussian_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->K = 2 * H + 1;
+
+  w->kernel = gsl_vector_calloc(w->K);
+  if (w->kernel == 0)
+    {
+      gsl_filter_gaussian_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel", GSL_ENOMEM);
+    }
+
+  w->conv_workspace_p = gsl_conv_alloc(w->kernel);
+  if (w->conv_workspace_p == 0)
+    {
+      gsl_filter_gaussian_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for convolution workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_filter_gaussian_free(gsl_filter_gaussian_workspace * w)
+{
+  if (w->kernel)
+    gsl_vector_free(w->kernel);
+
+  if (w->conv_workspace_p)
+    gsl_conv_free(w->conv_workspace_p);
+
+  free(w);
+}
+
+/*
+gsl_filter_gaussian()
+  Apply a Gaussian filter, or its derivative, to an input vector
+
+Inputs: endtype - how to handle the ends of the input
+        alpha   - number of standard deviations in half the window,
+                  sigma = (K - 1) / (2 alpha)
+        order   - order of derivative, 0 for smoothing
+        x       - input vector, size n
+        y       - (output) filtered vector, size n, distinct from x
+        w       - workspace
+*/
+
+int
+gsl_filter_gaussian(const gsl_filter_end_t endtype, const double alpha, const size_t order,
+                    const gsl_vector * x, gsl_vector * y, gsl_filter_gaussian_workspace * w)
+{
+  const size_t n = x->size;
+
+  if (n != y->size)
+    {
+      GSL_ERROR ("input and output vectors must have same length", GSL_EBADLEN);
+    }
+  else if (alpha <= 0.0)
+    {
+      GSL_ERROR ("alpha must be positive", GSL_EDOM);
+    }
+  else if (n == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else if (x->data == y->data)
+    {
+      GSL_ERROR ("input and output vectors must be distinct", GSL_EINVAL);
+    }
+  else
+    {
+      const size_t H = w->K / 2;
+      size_t i;
+      int status;
+
+      status = gsl_filter_gaussian_kernel(alpha, order, 1, w->kernel);
+      if (status)
+        return status;
+
+      status = gsl_conv_set_kernel(w->kernel, w->conv_workspace_p);
+      if (status)
+        return status;
+
+      /* result for zero padding */
+      status = gsl_conv(GSL_CONV_SAME, GSL_CONV_AUTO, x, y, w->conv_workspace_p);
+      if (status)
+        return status;
+
+      if (endtype != GSL_FILTER_END_PADZERO)
+        {
+          for (i = 0; i < GSL_MIN(H, n); ++i)
+            gsl_vector_set(y, i, gaussian_edge(endtype, alpha, i, x, w));
+
+          for (i = GSL_MAX(n - GSL_MIN(H, n), H); i < n; ++i)
+            gsl_vector_set(y, i, gaussian_edge(endtype, alpha, i, x, w));
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_filter_gaussian_kernel()
+  Compute a Gaussian kernel, or the kernel of its derivative
+
+Inputs: alpha     - number of standard deviations in half the kernel
+        order     - order of derivative
+        normalize - if set, divide by the sum of the Gaussian weights,
+                    so the kernel of order 0 sums to 1
+        kernel    - (output) kernel, size K; if K is even the center is
+                    taken to be at K/2
+*/
+
+int
+gsl_filter_gaussian_kernel(const double alpha, const size_t order, const int normalize,
+                           gsl_vector * kernel)
+{
+  const size_t K = kernel->size;
+
+  if (K == 0)
+    {
+      GSL_ERROR ("kernel length must be positive", GSL_EBADLEN);
+    }
+  else if (alpha <= 0.0)
+    {
+      GSL_ERROR ("alpha must be positive", GSL_EDOM);
+    }
+  else if (K == 1)
+    {
+      gsl_vector_set(kernel, 0, (order == 0) ? 1.0 : 0.0);
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const double H = 0.5 * (K - 1.0);
+      const double sigma = H / alpha;
+      double sum = 0.0;
+      size_t i, k;
+
+      for (i = 0; i < K; ++i)
+        {
+          const double u = ((double) i - (double) (K / 2)) / sigma;
+          const double g = exp(-0.5 * u * u);
+          double He0 = 1.0, He1 = u;
+
+          /* He_k(u) by the recurrence He_{k+1} = u He_k - k He_{k-1} */
+          for (k = 1; k < order; ++k)
+            {
+              const double He2 = u * He1 - k * He0;
+              He0 = He1;
+              He1 = He2;
+            }
+
+          sum += g;
+
+          if (order == 0)
+            gsl_vector_set(kernel, i, g);
+          else
+            gsl_vector_set(kernel, i, gsl_pow_uint(-1.0 / sigma, (unsigned int) order) * He1 * g);
+        }
+
+      if (normalize)
+        gsl_vector_scale(kernel, 1.0 / sum);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gaussian_edge()
+  Compute output i of the filter, whose window extends past the ends of
+the input, by direct summation. Missing samples are taken to be the
+first or last sample for GSL_FILTER_END_PADVALUE; for
+GSL_FILTER_END_TRUNCATE they are omitted and the result is scaled by
+the fraction of the Gaussian weight inside the data.
+*/
+
+static double
+gaussian_edge(const gsl_filter_end_t endtype, const double alpha, const size_t i,
+              const gsl_vector * x, const gsl_filter_gaussian_workspace * w)
+{
+  const size_t n = x->size;
+  const size_t K = w->K;
+  const size_t H = K / 2;
+  const double sigma = (H > 0) ? H / alpha : 1.0;
+  double sum = 0.0, wall = 0.0, win = 0.0;
+  size_t m;
+
+  for (m = 0; m < K; ++m)
+    {
+      /* kernel element m multiplies x_{i+H-m} */
+      const double km = gsl_vector_get(w->kernel, m);
+      const double u = ((double) m - (double) H) / sigma;
+      const double g = exp(-0.5 * u * u);
+      double xm;
+
+      wall += g;
+
+      if (i + H < m)
+        {
+          if (endtype == GSL_FILTER_END_TRUNCATE)
+            continue;
+
+          xm = gsl_vector_get(x, 0);
+        }
+      else if (i + H - m >= n)
+        {
+          if (endtype == GSL_FILTER_END_TRUNCATE)
+            continue;
+
+          xm = gsl_vector_get(x, n - 1);
+        }
+      else
+        {
+          xm = gsl_vector_get(x, i + H - m);
+        }
+
+      sum += km * xm;
+      win += g;
+    }
+
+  if (endtype == GSL_FILTER_END_TRUNCATE)
+    sum *= wall / win;
+
+  return sum;
+}
@@ -0,0 +1,173 @@
+/* filter/impulse.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module applies an impulse detection filter, which replaces each
+ * sample x_i by the median m_i of its window when
+ *
+ * |x_i - m_i| > t S_i
+ *
+ * where S_i is a robust estimate of the standard deviation of the
+ * window. With the median absolute deviation as the scale estimate
+ * this is the Hampel filter. The moving median and scale are computed
+ * with the movstat routines, in O(log K) time per sample.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_movstat.h>
+#include <gsl/gsl_filter.h>
+
+/*
+gsl_filter_impulse_alloc()
+  Allocate a workspace for impulse detection filtering with a window
+of K samples. If K is even it is rounded up to the next odd number.
+*/
+
+gsl_filter_impulse_workspace *
+gsl_filter_impulse_alloc(const size_t K)
+{
+  gsl_filter_impulse_workspace *w;
+
+  w = calloc(1, sizeof(gsl_filter_impulse_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->movstat_workspace_p = gsl_movstat_alloc(K);
+  if (w->movstat_workspace_p == 0)
+    {
+      gsl_filter_impulse_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for movstat workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_filter_impulse_free(gsl_filter_impulse_workspace * w)
+{
+  if (w->movstat_workspace_p)
+    gsl_movstat_free(w->movstat_workspace_p);
+
+  free(w);
+}
+
+/*
+gsl_filter_impulse()
+  Apply an impulse detection filter to an input vector
+
+Inputs: endtype    - how to handle the ends of the input
+        scale_type - robust scale estimate of each window
+        t          - threshold, in units of the scale estimate
+        x          - input vector, size n
+        y          - (output) filtered vector, size n; may be the same as x
+        xmedian    - (output) median of each window, size n
+        xsigma     - (output) scale estimate of each window, size n
+        noutlier   - (output) number of outliers found
+        ioutlier   - (output) ioutlier[i] = 1 if x_i is an outlier,
+                     0 otherwise, size n; may be NULL
+        w          - workspace
+*/
+
+int
+gsl_filter_impulse(const gsl_filter_end_t endtype, const gsl_filter_scale_t scale_type,
+                   const double t, const gsl_vector * x, gsl_vector * y,
+                   gsl_vector * xmedian, gsl_vector * xsigma, size_t * noutlier,
+                   gsl_vector_int * ioutlier, gsl_filter_impulse_workspace * w)
+{
+  const size_t n = x->size;
+
+  if (n != y->size || n != xmedian->size || n != xsigma->size)
+    {
+      GSL_ERROR ("input and output vectors must have same length", GSL_EBADLEN);
+    }
+  else if (ioutlier != NULL && n != ioutlier->size)
+    {
+      GSL_ERROR ("outlier vector must have same length as input", GSL_EBADLEN);
+    }
+  else if (t < 0.0)
+    {
+      GSL_ERROR ("threshold must be non-negative", GSL_EDOM);
+    }
+  else
+    {
+      const gsl_movstat_end_t end = (gsl_movstat_end_t) endtype;
+      gsl_movstat_workspace *mw = w->movstat_workspace_p;
+      size_t i;
+      int status;
+
+      if (scale_type == GSL_FILTER_SCALE_MAD)
+        {
+          status = gsl_movstat_mad(end, x, xmedian, xsigma, mw);
+          if (status)
+            return status;
+        }
+      else if (scale_type == GSL_FILTER_SCALE_IQR)
+        {
+          /* S = IQR / 1.349, the interquartile range of a Gaussian
+             divided by its standard deviation */
+          const double scale = 0.741301109252801;
+
+          status = gsl_movstat_quantile(end, x, 0.25, xmedian, mw);
+          if (status)
+            return status;
+
+          status = gsl_movstat_quantile(end, x, 0.75, xsigma, mw);
+          if (status)
+            return status;
+
+          gsl_vector_sub(xsigma, xmedian);
+          gsl_vector_scale(xsigma, scale);
+
+          status = gsl_movstat_median(end, x, xmedian, mw);
+          if (status)
+            return status;
+        }
+      else
+        {
+          GSL_ERROR ("unknown scale type", GSL_EINVAL);
+        }
+
+      *noutlier = 0;
+
+      for (i = 0; i < n; ++i)
+        {
+          const double xi = gsl_vector_get(x, i);
+          const double mi = gsl_vector_get(xmedian, i);
+          const double si = gsl_vector_get(xsigma, i);
+          const int outlier = (fabs(xi - mi) > t * si);
+
+          if (outlier)
+            ++(*noutlier);
+
+          gsl_vector_set(y, i, outlier ? mi : xi);
+
+          if (ioutlier != NULL)
+            gsl_vector_int_set(ioutlier, i, outlier);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
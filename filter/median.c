@@ -0,0 +1,80 @@
+/* filter/median.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_movstat.h>
+#include <gsl/gsl_filter.h>
+
+/*
+gsl_filter_median_alloc()
+  Allocate a workspace for median filtering with a window of K
+samples. If K is even it is rounded up to the next odd number.
+*/
+
+gsl_filter_median_workspace *
+gsl_filter_median_alloc(const size_t K)
+{
+  gsl_filter_median_workspace *w;
+
+  w = calloc(1, sizeof(gsl_filter_median_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->movstat_workspace_p = gsl_movstat_alloc(K);
+  if (w->movstat_workspace_p == 0)
+    {
+      gsl_filter_median_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for movstat workspace", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_filter_median_free(gsl_filter_median_workspace * w)
+{
+  if (w->movstat_workspace_p)
+    gsl_movstat_free(w->movstat_workspace_p);
+
+  free(w);
+}
+
+/*
+gsl_filter_median()
+  Apply a standard median filter to an input vector, with the moving
+median of gsl_movstat_median() in O(log K) time per sample
+
+Inputs: endtype - how to handle the ends of the input
+        x       - input vector, size n
+        y       - (output) filtered vector, size n; may be the same as x
+        w       - workspace
+*/
+
+int
+gsl_filter_median(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vector * y,
+                  gsl_filter_median_workspace * w)
+{
+  return gsl_movstat_median((gsl_movstat_end_t) endtype, x, y, w->movstat_workspace_p);
+}
@@ -0,0 +1,229 @@
+/* filter/rmedian.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module applies the recursive median filter
+ *
+ * y_i = median { y_{i-H}, ..., y_{i-1}, x_i, ..., x_{i+H} }
+ *
+ * in which the left half of each window holds outputs of the filter
+ * rather than inputs. A single pass of the recursive filter yields a
+ * root of the standard median filter, a signal which the median filter
+ * leaves unchanged, which the standard filter may need many passes to
+ * reach.
+ *
+ * Since the sample replaced by each output is not the oldest one in the
+ * window, the window is kept as a sorted array instead of a moving
+ * statistics accumulator. Moving to the next output replaces x_i by y_i
+ * and y_{i-H} by x_{i+H+1}; each replacement locates both values by
+ * binary search and shifts the samples between them, which takes
+ * O(log K) comparisons and moves at most K contiguous doubles.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_filter.h>
+
+/* number of samples in s[0..k-1] less than x */
+static size_t
+rmedian_lower(const double * s, const size_t k, const double x)
+{
+  size_t lo = 0, hi = k;
+
+  while (lo < hi)
+    {
+      const size_t mid = lo + (hi - lo) / 2;
+
+      if (s[mid] < x)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo;
+}
+
+static void
+rmedian_insert(double * s, const size_t k, const double x)
+{
+  const size_t j = rmedian_lower(s, k, x);
+
+  memmove(s + j + 1, s + j, (k - j) * sizeof(double));
+  s[j] = x;
+}
+
+static void
+rmedian_delete(double * s, const size_t k, const double y)
+{
+  const size_t i = rmedian_lower(s, k, y);
+
+  memmove(s + i, s + i + 1, (k - i - 1) * sizeof(double));
+}
+
+/* replace y by x in s[0..k-1] */
+static void
+rmedian_replace(double * s, const size_t k, const double y, const double x)
+{
+  const size_t i = rmedian_lower(s, k, y);
+  size_t j;
+
+  if (x >= y)
+    {
+      j = i + 1 + rmedian_lower(s + i + 1, k - i - 1, x);
+      memmove(s + i, s + i + 1, (j - i - 1) * sizeof(double));
+      s[j - 1] = x;
+    }
+  else
+    {
+      j = rmedian_lower(s, i, x);
+      memmove(s + j + 1, s + j, (i - j) * sizeof(double));
+      s[j] = x;
+    }
+}
+
+/*
+gsl_filter_rmedian_alloc()
+  Allocate a workspace for recursive median filtering with a window of
+K samples. If K is even it is rounded up to the next odd number.
+*/
+
+gsl_filter_rmedian_workspace *
+gsl_filter_rmedian_alloc(const size_t K)
+{
+  gsl_filter_rmedian_workspace *w;
+
+  w = calloc(1, sizeof(gsl_filter_rmedian_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->H = K / 2;
+  w->K = 2 * w->H + 1;
+
+  w->window = malloc(w->K * sizeof(double));
+  if (w->window == 0)
+    {
+      gsl_filter_rmedian_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for window", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_filter_rmedian_free(gsl_filter_rmedian_workspace * w)
+{
+  if (w->window)
+    free(w->window);
+
+  free(w);
+}
+
+/*
+gsl_filter_rmedian()
+  Apply a recursive median filter to an input vector
+
+Inputs: endtype - how to handle the ends of the input; the padding
+                  samples on the left are taken as previous outputs
+        x       - input vector, size n
+        y       - (output) filtered vector, size n; may be the same as x
+        w       - workspace
+*/
+
+int
+gsl_filter_rmedian(const gsl_filter_end_t endtype, const gsl_vector * x, gsl_vector * y,
+                   gsl_filter_rmedian_workspace * w)
+{
+  const size_t n = x->size;
+
+  if (n != y->size)
+    {
+      GSL_ERROR ("input and output vectors must have same length", GSL_EBADLEN);
+    }
+  else if (n == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const size_t H = w->H;
+      const int pad = (endtype != GSL_FILTER_END_TRUNCATE);
+      double *s = w->window;
+      double xleft = 0.0, xright = 0.0;
+      size_t i, k = 0;
+
+      if (endtype == GSL_FILTER_END_PADVALUE)
+        {
+          xleft = gsl_vector_get(x, 0);
+          xright = gsl_vector_get(x, n - 1);
+        }
+
+      /* window of y_0 */
+      if (pad)
+        {
+          for (i = 0; i < H; ++i)
+            rmedian_insert(s, k++, xleft);
+        }
+
+      for (i = 0; i <= H; ++i)
+        {
+          if (i < n)
+            rmedian_insert(s, k++, gsl_vector_get(x, i));
+          else if (pad)
+            rmedian_insert(s, k++, xright);
+        }
+
+      for (i = 0; i < n; ++i)
+        {
+          const double xi = gsl_vector_get(x, i);
+          const double yi = (k % 2) ? s[k / 2] : 0.5 * (s[k / 2 - 1] + s[k / 2]);
+          int have_old = 1, have_new = 1;
+          double yold = xleft, xnew = xright;
+
+          gsl_vector_set(y, i, yi);
+
+          /* window of y_{i+1}: replace x_i by y_i and y_{i-H} by x_{i+H+1} */
+          rmedian_replace(s, k, xi, yi);
+
+          if (i >= H)
+            yold = gsl_vector_get(y, i - H);
+          else
+            have_old = pad;
+
+          if (i + H + 1 < n)
+            xnew = gsl_vector_get(x, i + H + 1);
+          else
+            have_new = pad;
+
+          if (have_old && have_new)
+            rmedian_replace(s, k, yold, xnew);
+          else if (have_old)
+            rmedian_delete(s, k--, yold);
+          else if (have_new)
+            rmedian_insert(s, k++, xnew);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
@@ -0,0 +1,404 @@
+/* filter/test.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_statistics_double.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_movstat.h>
+#include <gsl/gsl_filter.h>
+
+static const char *
+end_str(const gsl_filter_end_t endtype)
+{
+  switch (endtype)
+    {
+      case GSL_FILTER_END_PADZERO:
+        return "padzero";
+      case GSL_FILTER_END_PADVALUE:
+        return "padvalue";
+      default:
+        return "truncate";
+    }
+}
+
+static void
+random_vector(gsl_vector * v, gsl_rng * r)
+{
+  size_t i;
+
+  for (i = 0; i < v->size; ++i)
+    gsl_vector_set(v, i, 2.0 * gsl_rng_uniform(r) - 1.0);
+}
+
+/* sample idx of x, with the end handling of endtype; returns 0 if the
+   sample is omitted */
+static int
+get_sample(const gsl_filter_end_t endtype, const gsl_vector * x, const int idx, double * xi)
+{
+  const int n = (int) x->size;
+
+  if (idx >= 0 && idx < n)
+    *xi = gsl_vector_get(x, idx);
+  else if (endtype == GSL_FILTER_END_PADZERO)
+    *xi = 0.0;
+  else if (endtype == GSL_FILTER_END_PADVALUE)
+    *xi = gsl_vector_get(x, (idx < 0) ? 0 : n - 1);
+  else
+    return 0;
+
+  return 1;
+}
+
+/* Gaussian filter by direct summation */
+static void
+slow_gaussian(const gsl_filter_end_t endtype, const double alpha, const size_t order,
+              const size_t K, const gsl_vector * x, gsl_vector * y)
+{
+  const int H = (int) (K / 2);
+  const double sigma = (H > 0) ? H / alpha : 1.0;
+  gsl_vector *kernel = gsl_vector_alloc(2 * H + 1);
+  size_t i;
+  int j;
+
+  gsl_filter_gaussian_kernel(alpha, order, 1, kernel);
+
+  for (i = 0; i < x->size; ++i)
+    {
+      double sum = 0.0, wall = 0.0, win = 0.0, xj;
+
+      for (j = -H; j <= H; ++j)
+        {
+          const double g = exp(-0.5 * (j / sigma) * (j / sigma));
+
+          wall += g;
+
+          if (get_sample(endtype, x, (int) i - j, &xj))
+            {
+              sum += gsl_vector_get(kernel, j + H) * xj;
+              win += g;
+            }
+        }
+
+      gsl_vector_set(y, i, sum * wall / win);
+    }
+
+  gsl_vector_free(kernel);
+}
+
+/* recursive median filter from its definition */
+static void
+slow_rmedian(const gsl_filter_end_t endtype, const size_t K, const gsl_vector * x,
+             gsl_vector * y)
+{
+  const int H = (int) (K / 2);
+  const int n = (int) x->size;
+  double *window = malloc(K * sizeof(double));
+  int i, j;
+
+  for (i = 0; i < n; ++i)
+    {
+      size_t k = 0;
+      double xj;
+
+      for (j = i - H; j <= i + H; ++j)
+        {
+          if (j >= 0 && j < i)
+            window[k++] = gsl_vector_get(y, j);
+          else if (get_sample(endtype, x, j, &xj))
+            window[k++] = xj;
+        }
+
+      gsl_vector_set(y, i, gsl_stats_median(window, 1, k));
+    }
+
+  free(window);
+}
+
+static void
+compare_vectors(const double tol, const gsl_vector * v, const gsl_vector * expected,
+                const char * desc, const size_t K, const gsl_filter_end_t endtype)
+{
+  size_t i;
+
+  for (i = 0; i < v->size; ++i)
+    {
+      gsl_test_rel(gsl_vector_get(v, i), gsl_vector_get(expected, i), tol,
+                   "%s n=%zu K=%zu %s i=%zu", desc, v->size, K, end_str(endtype), i);
+    }
+}
+
+static void
+test_gaussian_kernel(const size_t K, const double alpha)
+{
+  gsl_vector *kernel = gsl_vector_alloc(K);
+  double sum;
+  size_t i;
+
+  gsl_filter_gaussian_kernel(alpha, 0, 1, kernel);
+
+  for (i = 0, sum = 0.0; i < K; ++i)
+    sum += gsl_vector_get(kernel, i);
+
+  gsl_test_rel(sum, 1.0, 1.0e-12, "gaussian kernel sum K=%zu alpha=%g", K, alpha);
+
+  /* odd derivatives are antisymmetric */
+  gsl_filter_gaussian_kernel(alpha, 1, 1, kernel);
+
+  for (i = 0, sum = 0.0; i < K; ++i)
+    sum += gsl_vector_get(kernel, i);
+
+  gsl_test_abs(sum, 0.0, 1.0e-12, "gaussian derivative kernel sum K=%zu alpha=%g", K, alpha);
+
+  gsl_vector_free(kernel);
+}
+
+static void
+test_gaussian(const size_t n, const size_t K, const double alpha, const size_t order,
+              const gsl_filter_end_t endtype, gsl_rng * r)
+{
+  gsl_filter_gaussian_workspace *w = gsl_filter_gaussian_alloc(K);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *expected = gsl_vector_alloc(n);
+  size_t i;
+
+  random_vector(x, r);
+
+  gsl_filter_gaussian(endtype, alpha, order, x, y, w);
+  slow_gaussian(endtype, alpha, order, K, x, expected);
+
+  for (i = 0; i < n; ++i)
+    {
+      gsl_test_abs(gsl_vector_get(y, i), gsl_vector_get(expected, i), 1.0e-10,
+                   "gaussian order=%zu n=%zu K=%zu %s i=%zu",
+                   order, n, K, end_str(endtype), i);
+    }
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(expected);
+  gsl_filter_gaussian_free(w);
+}
+
+/* the first derivative of a smoothed ramp is close to its slope */
+static void
+test_gaussian_deriv(void)
+{
+  const size_t n = 200;
+  const size_t K = 61;
+  const double alpha = 5.0;
+  gsl_filter_gaussian_workspace *w = gsl_filter_gaussian_alloc(K);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    gsl_vector_set(x, i, 0.5 * i);
+
+  gsl_filter_gaussian(GSL_FILTER_END_PADVALUE, alpha, 1, x, y, w);
+
+  for (i = K; i < n - K; ++i)
+    gsl_test_rel(gsl_vector_get(y, i), 0.5, 1.0e-4, "gaussian derivative of ramp i=%zu", i);
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_filter_gaussian_free(w);
+}
+
+static void
+test_median(const size_t n, const size_t K, const gsl_filter_end_t endtype, gsl_rng * r)
+{
+  gsl_filter_median_workspace *w = gsl_filter_median_alloc(K);
+  gsl_filter_rmedian_workspace *rw = gsl_filter_rmedian_alloc(K);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *expected = gsl_vector_alloc(n);
+  double *window = malloc(K * sizeof(double));
+  size_t i;
+
+  random_vector(x, r);
+
+  gsl_filter_median(endtype, x, y, w);
+
+  for (i = 0; i < n; ++i)
+    {
+      const size_t k = gsl_movstat_fill((gsl_movstat_end_t) endtype, x, i, K / 2, K / 2, window);
+      gsl_vector_set(expected, i, gsl_stats_median(window, 1, k));
+    }
+
+  compare_vectors(GSL_DBL_EPSILON, y, expected, "median", K, endtype);
+
+  gsl_filter_rmedian(endtype, x, y, rw);
+  slow_rmedian(endtype, K, x, expected);
+  compare_vectors(GSL_DBL_EPSILON, y, expected, "rmedian", K, endtype);
+
+  /* in-place */
+  gsl_filter_rmedian(endtype, x, x, rw);
+  compare_vectors(GSL_DBL_EPSILON, x, expected, "rmedian in-place", K, endtype);
+
+  free(window);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(expected);
+  gsl_filter_median_free(w);
+  gsl_filter_rmedian_free(rw);
+}
+
+static void
+test_impulse(const size_t n, const size_t K, const gsl_filter_scale_t scale_type,
+             const gsl_filter_end_t endtype, gsl_rng * r)
+{
+  const double t = 3.0;
+  const size_t H = K / 2;
+  gsl_filter_impulse_workspace *w = gsl_filter_impulse_alloc(K);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *xmedian = gsl_vector_alloc(n);
+  gsl_vector *xsigma = gsl_vector_alloc(n);
+  gsl_vector_int *ioutlier = gsl_vector_int_alloc(n);
+  gsl_vector_int *spike = gsl_vector_int_calloc(n);
+  double *window = malloc(K * sizeof(double));
+  size_t noutlier, nexpected = 0, i;
+
+  random_vector(x, r);
+
+  /* isolated spikes, away from the ends */
+  for (i = K; i + K < n; i += K)
+    {
+      gsl_vector_set(x, i, 100.0);
+      gsl_vector_int_set(spike, i, 1);
+    }
+
+  gsl_filter_impulse(endtype, scale_type, t, x, y, xmedian, xsigma, &noutlier, ioutlier, w);
+
+  for (i = 0; i < n; ++i)
+    {
+      const size_t k = gsl_movstat_fill((gsl_movstat_end_t) endtype, x, i, H, H, window);
+      const double xi = gsl_vector_get(x, i);
+      double median, sigma;
+      int outlier;
+
+      if (scale_type == GSL_FILTER_SCALE_MAD)
+        {
+          size_t j;
+
+          median = gsl_stats_median(window, 1, k);
+
+          for (j = 0; j < k; ++j)
+            window[j] = fabs(window[j] - median);
+
+          sigma = 1.482602218505602 * gsl_stats_median(window, 1, k);
+        }
+      else
+        {
+          median = gsl_stats_median(window, 1, k);
+          sigma = 0.741301109252801 * (gsl_stats_quantile(window, 1, k, 0.75) -
+                                       gsl_stats_quantile(window, 1, k, 0.25));
+        }
+
+      outlier = (fabs(xi - median) > t * sigma);
+      nexpected += outlier;
+
+      gsl_test_rel(gsl_vector_get(xmedian, i), median, GSL_DBL_EPSILON,
+                   "impulse median K=%zu %s i=%zu", K, end_str(endtype), i);
+      gsl_test_rel(gsl_vector_get(xsigma, i), sigma, 1.0e-12,
+                   "impulse sigma K=%zu %s i=%zu", K, end_str(endtype), i);
+      gsl_test_int(gsl_vector_int_get(ioutlier, i), outlier,
+                   "impulse ioutlier K=%zu %s i=%zu", K, end_str(endtype), i);
+      gsl_test_rel(gsl_vector_get(y, i), outlier ? median : xi, GSL_DBL_EPSILON,
+                   "impulse y K=%zu %s i=%zu", K, end_str(endtype), i);
+
+      if (gsl_vector_int_get(spike, i))
+        gsl_test_int(outlier, 1, "impulse spike detected K=%zu %s i=%zu", K, end_str(endtype), i);
+    }
+
+  gsl_test_int((int) noutlier, (int) nexpected, "impulse noutlier K=%zu %s", K, end_str(endtype));
+
+  /* in-place */
+  gsl_vector_memcpy(xsigma, y);
+  gsl_filter_impulse(endtype, scale_type, t, x, x, xmedian, y, &noutlier, NULL, w);
+
+  for (i = 0; i < n; ++i)
+    {
+      gsl_test_rel(gsl_vector_get(x, i), gsl_vector_get(xsigma, i), GSL_DBL_EPSILON,
+                   "impulse in-place K=%zu %s i=%zu", K, end_str(endtype), i);
+    }
+
+  free(window);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(xmedian);
+  gsl_vector_free(xsigma);
+  gsl_vector_int_free(ioutlier);
+  gsl_vector_int_free(spike);
+  gsl_filter_impulse_free(w);
+}
+
+int
+main()
+{
+  const gsl_filter_end_t endtypes[] = { GSL_FILTER_END_PADZERO,
+                                        GSL_FILTER_END_PADVALUE,
+                                        GSL_FILTER_END_TRUNCATE };
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  size_t i, order;
+
+  gsl_ieee_env_setup();
+
+  test_gaussian_kernel(1, 1.0);
+  test_gaussian_kernel(5, 2.0);
+  test_gaussian_kernel(51, 3.0);
+  test_gaussian_kernel(400, 10.0);
+
+  test_gaussian_deriv();
+
+  for (i = 0; i < 3; ++i)
+    {
+      for (order = 0; order <= 3; ++order)
+        {
+          test_gaussian(1, 1, 1.0, order, endtypes[i], r);
+          test_gaussian(10, 5, 2.0, order, endtypes[i], r);
+          test_gaussian(10, 31, 3.0, order, endtypes[i], r);
+          test_gaussian(100, 11, 3.0, order, endtypes[i], r);
+          test_gaussian(2000, 201, 4.0, order, endtypes[i], r);
+        }
+
+      test_median(1, 1, endtypes[i], r);
+      test_median(10, 3, endtypes[i], r);
+      test_median(10, 25, endtypes[i], r);
+      test_median(100, 7, endtypes[i], r);
+      test_median(1000, 51, endtypes[i], r);
+
+      test_impulse(100, 5, GSL_FILTER_SCALE_MAD, endtypes[i], r);
+      test_impulse(1000, 21, GSL_FILTER_SCALE_MAD, endtypes[i], r);
+      test_impulse(100, 7, GSL_FILTER_SCALE_IQR, endtypes[i], r);
+      test_impulse(1000, 31, GSL_FILTER_SCALE_IQR, endtypes[i], r);
+    }
+
+  gsl_rng_free(r);
+
+  exit (gsl_test_summary());
+}
@@ -1,6 +1,7 @@
 /* histogram/add.c
  * 
  * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
+ * Copyright (C) 2026 The GSL Team
  * 
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -18,6 +19,7 @@
  */
 
 #include <config.h>
+#include <math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 
@@ -53,3 +55,89 @@ gsl_histogram_accumulate (gsl_histogram * h, double x, double weight)
 
   return GSL_SUCCESS;
 }
+
+/* Check whether the ranges are close enough to uniform that the index
+   (x - range[0]) / dx is always within one of the bin containing x:
+   each range[i] must lie within dx/4 of range[0] + i dx. */
+
+static int
+uniform_bins (const size_t n, const double range[])
+{
+  const double dx = (range[n] - range[0]) / n;
+  size_t i;
+
+  for (i = 1; i < n; i++)
+    {
+      if (fabs (range[i] - (range[0] + i * dx)) > 0.25 * dx)
+        {
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+int
+gsl_histogram_accumulate_array (gsl_histogram * h,
+                                const double x[], const size_t xstride,
+                                const double w[], const size_t wstride,
+                                const size_t n)
+{
+  const size_t nbins = h->n;
+  const double *range = h->range;
+  double *bin = h->bin;
+  size_t nout = 0;
+  size_t i;
+
+  if (uniform_bins (nbins, range))
+    {
+      /* compute the bin by a multiplication, then move it by at most
+         one bin so that range[k] <= x < range[k+1] exactly, as in
+         find() */
+
+      const double xmin = range[0];
+      const double xmax = range[nbins];
+      const double scale = nbins / (xmax - xmin);
+
+      for (i = 0; i < n; i++)
+        {
+          const double xi = x[i * xstride];
+          size_t k;
+
+          if (!(xi >= xmin && xi < xmax))
+            {
+              nout++;
+              continue;
+            }
+
+          k = (size_t) ((xi - xmin) * scale);
+
+          if (k >= nbins)
+            k = nbins - 1;
+
+          if (xi < range[k])
+            k--;
+          else if (xi >= range[k + 1])
+            k++;
+
+          bin[k] += (w != NULL) ? w[i * wstride] : 1.0;
+        }
+    }
+  else
+    {
+      for (i = 0; i < n; i++)
+        {
+          const double xi = x[i * xstride];
+          size_t k = 0;
+
+          if (!(xi >= range[0] && xi < range[nbins]))
+            nout++;
+          else if (find (nbins, range, xi, &k))
+            nout++;
+          else
+            bin[k] += (w != NULL) ? w[i * wstride] : 1.0;
+        }
+    }
+
+  return (nout > 0) ? GSL_EDOM : GSL_SUCCESS;
+}
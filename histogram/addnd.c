@@ -0,0 +1,72 @@
+/* histogram/addnd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "find.c"
+#include "binnd.c"
+
+int
+gsl_histogramnd_increment (gsl_histogramnd * h, const double x[])
+{
+  int status = gsl_histogramnd_accumulate (h, x, 1.0);
+  return status;
+}
+
+int
+gsl_histogramnd_accumulate (gsl_histogramnd * h, const double x[],
+                            const double weight)
+{
+  size_t d, key = 0;
+  double *b;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      const size_t n = h->n[d];
+      const double *range = h->range[d];
+      size_t i = 0;
+
+      /* NaNs lie outside every range */
+      if (!(x[d] >= range[0] && x[d] < range[n]))
+        {
+          return GSL_EDOM;
+        }
+
+      if (find (n, range, x[d], &i))
+        {
+          return GSL_EDOM;
+        }
+
+      key = key * n + i;
+    }
+
+  b = bin_ref (h, key);
+
+  if (b == 0)
+    {
+      GSL_ERROR ("failed to store histogramnd bin", GSL_ENOMEM);
+    }
+
+  *b += weight;
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,230 @@
+/* histogram/binnd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Storage of the bins of an N-dimensional histogram.  Each bin is
+   identified by its key, the row-major index of its multi-index as in
+   gsl_histogram2d.  Dense histograms store every bin in bin[key].
+   Sparse histograms store only the bins which have been updated, in
+   an open addressing hash table with linear probing: slot s holds the
+   bin key[s] with value bin[s], and empty slots have key[s] = nbins,
+   which is not a valid key.  Bins are never removed except by
+   gsl_histogramnd_reset, so no deleted markers are needed. */
+
+static inline size_t
+key_from_index (const gsl_histogramnd * h, const size_t idx[])
+{
+  size_t d, key = 0;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      key = key * h->n[d] + idx[d];
+    }
+
+  return key;
+}
+
+static inline void
+index_from_key (const gsl_histogramnd * h, size_t key, size_t idx[])
+{
+  size_t d = h->ndim;
+
+  while (d-- > 0)
+    {
+      idx[d] = key % h->n[d];
+      key /= h->n[d];
+    }
+}
+
+/* first slot to probe for a key; the bits of the key are mixed so
+   that keys differing only in their high bits, e.g. in the first
+   dimension, are spread over the table */
+static inline size_t
+hash_slot (const size_t key, const size_t mask)
+{
+  size_t k = key;
+
+  k ^= (k >> 16) >> 16;         /* the high half when size_t has 64 bits */
+  k ^= k >> 16;
+  k *= 0x45d9f3bUL;
+  k ^= k >> 16;
+  k *= 0x45d9f3bUL;
+  k ^= k >> 16;
+
+  return k & mask;
+}
+
+/* value of the bin with the given key, zero if it is not stored */
+static inline double
+bin_value (const gsl_histogramnd * h, const size_t key)
+{
+  if (h->type == GSL_HISTOGRAMND_DENSE)
+    {
+      return h->bin[key];
+    }
+  else
+    {
+      const size_t mask = h->tsize - 1;
+      size_t s = hash_slot (key, mask);
+
+      while (h->key[s] != h->nbins)
+        {
+          if (h->key[s] == key)
+            {
+              return h->bin[s];
+            }
+
+          s = (s + 1) & mask;
+        }
+
+      return 0.0;
+    }
+}
+
+/* double the size of the hash table, reinserting the stored bins */
+static inline int
+hash_grow (gsl_histogramnd * h)
+{
+  const size_t tsize = 2 * h->tsize;
+  const size_t mask = tsize - 1;
+  size_t *key;
+  double *bin;
+  size_t i;
+
+  key = (size_t *) malloc (tsize * sizeof (size_t));
+
+  if (key == 0)
+    {
+      GSL_ERROR ("failed to allocate space for histogram keys", GSL_ENOMEM);
+    }
+
+  bin = (double *) malloc (tsize * sizeof (double));
+
+  if (bin == 0)
+    {
+      free (key);
+      GSL_ERROR ("failed to allocate space for histogram bins", GSL_ENOMEM);
+    }
+
+  for (i = 0; i < tsize; i++)
+    {
+      key[i] = h->nbins;
+    }
+
+  for (i = 0; i < h->tsize; i++)
+    {
+      if (h->key[i] != h->nbins)
+        {
+          size_t s = hash_slot (h->key[i], mask);
+
+          while (key[s] != h->nbins)
+            {
+              s = (s + 1) & mask;
+            }
+
+          key[s] = h->key[i];
+          bin[s] = h->bin[i];
+        }
+    }
+
+  free (h->key);
+  free (h->bin);
+
+  h->key = key;
+  h->bin = bin;
+  h->tsize = tsize;
+
+  return GSL_SUCCESS;
+}
+
+/* pointer to the value of the bin with the given key, storing it with
+   a value of zero if necessary; returns 0 if the table cannot grow.
+   The table is kept at most half full, so probe sequences stay short,
+   and it only grows when a new bin is stored. */
+static inline double *
+bin_ref (gsl_histogramnd * h, const size_t key)
+{
+  size_t mask, s;
+
+  if (h->type == GSL_HISTOGRAMND_DENSE)
+    {
+      return h->bin + key;
+    }
+
+  mask = h->tsize - 1;
+  s = hash_slot (key, mask);
+
+  while (h->key[s] != h->nbins)
+    {
+      if (h->key[s] == key)
+        {
+          return h->bin + s;
+        }
+
+      s = (s + 1) & mask;
+    }
+
+  if (2 * (h->nz + 1) > h->tsize)
+    {
+      if (hash_grow (h))
+        {
+          return 0;
+        }
+
+      mask = h->tsize - 1;
+      s = hash_slot (key, mask);
+
+      while (h->key[s] != h->nbins)
+        {
+          s = (s + 1) & mask;
+        }
+    }
+
+  h->key[s] = key;
+  h->bin[s] = 0.0;
+  h->nz++;
+
+  return h->bin + s;
+}
+
+/* find the next stored bin with a non-zero value at or after position
+   *pos, which is a key for dense histograms and a slot for sparse
+   ones; returns 0 if there are no more */
+static inline int
+bin_next (const gsl_histogramnd * h, size_t * pos, size_t * key,
+          double * value)
+{
+  const int dense = (h->type == GSL_HISTOGRAMND_DENSE);
+  const size_t end = dense ? h->nbins : h->tsize;
+  size_t s;
+
+  for (s = *pos; s < end; s++)
+    {
+      if ((dense || h->key[s] != h->nbins) && h->bin[s] != 0.0)
+        {
+          *key = dense ? s : h->key[s];
+          *value = h->bin[s];
+          *pos = s + 1;
+          return 1;
+        }
+    }
+
+  *pos = end;
+
+  return 0;
+}
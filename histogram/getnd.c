@@ -0,0 +1,130 @@
+/* histogram/getnd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "find.c"
+#include "binnd.c"
+
+double
+gsl_histogramnd_get (const gsl_histogramnd * h, const size_t idx[])
+{
+  size_t d;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      if (idx[d] >= h->n[d])
+        {
+          GSL_ERROR_VAL ("index lies outside valid range of 0 .. n[d] - 1",
+                            GSL_EDOM, 0);
+        }
+    }
+
+  return bin_value (h, key_from_index (h, idx));
+}
+
+int
+gsl_histogramnd_get_range (const gsl_histogramnd * h, const size_t d,
+                           const size_t i, double *lower, double *upper)
+{
+  if (d >= h->ndim)
+    {
+      GSL_ERROR ("dimension d lies outside valid range 0 .. ndim - 1",
+                 GSL_EDOM);
+    }
+
+  if (i >= h->n[d])
+    {
+      GSL_ERROR ("index i lies outside valid range of 0 .. n[d] - 1",
+                 GSL_EDOM);
+    }
+
+  *lower = h->range[d][i];
+  *upper = h->range[d][i + 1];
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_find (const gsl_histogramnd * h, const double x[],
+                      size_t idx[])
+{
+  size_t d;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      const size_t n = h->n[d];
+      const double *range = h->range[d];
+
+      if (!(x[d] >= range[0] && x[d] < range[n])
+          || find (n, range, x[d], &idx[d]))
+        {
+          GSL_ERROR ("x not found in range of h", GSL_EDOM);
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_next (const gsl_histogramnd * h, size_t * pos,
+                      size_t idx[], double *value)
+{
+  size_t key;
+
+  if (!bin_next (h, pos, &key, value))
+    {
+      return GSL_FAILURE;
+    }
+
+  index_from_key (h, key, idx);
+
+  return GSL_SUCCESS;
+}
+
+size_t
+gsl_histogramnd_nnz (const gsl_histogramnd * h)
+{
+  size_t pos = 0, key, nnz = 0;
+  double value;
+
+  while (bin_next (h, &pos, &key, &value))
+    {
+      nnz++;
+    }
+
+  return nnz;
+}
+
+double
+gsl_histogramnd_sum (const gsl_histogramnd * h)
+{
+  size_t pos = 0, key;
+  double value, sum = 0;
+
+  while (bin_next (h, &pos, &key, &value))
+    {
+      sum += value;
+    }
+
+  return sum;
+}
@@ -1,6 +1,7 @@
 /* histogram/gsl_histogram.h
  * 
  * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
+ * Copyright (C) 2026 The GSL Team
  * 
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -54,6 +55,10 @@ gsl_histogram * gsl_histogram_calloc_uniform (const size_t n, const double xmin,
 void gsl_histogram_free (gsl_histogram * h);
 int gsl_histogram_increment (gsl_histogram * h, double x);
 int gsl_histogram_accumulate (gsl_histogram * h, double x, double weight);
+int gsl_histogram_accumulate_array (gsl_histogram * h,
+                                    const double x[], const size_t xstride,
+                                    const double w[], const size_t wstride,
+                                    const size_t n);
 int gsl_histogram_find (const gsl_histogram * h, 
                         const double x, size_t * i);
 
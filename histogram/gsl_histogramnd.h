@@ -0,0 +1,104 @@
+/* histogram/gsl_histogramnd.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_HISTOGRAMND_H__
+#define __GSL_HISTOGRAMND_H__
+
+#include <stdlib.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef struct {
+  size_t ndim ;       /* number of dimensions */
+  size_t * n ;        /* number of bins in each dimension */
+  double ** range ;   /* range[d] holds the n[d] + 1 limits of dimension d */
+  size_t nbins ;      /* total number of bins, n[0] * ... * n[ndim-1] */
+  size_t type ;       /* storage type */
+  double * bin ;      /* bin values, dense: nbins, sparse: tsize */
+  size_t * key ;      /* sparse: bin index of each slot, nbins if empty */
+  size_t tsize ;      /* sparse: number of slots, a power of 2 */
+  size_t nz ;         /* sparse: number of occupied slots */
+} gsl_histogramnd ;
+
+#define GSL_HISTOGRAMND_DENSE     (0)
+#define GSL_HISTOGRAMND_SPARSE    (1)
+
+typedef struct {
+  size_t ndim ;
+  size_t * n ;
+  double ** range ;
+  size_t nsum ;       /* number of bins with non-zero probability */
+  size_t * key ;      /* bin index of each of them, in increasing order */
+  double * sum ;      /* cumulative probabilities, nsum + 1 elements */
+} gsl_histogramnd_pdf ;
+
+gsl_histogramnd * gsl_histogramnd_alloc (const size_t ndim, const size_t n[],
+                                         const size_t type);
+void gsl_histogramnd_free (gsl_histogramnd * h);
+
+int gsl_histogramnd_set_ranges_uniform (gsl_histogramnd * h,
+                                        const double xmin[],
+                                        const double xmax[]);
+int gsl_histogramnd_set_ranges (gsl_histogramnd * h, const size_t d,
+                                const double range[], const size_t size);
+void gsl_histogramnd_reset (gsl_histogramnd * h);
+
+int gsl_histogramnd_increment (gsl_histogramnd * h, const double x[]);
+int gsl_histogramnd_accumulate (gsl_histogramnd * h, const double x[],
+                                const double weight);
+int gsl_histogramnd_find (const gsl_histogramnd * h, const double x[],
+                          size_t idx[]);
+
+double gsl_histogramnd_get (const gsl_histogramnd * h, const size_t idx[]);
+int gsl_histogramnd_get_range (const gsl_histogramnd * h, const size_t d,
+                               const size_t i,
+                               double * lower, double * upper);
+int gsl_histogramnd_next (const gsl_histogramnd * h, size_t * pos,
+                          size_t idx[], double * value);
+size_t gsl_histogramnd_nnz (const gsl_histogramnd * h);
+double gsl_histogramnd_sum (const gsl_histogramnd * h);
+
+int gsl_histogramnd_equal_bins_p (const gsl_histogramnd * h1,
+                                  const gsl_histogramnd * h2);
+int gsl_histogramnd_add (gsl_histogramnd * h1, const gsl_histogramnd * h2);
+int gsl_histogramnd_scale (gsl_histogramnd * h, const double scale);
+int gsl_histogramnd_project (gsl_histogramnd * hp, const gsl_histogramnd * h,
+                             const size_t dims[]);
+
+gsl_histogramnd_pdf * gsl_histogramnd_pdf_alloc (const size_t ndim,
+                                                 const size_t n[]);
+int gsl_histogramnd_pdf_init (gsl_histogramnd_pdf * p,
+                              const gsl_histogramnd * h);
+void gsl_histogramnd_pdf_free (gsl_histogramnd_pdf * p);
+int gsl_histogramnd_pdf_sample (const gsl_histogramnd_pdf * p,
+                                const double r[], double x[]);
+
+__END_DECLS
+
+#endif /* __GSL_HISTOGRAMND_H__ */
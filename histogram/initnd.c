@@ -0,0 +1,238 @@
+/* histogram/initnd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+/* initial number of slots of the hash table of a sparse histogram */
+#define HISTOGRAMND_TSIZE 64
+
+gsl_histogramnd *
+gsl_histogramnd_alloc (const size_t ndim, const size_t n[], const size_t type)
+{
+  const size_t limit = (size_t) -1;
+  gsl_histogramnd *h;
+  size_t nbins = 1, nrange = 0;
+  size_t d, i;
+
+  if (ndim == 0)
+    {
+      GSL_ERROR_VAL ("histogramnd dimension must be positive integer",
+                        GSL_EDOM, 0);
+    }
+
+  if (type != GSL_HISTOGRAMND_DENSE && type != GSL_HISTOGRAMND_SPARSE)
+    {
+      GSL_ERROR_VAL ("unknown histogramnd storage type", GSL_EINVAL, 0);
+    }
+
+  for (d = 0; d < ndim; d++)
+    {
+      if (n[d] == 0)
+        {
+          GSL_ERROR_VAL ("histogramnd lengths must be positive integers",
+                            GSL_EDOM, 0);
+        }
+
+      /* the key nbins marks empty slots, so it must be representable */
+      if (nbins > (limit - 1) / n[d])
+        {
+          GSL_ERROR_VAL ("total number of histogramnd bins is too large",
+                            GSL_EINVAL, 0);
+        }
+
+      nbins *= n[d];
+      nrange += n[d] + 1;
+    }
+
+  if (type == GSL_HISTOGRAMND_DENSE && nbins > limit / sizeof (double))
+    {
+      GSL_ERROR_VAL ("too many bins for dense storage, use sparse storage",
+                        GSL_EINVAL, 0);
+    }
+
+  h = (gsl_histogramnd *) calloc (1, sizeof (gsl_histogramnd));
+
+  if (h == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogramnd struct",
+                        GSL_ENOMEM, 0);
+    }
+
+  h->n = (size_t *) malloc (ndim * sizeof (size_t));
+  h->range = (double **) malloc (ndim * sizeof (double *));
+
+  if (h->n == 0 || h->range == 0)
+    {
+      free (h->n);
+      free (h->range);
+      free (h);         /* exception in constructor, avoid memory leak */
+      GSL_ERROR_VAL ("failed to allocate space for histogramnd lengths",
+                        GSL_ENOMEM, 0);
+    }
+
+  /* the ranges of all dimensions are stored in a single block */
+
+  h->range[0] = (double *) malloc (nrange * sizeof (double));
+
+  if (h->range[0] == 0)
+    {
+      free (h->n);
+      free (h->range);
+      free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogramnd ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+  for (d = 0; d < ndim; d++)
+    {
+      if (d > 0)
+        {
+          h->range[d] = h->range[d - 1] + n[d - 1] + 1;
+        }
+
+      h->n[d] = n[d];
+
+      for (i = 0; i <= n[d]; i++)
+        {
+          h->range[d][i] = i;
+        }
+    }
+
+  h->ndim = ndim;
+  h->nbins = nbins;
+  h->type = type;
+
+  if (type == GSL_HISTOGRAMND_DENSE)
+    {
+      h->bin = (double *) malloc (nbins * sizeof (double));
+    }
+  else
+    {
+      h->tsize = HISTOGRAMND_TSIZE;
+      h->bin = (double *) malloc (h->tsize * sizeof (double));
+      h->key = (size_t *) malloc (h->tsize * sizeof (size_t));
+    }
+
+  if (h->bin == 0 || (type == GSL_HISTOGRAMND_SPARSE && h->key == 0))
+    {
+      gsl_histogramnd_free (h);
+      GSL_ERROR_VAL ("failed to allocate space for histogramnd bins",
+                        GSL_ENOMEM, 0);
+    }
+
+  gsl_histogramnd_reset (h);
+
+  return h;
+}
+
+void
+gsl_histogramnd_free (gsl_histogramnd * h)
+{
+  RETURN_IF_NULL (h);
+  free (h->range[0]);
+  free (h->range);
+  free (h->n);
+  free (h->bin);
+  free (h->key);
+  free (h);
+}
+
+void
+gsl_histogramnd_reset (gsl_histogramnd * h)
+{
+  size_t i;
+
+  if (h->type == GSL_HISTOGRAMND_DENSE)
+    {
+      for (i = 0; i < h->nbins; i++)
+        {
+          h->bin[i] = 0;
+        }
+    }
+  else
+    {
+      for (i = 0; i < h->tsize; i++)
+        {
+          h->key[i] = h->nbins;
+        }
+
+      h->nz = 0;
+    }
+}
+
+int
+gsl_histogramnd_set_ranges_uniform (gsl_histogramnd * h,
+                                    const double xmin[], const double xmax[])
+{
+  size_t d, i;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      if (xmin[d] >= xmax[d])
+        {
+          GSL_ERROR ("xmin must be less than xmax", GSL_EINVAL);
+        }
+    }
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      const size_t n = h->n[d];
+
+      for (i = 0; i <= n; i++)
+        {
+          double f1 = ((double) (n-i) / (double) n);
+          double f2 = ((double) i / (double) n);
+          h->range[d][i] = f1 * xmin[d] +  f2 * xmax[d];
+        }
+    }
+
+  gsl_histogramnd_reset (h);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_set_ranges (gsl_histogramnd * h, const size_t d,
+                            const double range[], const size_t size)
+{
+  size_t i;
+
+  if (d >= h->ndim)
+    {
+      GSL_ERROR ("dimension d lies outside valid range 0 .. ndim - 1",
+                 GSL_EDOM);
+    }
+
+  if (size != (h->n[d] + 1))
+    {
+      GSL_ERROR ("size of range must match size of histogram", GSL_EINVAL);
+    }
+
+  for (i = 0; i <= h->n[d]; i++)
+    {
+      h->range[d][i] = range[i];
+    }
+
+  gsl_histogramnd_reset (h);
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,197 @@
+/* histogram/opernd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "binnd.c"
+
+/* check whether dimension d1 of h1 and dimension d2 of h2 have the
+   same bins */
+static int
+equal_dim_bins (const gsl_histogramnd * h1, const size_t d1,
+                const gsl_histogramnd * h2, const size_t d2)
+{
+  size_t i;
+
+  if (h1->n[d1] != h2->n[d2])
+    {
+      return 0;
+    }
+
+  for (i = 0; i <= h1->n[d1]; i++)
+    {
+      if (h1->range[d1][i] != h2->range[d2][i])
+        {
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+int
+gsl_histogramnd_equal_bins_p (const gsl_histogramnd * h1,
+                              const gsl_histogramnd * h2)
+{
+  size_t d;
+
+  if (h1->ndim != h2->ndim)
+    {
+      return 0;
+    }
+
+  for (d = 0; d < h1->ndim; d++)
+    {
+      if (!equal_dim_bins (h1, d, h2, d))
+        {
+          return 0;
+        }
+    }
+
+  return 1;
+}
+
+/* The histograms may use different storage types, e.g. sparse
+   histograms filled by separate threads can be added to a dense
+   one. */
+
+int
+gsl_histogramnd_add (gsl_histogramnd * h1, const gsl_histogramnd * h2)
+{
+  size_t pos = 0, key;
+  double value;
+
+  if (!gsl_histogramnd_equal_bins_p (h1, h2))
+    {
+      GSL_ERROR ("histograms have different binning", GSL_EINVAL);
+    }
+
+  while (bin_next (h2, &pos, &key, &value))
+    {
+      double *b = bin_ref (h1, key);
+
+      if (b == 0)
+        {
+          GSL_ERROR ("failed to store histogramnd bin", GSL_ENOMEM);
+        }
+
+      *b += value;
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_scale (gsl_histogramnd * h, const double scale)
+{
+  const int dense = (h->type == GSL_HISTOGRAMND_DENSE);
+  const size_t end = dense ? h->nbins : h->tsize;
+  size_t i;
+
+  for (i = 0; i < end; i++)
+    {
+      if (dense || h->key[i] != h->nbins)
+        {
+          h->bin[i] *= scale;
+        }
+    }
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_histogramnd_project (gsl_histogramnd * hp, const gsl_histogramnd * h,
+                         const size_t dims[])
+{
+  size_t *idx;
+  size_t pos = 0, key, k, j;
+  double value;
+
+  if (hp == h)
+    {
+      GSL_ERROR ("projection must be distinct from the histogram",
+                 GSL_EINVAL);
+    }
+
+  for (k = 0; k < hp->ndim; k++)
+    {
+      if (dims[k] >= h->ndim)
+        {
+          GSL_ERROR ("dimension lies outside valid range 0 .. ndim - 1",
+                     GSL_EDOM);
+        }
+
+      for (j = 0; j < k; j++)
+        {
+          if (dims[j] == dims[k])
+            {
+              GSL_ERROR ("projected dimensions must be distinct",
+                         GSL_EINVAL);
+            }
+        }
+
+      if (!equal_dim_bins (hp, k, h, dims[k]))
+        {
+          GSL_ERROR ("projection must have the bins of the projected "
+                     "dimensions", GSL_EINVAL);
+        }
+    }
+
+  idx = (size_t *) malloc (h->ndim * sizeof (size_t));
+
+  if (idx == 0)
+    {
+      GSL_ERROR ("failed to allocate space for index", GSL_ENOMEM);
+    }
+
+  gsl_histogramnd_reset (hp);
+
+  /* sum each stored bin into the bin of hp with the same indices in
+     the projected dimensions */
+
+  while (bin_next (h, &pos, &key, &value))
+    {
+      size_t keyp = 0;
+      double *b;
+
+      index_from_key (h, key, idx);
+
+      for (k = 0; k < hp->ndim; k++)
+        {
+          keyp = keyp * hp->n[k] + idx[dims[k]];
+        }
+
+      b = bin_ref (hp, keyp);
+
+      if (b == 0)
+        {
+          free (idx);
+          GSL_ERROR ("failed to store histogramnd bin", GSL_ENOMEM);
+        }
+
+      *b += value;
+    }
+
+  free (idx);
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,272 @@
+/* histogram/pdfnd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_histogramnd.h>
+
+#include "find.c"
+#include "binnd.c"
+
+/* The cumulative distribution only includes the bins with a positive
+   value, in increasing order of their keys, so that its size is the
+   number of occupied bins and a sparse histogram gives the same
+   samples as a dense one with the same contents. */
+
+int
+gsl_histogramnd_pdf_sample (const gsl_histogramnd_pdf * p,
+                            const double r[], double x[])
+{
+  size_t k, key, d;
+  double r0 = r[0];
+
+/* Wrap the exclusive top of the bin down to the inclusive bottom of
+   the bin. Since this is a single point it should not affect the
+   distribution. */
+
+  if (r0 == 1.0)
+    {
+      r0 = 0.0;
+    }
+
+  if (find (p->nsum, p->sum, r0, &k))
+    {
+      GSL_ERROR ("cannot find r[0] in cumulative pdf", GSL_EDOM);
+    }
+
+  key = p->key[k];
+  d = p->ndim;
+
+  while (d-- > 0)
+    {
+      const size_t i = key % p->n[d];
+      const double *range = p->range[d];
+      double f;
+
+      if (d == 0)
+        {
+          f = (r0 - p->sum[k]) / (p->sum[k + 1] - p->sum[k]);
+        }
+      else
+        {
+          f = (r[d] == 1.0) ? 0.0 : r[d];
+        }
+
+      x[d] = range[i] + f * (range[i + 1] - range[i]);
+      key /= p->n[d];
+    }
+
+  return GSL_SUCCESS;
+}
+
+gsl_histogramnd_pdf *
+gsl_histogramnd_pdf_alloc (const size_t ndim, const size_t n[])
+{
+  gsl_histogramnd_pdf *p;
+  size_t nrange = 0;
+  size_t d;
+
+  if (ndim == 0)
+    {
+      GSL_ERROR_VAL ("histogramnd pdf dimension must be positive integer",
+                        GSL_EDOM, 0);
+    }
+
+  for (d = 0; d < ndim; d++)
+    {
+      if (n[d] == 0)
+        {
+          GSL_ERROR_VAL ("histogramnd pdf lengths must be positive integers",
+                            GSL_EDOM, 0);
+        }
+
+      nrange += n[d] + 1;
+    }
+
+  p = (gsl_histogramnd_pdf *) calloc (1, sizeof (gsl_histogramnd_pdf));
+
+  if (p == 0)
+    {
+      GSL_ERROR_VAL ("failed to allocate space for histogramnd pdf struct",
+                        GSL_ENOMEM, 0);
+    }
+
+  p->n = (size_t *) malloc (ndim * sizeof (size_t));
+  p->range = (double **) malloc (ndim * sizeof (double *));
+
+  if (p->n == 0 || p->range == 0)
+    {
+      free (p->n);
+      free (p->range);
+      free (p);         /* exception in constructor, avoid memory leak */
+      GSL_ERROR_VAL ("failed to allocate space for histogramnd pdf lengths",
+                        GSL_ENOMEM, 0);
+    }
+
+  p->range[0] = (double *) malloc (nrange * sizeof (double));
+
+  if (p->range[0] == 0)
+    {
+      free (p->n);
+      free (p->range);
+      free (p);
+      GSL_ERROR_VAL ("failed to allocate space for histogramnd pdf ranges",
+                        GSL_ENOMEM, 0);
+    }
+
+  for (d = 0; d < ndim; d++)
+    {
+      if (d > 0)
+        {
+          p->range[d] = p->range[d - 1] + n[d - 1] + 1;
+        }
+
+      p->n[d] = n[d];
+    }
+
+  p->ndim = ndim;
+
+  return p;
+}
+
+static int
+compare_keys (const void *a, const void *b)
+{
+  const size_t ka = *(const size_t *) a;
+  const size_t kb = *(const size_t *) b;
+
+  return (ka > kb) - (ka < kb);
+}
+
+int
+gsl_histogramnd_pdf_init (gsl_histogramnd_pdf * p, const gsl_histogramnd * h)
+{
+  size_t pos, key, nsum, d, i;
+  size_t *keys;
+  double *sum;
+  double value, total;
+
+  if (p->ndim != h->ndim)
+    {
+      GSL_ERROR ("histogramnd size must match pdf size", GSL_EDOM);
+    }
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      if (p->n[d] != h->n[d])
+        {
+          GSL_ERROR ("histogramnd size must match pdf size", GSL_EDOM);
+        }
+    }
+
+  nsum = 0;
+  pos = 0;
+
+  while (bin_next (h, &pos, &key, &value))
+    {
+      if (value < 0)
+        {
+          GSL_ERROR ("histogram bins must be non-negative to compute"
+                     "a probability distribution", GSL_EDOM);
+        }
+
+      nsum++;
+    }
+
+  if (nsum == 0)
+    {
+      GSL_ERROR ("histogram must have a positive bin to compute "
+                 "a probability distribution", GSL_EDOM);
+    }
+
+  keys = (size_t *) realloc (p->key, nsum * sizeof (size_t));
+
+  if (keys == 0)
+    {
+      GSL_ERROR ("failed to allocate space for histogramnd pdf keys",
+                 GSL_ENOMEM);
+    }
+
+  p->key = keys;
+
+  sum = (double *) realloc (p->sum, (nsum + 1) * sizeof (double));
+
+  if (sum == 0)
+    {
+      GSL_ERROR ("failed to allocate space for histogramnd pdf sums",
+                 GSL_ENOMEM);
+    }
+
+  p->sum = sum;
+  p->nsum = nsum;
+
+  for (d = 0; d < h->ndim; d++)
+    {
+      for (i = 0; i <= h->n[d]; i++)
+        {
+          p->range[d][i] = h->range[d][i];
+        }
+    }
+
+  i = 0;
+  pos = 0;
+
+  while (bin_next (h, &pos, &key, &value))
+    {
+      keys[i++] = key;
+    }
+
+  /* dense histograms are visited in key order, sparse ones are not */
+
+  if (h->type == GSL_HISTOGRAMND_SPARSE)
+    {
+      qsort (keys, nsum, sizeof (size_t), compare_keys);
+    }
+
+  total = 0;
+  sum[0] = 0;
+
+  for (i = 0; i < nsum; i++)
+    {
+      total += bin_value (h, keys[i]);
+      sum[i + 1] = total;
+    }
+
+  for (i = 1; i < nsum; i++)
+    {
+      sum[i] /= total;
+    }
+
+  sum[nsum] = 1.0;
+
+  return GSL_SUCCESS;
+}
+
+void
+gsl_histogramnd_pdf_free (gsl_histogramnd_pdf * p)
+{
+  RETURN_IF_NULL (p);
+  free (p->range[0]);
+  free (p->range);
+  free (p->n);
+  free (p->key);
+  free (p->sum);
+  free (p);
+}
@@ -30,6 +30,7 @@ void test1d_resample (void);
 void test2d_resample (void);
 void test1d_trap (void);
 void test2d_trap (void);
+void testnd (void);
 
 int
 main (void)
@@ -40,6 +41,7 @@ main (void)
   test2d_resample();
   test1d_trap();
   test2d_trap();
+  testnd();
   
   exit (gsl_test_summary ());
 }
@@ -1,6 +1,7 @@
 /* histogram/test.c
  * 
  * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 Brian Gough
+ * Copyright (C) 2026 The GSL Team
  * 
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -20,10 +21,14 @@
 #include <config.h>
 #include <stdlib.h>
 #include <stdio.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_histogram.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_ieee_utils.h>
 
+#include "urand.c"
+
 #define N 397
 #define NR 10
 
@@ -476,6 +481,103 @@ test1d (void)
     fclose (f);
   }
 
+  {
+    /* gsl_histogram_accumulate_array must give the same bins as
+       gsl_histogram_accumulate, for uniform and non-uniform ranges,
+       including samples on the bin edges and outside the range */
+
+    const size_t M = 3000;
+    double *x = malloc (2 * M * sizeof (double));
+    double *w = malloc (M * sizeof (double));
+    gsl_histogram *hu = gsl_histogram_calloc_uniform (N, -1.5, 2.7);
+    gsl_histogram *hn = gsl_histogram_calloc (NR);
+    double xr[NR + 1] = { -1.5, -1.4, -1.0, 0.0, 0.1, 0.5, 0.7, 1.6, 2.0, 2.2, 2.7 };
+    int k;
+
+    gsl_histogram_set_ranges (hn, xr, NR + 1);
+
+    for (i = 0; i < M; i++)
+      {
+        if (i % 7 == 0)
+          x[2 * i] = hu->range[i % (N + 1)];
+        else if (i % 11 == 0)
+          x[2 * i] = xr[i % (NR + 1)];
+        else
+          x[2 * i] = -2.0 + 5.0 * urand ();
+
+        x[2 * i + 1] = GSL_NAN;
+        w[i] = urand ();
+      }
+
+    x[2] = GSL_NAN;
+
+    for (k = 0; k < 2; k++)
+      {
+        gsl_histogram *ha = k ? hn : hu;
+        gsl_histogram *hb = gsl_histogram_clone (ha);
+        int status = 0, status_array;
+
+        gsl_histogram_reset (ha);
+        gsl_histogram_reset (hb);
+
+        status_array = gsl_histogram_accumulate_array (ha, x, 2, w, 1, M);
+
+        for (i = 0; i < M; i++)
+          {
+            if (!gsl_isnan (x[2 * i]))
+              gsl_histogram_accumulate (hb, x[2 * i], w[i]);
+          }
+
+        for (i = 0; i < ha->n; i++)
+          {
+            if (ha->bin[i] != hb->bin[i])
+              status = 1;
+          }
+
+        gsl_test (status, "gsl_histogram_accumulate_array %s bins",
+                  k ? "non-uniform" : "uniform");
+        gsl_test_int (status_array, GSL_EDOM,
+                      "gsl_histogram_accumulate_array %s out of range",
+                      k ? "non-uniform" : "uniform");
+
+        gsl_histogram_reset (ha);
+        gsl_histogram_reset (hb);
+
+        gsl_histogram_accumulate_array (ha, x, 2, NULL, 0, M);
+
+        for (i = 0; i < M; i++)
+          {
+            if (!gsl_isnan (x[2 * i]))
+              gsl_histogram_increment (hb, x[2 * i]);
+          }
+
+        status = 0;
+
+        for (i = 0; i < ha->n; i++)
+          {
+            if (ha->bin[i] != hb->bin[i])
+              status = 1;
+          }
+
+        gsl_test (status, "gsl_histogram_accumulate_array %s unit weights",
+                  k ? "non-uniform" : "uniform");
+
+        gsl_histogram_free (hb);
+      }
+
+    {
+      double xin[3] = { 0.0, 1.0, 2.0 };
+      int status = gsl_histogram_accumulate_array (hu, xin, 1, NULL, 0, 3);
+      gsl_test_int (status, GSL_SUCCESS,
+                    "gsl_histogram_accumulate_array in range");
+    }
+
+    free (x);
+    free (w);
+    gsl_histogram_free (hu);
+    gsl_histogram_free (hn);
+  }
+
   gsl_histogram_free (h);
   gsl_histogram_free (g);
   gsl_histogram_free (h1);
@@ -0,0 +1,400 @@
+/* histogram/testnd.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <stdio.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_histogram2d.h>
+#include <gsl/gsl_histogramnd.h>
+#include <gsl/gsl_test.h>
+
+#include "urand.c"
+
+#define MR 10
+#define NR 5
+#define NPTS 5000
+#define NBIG 40
+
+static const size_t storage[2] = { GSL_HISTOGRAMND_DENSE,
+                                   GSL_HISTOGRAMND_SPARSE };
+
+static const char *storage_name[2] = { "dense", "sparse" };
+
+/* compare a 2D histogramnd with gsl_histogram2d for the same data */
+static void
+test_nd_2d (const size_t type, const char *desc)
+{
+  double xr[MR + 1] =
+    { 0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0 };
+  double yr[NR + 1] = { 90.0, 91.0, 92.5, 93.0, 94.0, 95.0 };
+  const size_t n[2] = { MR, NR };
+  gsl_histogram2d *h2 = gsl_histogram2d_calloc_range (MR, NR, xr, yr);
+  gsl_histogramnd *h = gsl_histogramnd_alloc (2, n, type);
+  size_t i, j, k, idx[2];
+  int status = 0, s2, snd;
+
+  gsl_histogramnd_set_ranges (h, 0, xr, MR + 1);
+  gsl_histogramnd_set_ranges (h, 1, yr, NR + 1);
+
+  for (k = 0; k < NPTS; k++)
+    {
+      double x[2];
+      double w = urand ();
+
+      x[0] = -1.0 + 12.0 * urand ();
+      x[1] = 89.0 + 7.0 * urand ();
+
+      s2 = gsl_histogram2d_accumulate (h2, x[0], x[1], w);
+      snd = gsl_histogramnd_accumulate (h, x, w);
+
+      if (s2 != snd)
+        status = 1;
+    }
+
+  gsl_test (status, "gsl_histogramnd_accumulate %s status matches 2d",
+            desc);
+
+  status = 0;
+
+  for (i = 0; i < MR; i++)
+    {
+      for (j = 0; j < NR; j++)
+        {
+          idx[0] = i;
+          idx[1] = j;
+
+          if (gsl_histogramnd_get (h, idx) != gsl_histogram2d_get (h2, i, j))
+            status = 1;
+        }
+    }
+
+  gsl_test (status, "gsl_histogramnd_get %s matches 2d", desc);
+
+  gsl_test_rel (gsl_histogramnd_sum (h), gsl_histogram2d_sum (h2), 1e-12,
+                "gsl_histogramnd_sum %s", desc);
+
+  {
+    double x[2] = { 3.5, 92.5 };
+    double lower, upper;
+
+    gsl_histogramnd_find (h, x, idx);
+    gsl_test (idx[0] != 3 || idx[1] != 2,
+              "gsl_histogramnd_find %s", desc);
+
+    gsl_histogramnd_get_range (h, 1, 1, &lower, &upper);
+    gsl_test (lower != 91.0 || upper != 92.5,
+              "gsl_histogramnd_get_range %s", desc);
+
+    x[1] = GSL_NAN;
+    gsl_test_int (gsl_histogramnd_increment (h, x), GSL_EDOM,
+                  "gsl_histogramnd_increment %s NaN", desc);
+  }
+
+  gsl_histogram2d_free (h2);
+  gsl_histogramnd_free (h);
+}
+
+/* fill a 3D histogram with non-uniform bins in one dimension */
+static gsl_histogramnd *
+make_3d (const size_t type)
+{
+  const size_t n[3] = { 4, 5, 6 };
+  const double xmin[3] = { -1.0, 0.0, 10.0 };
+  const double xmax[3] = { 1.0, 5.0, 16.0 };
+  const double yr[6] = { 0.0, 0.5, 1.0, 2.0, 3.5, 5.0 };
+  gsl_histogramnd *h = gsl_histogramnd_alloc (3, n, type);
+  size_t k;
+
+  gsl_histogramnd_set_ranges_uniform (h, xmin, xmax);
+  gsl_histogramnd_set_ranges (h, 1, yr, 6);
+
+  for (k = 0; k < NPTS; k++)
+    {
+      double x[3];
+
+      x[0] = -1.0 + 2.0 * urand () * urand ();
+      x[1] = 5.0 * urand () * urand ();
+      x[2] = 10.0 + 6.5 * urand ();
+
+      gsl_histogramnd_accumulate (h, x, (k % 3) + 1.0);
+    }
+
+  return h;
+}
+
+static void
+test_nd_ops (void)
+{
+  gsl_histogramnd *hd = make_3d (GSL_HISTOGRAMND_DENSE);
+  gsl_histogramnd *hs = make_3d (GSL_HISTOGRAMND_SPARSE);
+  size_t idx[3], i0, i1, i2;
+  size_t pos, nnz;
+  double value, sum;
+  int status;
+
+  gsl_test (!gsl_histogramnd_equal_bins_p (hd, hs),
+            "gsl_histogramnd_equal_bins_p dense sparse");
+
+  /* the two histograms were filled from different data, so make the
+     dense one a copy of the sparse one */
+
+  {
+    gsl_histogramnd_reset (hd);
+    gsl_histogramnd_add (hd, hs);
+
+    status = 0;
+
+    for (i0 = 0; i0 < 4; i0++)
+      for (i1 = 0; i1 < 5; i1++)
+        for (i2 = 0; i2 < 6; i2++)
+          {
+            idx[0] = i0;
+            idx[1] = i1;
+            idx[2] = i2;
+
+            if (gsl_histogramnd_get (hd, idx) != gsl_histogramnd_get (hs, idx))
+              status = 1;
+          }
+
+    gsl_test (status, "gsl_histogramnd_add sparse to dense");
+
+    gsl_test_int (gsl_histogramnd_nnz (hd), gsl_histogramnd_nnz (hs),
+                  "gsl_histogramnd_nnz dense sparse");
+
+    /* next visits every non-zero bin once */
+
+    pos = 0;
+    nnz = 0;
+    sum = 0;
+    status = 0;
+
+    while (gsl_histogramnd_next (hs, &pos, idx, &value) == GSL_SUCCESS)
+      {
+        if (value == 0 || value != gsl_histogramnd_get (hd, idx))
+          status = 1;
+
+        nnz++;
+        sum += value;
+      }
+
+    gsl_test (status, "gsl_histogramnd_next sparse values");
+    gsl_test_int (nnz, gsl_histogramnd_nnz (hs), "gsl_histogramnd_next count");
+    gsl_test_rel (sum, gsl_histogramnd_sum (hd), 1e-12,
+                  "gsl_histogramnd_next sum");
+
+    /* adding a histogram to itself doubles it */
+
+    gsl_histogramnd_add (hs, hs);
+    gsl_histogramnd_scale (hd, 2.0);
+
+    status = 0;
+
+    for (i0 = 0; i0 < 4; i0++)
+      for (i1 = 0; i1 < 5; i1++)
+        for (i2 = 0; i2 < 6; i2++)
+          {
+            idx[0] = i0;
+            idx[1] = i1;
+            idx[2] = i2;
+
+            if (gsl_histogramnd_get (hd, idx) != gsl_histogramnd_get (hs, idx))
+              status = 1;
+          }
+
+    gsl_test (status, "gsl_histogramnd_add self and scale");
+
+    gsl_histogramnd_scale (hs, 0.5);
+    gsl_histogramnd_scale (hd, 0.5);
+
+    /* project onto dimensions 2 and 0, in that order */
+
+    {
+      const size_t dims[2] = { 2, 0 };
+      const size_t np[2] = { 6, 4 };
+      const double pmin[2] = { 10.0, -1.0 };
+      const double pmax[2] = { 16.0, 1.0 };
+      size_t t;
+
+      for (t = 0; t < 2; t++)
+        {
+          gsl_histogramnd *hp = gsl_histogramnd_alloc (2, np, storage[t]);
+          const gsl_histogramnd *hsrc = (t == 0) ? hs : hd;
+
+          gsl_histogramnd_set_ranges_uniform (hp, pmin, pmax);
+          gsl_histogramnd_project (hp, hsrc, dims);
+
+          status = 0;
+
+          for (i2 = 0; i2 < 6; i2++)
+            for (i0 = 0; i0 < 4; i0++)
+              {
+                size_t ip[2];
+                double s = 0;
+
+                for (i1 = 0; i1 < 5; i1++)
+                  {
+                    idx[0] = i0;
+                    idx[1] = i1;
+                    idx[2] = i2;
+                    s += gsl_histogramnd_get (hd, idx);
+                  }
+
+                ip[0] = i2;
+                ip[1] = i0;
+
+                if (fabs (gsl_histogramnd_get (hp, ip) - s) > 1e-12 * s)
+                  status = 1;
+              }
+
+          gsl_test (status, "gsl_histogramnd_project %s", storage_name[t]);
+
+          gsl_histogramnd_free (hp);
+        }
+
+      {
+        const size_t bad[2] = { 0, 2 };
+        gsl_histogramnd *hp = gsl_histogramnd_alloc (2, np, storage[0]);
+
+        gsl_histogramnd_set_ranges_uniform (hp, pmin, pmax);
+        gsl_test_int (gsl_histogramnd_project (hp, hs, bad), GSL_EINVAL,
+                      "gsl_histogramnd_project mismatched bins");
+        gsl_histogramnd_free (hp);
+      }
+    }
+
+    /* dense and sparse histograms give the same samples */
+
+    {
+      gsl_histogramnd_pdf *pd = gsl_histogramnd_pdf_alloc (3, hd->n);
+      gsl_histogramnd_pdf *ps = gsl_histogramnd_pdf_alloc (3, hs->n);
+      size_t k;
+
+      gsl_histogramnd_pdf_init (pd, hd);
+      gsl_histogramnd_pdf_init (ps, hs);
+
+      gsl_test_int (pd->nsum, gsl_histogramnd_nnz (hd),
+                    "gsl_histogramnd_pdf_init nsum");
+
+      status = 0;
+
+      for (k = 0; k < 1000; k++)
+        {
+          double r[3], xd[3], xs[3];
+
+          r[0] = urand ();
+          r[1] = urand ();
+          r[2] = urand ();
+
+          gsl_histogramnd_pdf_sample (pd, r, xd);
+          gsl_histogramnd_pdf_sample (ps, r, xs);
+
+          if (xd[0] != xs[0] || xd[1] != xs[1] || xd[2] != xs[2])
+            status = 1;
+
+          if (gsl_histogramnd_find (hd, xd, idx)
+              || gsl_histogramnd_get (hd, idx) <= 0)
+            status = 1;
+        }
+
+      gsl_test (status, "gsl_histogramnd_pdf_sample dense sparse");
+
+      gsl_histogramnd_pdf_free (pd);
+      gsl_histogramnd_pdf_free (ps);
+    }
+
+  }
+
+  gsl_histogramnd_free (hd);
+  gsl_histogramnd_free (hs);
+}
+
+/* a sparse 6D histogram with far more bins than could be stored
+   densely, whose hash table grows many times */
+static void
+test_nd_sparse (void)
+{
+  size_t n[6], idx[6];
+  double xmin[6], xmax[6];
+  gsl_histogramnd *h;
+  size_t d, k, pos, nnz;
+  double value, sum = 0;
+  int status = 0;
+
+  for (d = 0; d < 6; d++)
+    {
+      n[d] = NBIG;
+      xmin[d] = 0.0;
+      xmax[d] = 1.0;
+    }
+
+  h = gsl_histogramnd_alloc (6, n, GSL_HISTOGRAMND_SPARSE);
+  gsl_histogramnd_set_ranges_uniform (h, xmin, xmax);
+
+  for (k = 0; k < 2 * NPTS; k++)
+    {
+      double x[6];
+
+      for (d = 0; d < 6; d++)
+        x[d] = urand ();
+
+      /* add each point twice, so that every stored bin is even */
+      gsl_histogramnd_increment (h, x);
+      gsl_histogramnd_increment (h, x);
+      sum += 2.0;
+    }
+
+  gsl_test_rel (gsl_histogramnd_sum (h), sum, 1e-15,
+                "gsl_histogramnd sparse 6d sum");
+
+  nnz = gsl_histogramnd_nnz (h);
+  gsl_test (nnz == 0 || nnz > 2 * NPTS || nnz != h->nz,
+            "gsl_histogramnd sparse 6d nnz");
+  gsl_test (2 * h->nz > h->tsize, "gsl_histogramnd sparse 6d load factor");
+
+  pos = 0;
+
+  while (gsl_histogramnd_next (h, &pos, idx, &value) == GSL_SUCCESS)
+    {
+      if (value != gsl_histogramnd_get (h, idx) || fmod (value, 2.0) != 0)
+        status = 1;
+    }
+
+  gsl_test (status, "gsl_histogramnd sparse 6d get");
+
+  gsl_histogramnd_reset (h);
+  gsl_test_int (gsl_histogramnd_nnz (h), 0, "gsl_histogramnd sparse reset");
+
+  gsl_histogramnd_free (h);
+}
+
+void
+testnd (void)
+{
+  size_t t;
+
+  for (t = 0; t < 2; t++)
+    {
+      test_nd_2d (storage[t], storage_name[t]);
+    }
+
+  test_nd_ops ();
+  test_nd_sparse ();
+}
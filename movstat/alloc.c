@@ -0,0 +1,102 @@
+/* movstat/alloc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_movstat.h>
+
+/*
+gsl_movstat_alloc()
+  Allocate a workspace for a symmetric moving window of K samples,
+H = J = K/2 on each side of the current sample. If K is even it is
+rounded up to the next odd number.
+*/
+
+gsl_movstat_workspace *
+gsl_movstat_alloc(const size_t K)
+{
+  const size_t H = K / 2;
+  return gsl_movstat_alloc_with_size(0, H, H);
+}
+
+/*
+gsl_movstat_alloc2()
+  Allocate a workspace for a window of H samples before and J samples
+after the current sample
+*/
+
+gsl_movstat_workspace *
+gsl_movstat_alloc2(const size_t H, const size_t J)
+{
+  return gsl_movstat_alloc_with_size(0, H, J);
+}
+
+/*
+gsl_movstat_alloc_with_size()
+  Allocate a workspace whose accumulator state has room for any of the
+built-in accumulators, or for accum_state_size bytes if larger, as
+needed by a user-defined accumulator
+*/
+
+gsl_movstat_workspace *
+gsl_movstat_alloc_with_size(const size_t accum_state_size, const size_t H, const size_t J)
+{
+  const gsl_movstat_accum * builtin[] = { gsl_movstat_accum_mean,
+                                          gsl_movstat_accum_minmax,
+                                          gsl_movstat_accum_quantile,
+                                          gsl_movstat_accum_mad,
+                                          gsl_movstat_accum_userfunc };
+  gsl_movstat_workspace *w;
+  size_t i, size = accum_state_size;
+
+  w = calloc(1, sizeof(gsl_movstat_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->H = H;
+  w->J = J;
+  w->K = H + J + 1;
+
+  for (i = 0; i < sizeof(builtin) / sizeof(builtin[0]); ++i)
+    size = GSL_MAX(size, (builtin[i]->size)(w->K));
+
+  w->state_size = size;
+
+  w->state = malloc(size);
+  if (w->state == 0)
+    {
+      gsl_movstat_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for accumulator state", GSL_ENOMEM);
+    }
+
+  return w;
+}
+
+void
+gsl_movstat_free(gsl_movstat_workspace * w)
+{
+  if (w->state)
+    free(w->state);
+
+  free(w);
+}
@@ -0,0 +1,165 @@
+/* movstat/apply.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module applies an accumulator to each window
+ *
+ * W_i = { x_{i-H}, ..., x_i, ..., x_{i+J} },  i = 0, ..., n - 1
+ *
+ * of an input vector x of length n. The samples are added to the
+ * accumulator in order, and each new sample replaces the oldest one
+ * once the window is full, so the accumulator only needs to update its
+ * state for one sample entering and one leaving the window.
+ *
+ * Near the ends the window extends past the data. The missing samples
+ * are taken to be zero (GSL_MOVSTAT_END_PADZERO) or equal to the first
+ * or last sample (GSL_MOVSTAT_END_PADVALUE), or the window is truncated
+ * to the samples in [0, n-1] (GSL_MOVSTAT_END_TRUNCATE), in which case
+ * the oldest sample is deleted without a replacement at the right end.
+ *
+ * Each output y_i is written after all the samples of W_i have been
+ * read, and samples are never read again once added, so the output
+ * may be the same vector as the input.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_movstat.h>
+
+int
+gsl_movstat_apply_accum(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                        const gsl_movstat_accum * accum, void * accum_params,
+                        gsl_vector * y, gsl_vector * z,
+                        gsl_movstat_workspace * w)
+{
+  const size_t n = x->size;
+  const size_t H = w->H;
+  const size_t J = w->J;
+
+  if (y->size != n)
+    {
+      GSL_ERROR ("input and output vectors must have same length", GSL_EBADLEN);
+    }
+  else if (z != NULL && z->size != n)
+    {
+      GSL_ERROR ("input and output vectors must have same length", GSL_EBADLEN);
+    }
+  else if ((accum->size)(w->K) > w->state_size)
+    {
+      GSL_ERROR ("accumulator state is too large for workspace", GSL_EBADLEN);
+    }
+  else if (n == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else
+    {
+      const int truncate = (endtype == GSL_MOVSTAT_END_TRUNCATE);
+      double xleft = 0.0, xright = 0.0;
+      double result[2];
+      size_t i;
+
+      if (endtype == GSL_MOVSTAT_END_PADVALUE)
+        {
+          xleft = gsl_vector_get(x, 0);
+          xright = gsl_vector_get(x, n - 1);
+        }
+
+      (accum->init)(w->K, w->state);
+
+      /* samples before the first window position */
+      if (!truncate)
+        {
+          for (i = 0; i < H; ++i)
+            (accum->insert)(xleft, w->state);
+        }
+
+      for (i = 0; i < J; ++i)
+        {
+          if (i < n)
+            (accum->insert)(gsl_vector_get(x, i), w->state);
+          else if (!truncate)
+            (accum->insert)(xright, w->state);
+        }
+
+      for (i = 0; i < n; ++i)
+        {
+          const size_t idx = i + J;
+
+          if (idx < n)
+            (accum->insert)(gsl_vector_get(x, idx), w->state);
+          else if (!truncate)
+            (accum->insert)(xright, w->state);
+          else if (i > H)
+            (accum->delete_oldest)(w->state);
+
+          (accum->get)(accum_params, result, w->state);
+
+          gsl_vector_set(y, i, result[0]);
+
+          if (z != NULL)
+            gsl_vector_set(z, i, result[1]);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_movstat_fill()
+  Copy the window of samples x_{idx-H}, ..., x_{idx+J} into window[],
+with the end handling endtype, and return the number of samples
+*/
+
+size_t
+gsl_movstat_fill(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                 const size_t idx, const size_t H, const size_t J, double * window)
+{
+  const size_t n = x->size;
+  size_t i, k = 0;
+
+  if (idx >= n)
+    {
+      GSL_ERROR_VAL ("window center index must be less than n", GSL_EINVAL, 0);
+    }
+
+  for (i = 0; i < H + J + 1; ++i)
+    {
+      /* index of sample i of the window, relative to x_{idx-H} */
+      const int left = (i < H - GSL_MIN(H, idx));
+      const int right = (idx + i >= n + H);
+
+      if (left || right)
+        {
+          if (endtype == GSL_MOVSTAT_END_PADZERO)
+            window[k++] = 0.0;
+          else if (endtype == GSL_MOVSTAT_END_PADVALUE)
+            window[k++] = gsl_vector_get(x, left ? 0 : n - 1);
+        }
+      else
+        {
+          window[k++] = gsl_vector_get(x, idx + i - H);
+        }
+    }
+
+  return k;
+}
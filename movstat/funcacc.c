@@ -0,0 +1,149 @@
+/* movstat/funcacc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_movstat.h>
+
+/* the samples of the window are kept in a ring buffer and copied in
+   order of arrival for each call of the user function */
+
+typedef struct
+{
+  size_t n;     /* window size */
+  size_t k;     /* number of samples in window */
+  size_t head;  /* index of oldest sample */
+  double *buf;  /* ring buffer of samples, size n */
+  double *work; /* copy of window for computing the statistic, size n */
+} window_state_t;
+
+static size_t
+window_size(const size_t n)
+{
+  return sizeof(window_state_t) + 2 * n * sizeof(double);
+}
+
+static int
+window_init(const size_t n, void * vstate)
+{
+  window_state_t * state = (window_state_t *) vstate;
+
+  state->n = n;
+  state->k = 0;
+  state->head = 0;
+  state->buf = (double *) ((unsigned char *) vstate + sizeof(window_state_t));
+  state->work = state->buf + n;
+
+  return GSL_SUCCESS;
+}
+
+static int
+window_insert(const double x, void * vstate)
+{
+  window_state_t * state = (window_state_t *) vstate;
+
+  if (state->k == state->n)
+    {
+      state->buf[state->head] = x;
+      state->head = (state->head + 1) % state->n;
+    }
+  else
+    {
+      state->buf[(state->head + state->k) % state->n] = x;
+      state->k++;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+window_delete(void * vstate)
+{
+  window_state_t * state = (window_state_t *) vstate;
+
+  if (state->k > 0)
+    {
+      state->head = (state->head + 1) % state->n;
+      state->k--;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* copy the window, oldest sample first, into state->work and return
+   the number of samples */
+static size_t
+window_copy(window_state_t * state)
+{
+  const size_t n1 = GSL_MIN(state->k, state->n - state->head);
+  size_t i;
+
+  for (i = 0; i < n1; ++i)
+    state->work[i] = state->buf[state->head + i];
+
+  for (i = n1; i < state->k; ++i)
+    state->work[i] = state->buf[i - n1];
+
+  return state->k;
+}
+
+/* the user function is passed as the parameter of the accumulator, and
+   may modify the copy of the window it is given */
+static int
+funcacc_get(void * params, double * result, void * vstate)
+{
+  window_state_t * state = (window_state_t *) vstate;
+  gsl_movstat_function * F = (gsl_movstat_function *) params;
+  const size_t k = window_copy(state);
+
+  *result = GSL_MOVSTAT_FN_EVAL(F, k, state->work);
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_movstat_accum func_accum_type =
+{
+  window_size,
+  window_init,
+  window_insert,
+  window_delete,
+  funcacc_get
+};
+
+const gsl_movstat_accum *gsl_movstat_accum_userfunc = &func_accum_type;
+
+/*
+gsl_movstat_apply()
+  Apply a user-defined function to each window of the input
+
+Inputs: endtype - how to handle the ends of the input
+        F       - function to apply, called with the number of samples
+                  in the window and a copy of them
+        x       - input vector, size n
+        y       - (output) function values, size n
+        w       - workspace
+*/
+
+int
+gsl_movstat_apply(const gsl_movstat_end_t endtype, const gsl_movstat_function * F,
+                  const gsl_vector * x, gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_userfunc, (void *) F, y, NULL, w);
+}
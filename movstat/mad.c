@@ -0,0 +1,291 @@
+/* movstat/mad.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module contains the accumulator for the moving median absolute
+ * deviation
+ *
+ * MAD_i = S median { |x_j - median(W_i)| : x_j in W_i }
+ *
+ * with the scale factor S = 1.4826 for a consistent estimate of the
+ * standard deviation of Gaussian data.
+ *
+ * The samples of the window are kept in sorted order, next to a ring
+ * buffer which records the order in which they arrived. The median m
+ * is then the middle of the sorted array s, and the deviations from it
+ * form two sorted sequences,
+ *
+ *   L_t = m - s[c-1-t],  t = 0, ..., c - 1
+ *   R_t = s[c+t] - m,    t = 0, ..., k - c - 1
+ *
+ * with c = floor(k/2), so the median of the deviations is found by
+ * selecting ranks from the union of two sorted sequences, in O(log K)
+ * time. An update locates the outgoing and incoming samples by binary
+ * search and shifts the samples between them with memmove, so it takes
+ * O(log K) comparisons and moves at most K contiguous doubles.
+ */
+
+#include <config.h>
+#include <string.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_movstat.h>
+
+typedef struct
+{
+  size_t n;       /* window size */
+  size_t k;       /* number of samples in window */
+  size_t head;    /* index of oldest sample in ring */
+  double *ring;   /* samples in order of arrival, size n */
+  double *sorted; /* samples in increasing order, size n */
+} madacc_state_t;
+
+static size_t
+madacc_size(const size_t n)
+{
+  return sizeof(madacc_state_t) + 2 * n * sizeof(double);
+}
+
+static int
+madacc_init(const size_t n, void * vstate)
+{
+  madacc_state_t * state = (madacc_state_t *) vstate;
+
+  state->n = n;
+  state->k = 0;
+  state->head = 0;
+  state->ring = (double *) ((unsigned char *) vstate + sizeof(madacc_state_t));
+  state->sorted = state->ring + n;
+
+  return GSL_SUCCESS;
+}
+
+/* number of samples in sorted[0..k-1] less than x */
+static size_t
+madacc_lower(const double * sorted, const size_t k, const double x)
+{
+  size_t lo = 0, hi = k;
+
+  while (lo < hi)
+    {
+      const size_t mid = lo + (hi - lo) / 2;
+
+      if (sorted[mid] < x)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return lo;
+}
+
+/* remove y from the sorted samples and insert x in its place */
+static void
+madacc_replace(madacc_state_t * state, const double y, const double x)
+{
+  double * s = state->sorted;
+  const size_t i = madacc_lower(s, state->k, y);
+  size_t j;
+
+  if (x >= y)
+    {
+      /* shift s[i+1..j-1] down, where j is the position of x once y
+         is removed */
+      j = i + 1 + madacc_lower(s + i + 1, state->k - i - 1, x);
+      memmove(s + i, s + i + 1, (j - i - 1) * sizeof(double));
+      s[j - 1] = x;
+    }
+  else
+    {
+      j = madacc_lower(s, i, x);
+      memmove(s + j + 1, s + j, (i - j) * sizeof(double));
+      s[j] = x;
+    }
+}
+
+static int
+madacc_insert(const double x, void * vstate)
+{
+  madacc_state_t * state = (madacc_state_t *) vstate;
+
+  if (state->k == state->n)
+    {
+      const double y = state->ring[state->head];
+
+      madacc_replace(state, y, x);
+
+      state->ring[state->head] = x;
+      state->head = (state->head + 1) % state->n;
+    }
+  else
+    {
+      double * s = state->sorted;
+      const size_t j = madacc_lower(s, state->k, x);
+
+      memmove(s + j + 1, s + j, (state->k - j) * sizeof(double));
+      s[j] = x;
+
+      state->ring[(state->head + state->k) % state->n] = x;
+      state->k++;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+madacc_delete(void * vstate)
+{
+  madacc_state_t * state = (madacc_state_t *) vstate;
+
+  if (state->k > 0)
+    {
+      double * s = state->sorted;
+      const size_t i = madacc_lower(s, state->k, state->ring[state->head]);
+
+      memmove(s + i, s + i + 1, (state->k - i - 1) * sizeof(double));
+
+      state->head = (state->head + 1) % state->n;
+      state->k--;
+    }
+
+  return GSL_SUCCESS;
+}
+
+/* deviations of the samples below and above the median, each in
+   increasing order */
+#define MADACC_L(t) (median - s[c - 1 - (t)])
+#define MADACC_R(t) (s[c + (t)] - median)
+
+/* element of rank r (from 0) of the union of the sequences L and R */
+static double
+madacc_select(const double * s, const size_t k, const double median, const size_t r)
+{
+  const size_t c = k / 2;
+  const size_t nl = c, nr = k - c;
+  size_t lo = (r + 1 > nr) ? r + 1 - nr : 0;
+  size_t hi = GSL_MIN(r + 1, nl);
+
+  /* find the number i of elements of L among the r + 1 smallest, the
+     least i such that L_i > R_{r-i} */
+  while (lo < hi)
+    {
+      const size_t i = lo + (hi - lo) / 2;
+
+      if (MADACC_L(i) > MADACC_R(r - i))
+        hi = i;
+      else
+        lo = i + 1;
+    }
+
+  if (lo == 0)
+    return MADACC_R(r);
+  else if (lo == r + 1)
+    return MADACC_L(r);
+  else
+    return GSL_MAX(MADACC_L(lo - 1), MADACC_R(r - lo));
+}
+
+/* the parameter is a pointer to the scale factor S; result[0] is the
+   median of the window and result[1] is the scaled MAD */
+static int
+madacc_get(void * params, double * result, void * vstate)
+{
+  const madacc_state_t * state = (const madacc_state_t *) vstate;
+  const double scale = (params != NULL) ? *(double *) params : 1.0;
+  const double * s = state->sorted;
+  const size_t k = state->k;
+  double median, mad;
+
+  if (k == 0)
+    {
+      GSL_ERROR ("no samples in window", GSL_EINVAL);
+    }
+
+  if (k % 2)
+    median = s[k / 2];
+  else
+    median = (s[k / 2 - 1] + s[k / 2]) / 2.0;
+
+  mad = madacc_select(s, k, median, (k - 1) / 2);
+
+  if (k % 2 == 0)
+    mad = (mad + madacc_select(s, k, median, k / 2)) / 2.0;
+
+  result[0] = median;
+  result[1] = scale * mad;
+
+  return GSL_SUCCESS;
+}
+
+#undef MADACC_L
+#undef MADACC_R
+
+static const gsl_movstat_accum mad_accum_type =
+{
+  madacc_size,
+  madacc_init,
+  madacc_insert,
+  madacc_delete,
+  madacc_get
+};
+
+const gsl_movstat_accum *gsl_movstat_accum_mad = &mad_accum_type;
+
+static int
+movstat_mad(const gsl_movstat_end_t endtype, const gsl_vector * x, double scale,
+            gsl_vector * xmedian, gsl_vector * xmad, gsl_movstat_workspace * w)
+{
+  if (x->size != xmedian->size || x->size != xmad->size)
+    {
+      GSL_ERROR ("input and output vectors must have same length", GSL_EBADLEN);
+    }
+
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_mad, &scale, xmedian, xmad, w);
+}
+
+/*
+gsl_movstat_mad0()
+  Moving median and unscaled median absolute deviation
+
+Inputs: endtype - how to handle the ends of the input
+        x       - input vector, size n
+        xmedian - (output) median of each window, size n
+        xmad    - (output) MAD of each window, size n
+        w       - workspace
+*/
+
+int
+gsl_movstat_mad0(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                 gsl_vector * xmedian, gsl_vector * xmad, gsl_movstat_workspace * w)
+{
+  return movstat_mad(endtype, x, 1.0, xmedian, xmad, w);
+}
+
+/*
+gsl_movstat_mad()
+  Moving median and median absolute deviation, scaled by 1.4826 to
+estimate the standard deviation of Gaussian data
+*/
+
+int
+gsl_movstat_mad(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                gsl_vector * xmedian, gsl_vector * xmad, gsl_movstat_workspace * w)
+{
+  return movstat_mad(endtype, x, 1.482602218505602, xmedian, xmad, w);
+}
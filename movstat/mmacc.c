@@ -0,0 +1,268 @@
+/* movstat/mmacc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module contains the accumulators for the moving minimum and
+ * maximum, using the monotone deque method (Lemire 2006). Each sample
+ * is numbered in order of insertion and kept in a ring buffer. A deque
+ * holds the numbers of the samples which may still become the minimum
+ * of a later window, in increasing order of both number and value, so
+ * the minimum of the current window is at the front. A new sample
+ * removes from the back every sample not smaller than itself, and the
+ * oldest sample is removed from the front when it leaves the window.
+ * Every sample enters and leaves each deque once, so the cost is
+ * amortized O(1) per sample, independent of the window size. The ring
+ * buffer and deques have a power of 2 size, so that sample numbers map
+ * to positions with a mask rather than a division.
+ * The maximum is found in the same way with a second deque.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_movstat.h>
+
+typedef struct
+{
+  size_t head;  /* position of front element */
+  size_t size;  /* number of elements */
+  size_t *idx;  /* sample numbers, circular array of size mask + 1 */
+} mmacc_deque_t;
+
+typedef struct
+{
+  size_t n;           /* window size */
+  size_t mask;        /* size of ring buffer and deques, minus 1 */
+  size_t k;           /* number of samples in window */
+  size_t t;           /* number of samples inserted so far */
+  double *buf;        /* ring buffer of samples, size mask + 1 */
+  mmacc_deque_t min;  /* candidates for minimum */
+  mmacc_deque_t max;  /* candidates for maximum */
+} mmacc_state_t;
+
+#define MMACC_VALUE(state, i) ((state)->buf[(i) & (state)->mask])
+#define MMACC_AT(state, d, j) ((d)->idx[((d)->head + (j)) & (state)->mask])
+
+/* smallest power of 2 not less than n */
+static size_t
+mmacc_pow2(const size_t n)
+{
+  size_t m = 1;
+
+  while (m < n)
+    m <<= 1;
+
+  return m;
+}
+
+static size_t
+mmacc_size(const size_t n)
+{
+  return sizeof(mmacc_state_t) + mmacc_pow2(n) * (sizeof(double) + 2 * sizeof(size_t));
+}
+
+static int
+mmacc_init(const size_t n, void * vstate)
+{
+  mmacc_state_t * state = (mmacc_state_t *) vstate;
+  unsigned char * ptr = (unsigned char *) vstate + sizeof(mmacc_state_t);
+  const size_t m = mmacc_pow2(n);
+
+  state->n = n;
+  state->mask = m - 1;
+  state->k = 0;
+  state->t = 0;
+
+  state->buf = (double *) ptr;
+  ptr += m * sizeof(double);
+
+  state->min.idx = (size_t *) ptr;
+  ptr += m * sizeof(size_t);
+
+  state->max.idx = (size_t *) ptr;
+
+  state->min.head = state->min.size = 0;
+  state->max.head = state->max.size = 0;
+
+  return GSL_SUCCESS;
+}
+
+static int
+mmacc_delete(void * vstate)
+{
+  mmacc_state_t * state = (mmacc_state_t *) vstate;
+
+  if (state->k > 0)
+    {
+      const size_t oldest = state->t - state->k;
+
+      if (state->min.size > 0 && MMACC_AT(state, &state->min, 0) == oldest)
+        {
+          state->min.head = (state->min.head + 1) & state->mask;
+          state->min.size--;
+        }
+
+      if (state->max.size > 0 && MMACC_AT(state, &state->max, 0) == oldest)
+        {
+          state->max.head = (state->max.head + 1) & state->mask;
+          state->max.size--;
+        }
+
+      state->k--;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+mmacc_insert(const double x, void * vstate)
+{
+  mmacc_state_t * state = (mmacc_state_t *) vstate;
+  mmacc_deque_t * min = &state->min;
+  mmacc_deque_t * max = &state->max;
+
+  if (state->k == state->n)
+    mmacc_delete(vstate);
+
+  /* remove candidates which can no longer be the minimum or maximum */
+  while (min->size > 0 && MMACC_VALUE(state, MMACC_AT(state, min, min->size - 1)) >= x)
+    min->size--;
+
+  while (max->size > 0 && MMACC_VALUE(state, MMACC_AT(state, max, max->size - 1)) <= x)
+    max->size--;
+
+  MMACC_AT(state, min, min->size) = state->t;
+  min->size++;
+
+  MMACC_AT(state, max, max->size) = state->t;
+  max->size++;
+
+  MMACC_VALUE(state, state->t) = x;
+  state->t++;
+  state->k++;
+
+  return GSL_SUCCESS;
+}
+
+static int
+mmacc_min(void * params, double * result, void * vstate)
+{
+  const mmacc_state_t * state = (const mmacc_state_t *) vstate;
+
+  (void) params;
+
+  if (state->k == 0)
+    {
+      GSL_ERROR ("no samples in window", GSL_EINVAL);
+    }
+
+  result[0] = MMACC_VALUE(state, MMACC_AT(state, &state->min, 0));
+
+  return GSL_SUCCESS;
+}
+
+static int
+mmacc_max(void * params, double * result, void * vstate)
+{
+  const mmacc_state_t * state = (const mmacc_state_t *) vstate;
+
+  (void) params;
+
+  if (state->k == 0)
+    {
+      GSL_ERROR ("no samples in window", GSL_EINVAL);
+    }
+
+  result[0] = MMACC_VALUE(state, MMACC_AT(state, &state->max, 0));
+
+  return GSL_SUCCESS;
+}
+
+static int
+mmacc_minmax(void * params, double * result, void * vstate)
+{
+  const mmacc_state_t * state = (const mmacc_state_t *) vstate;
+
+  (void) params;
+
+  if (state->k == 0)
+    {
+      GSL_ERROR ("no samples in window", GSL_EINVAL);
+    }
+
+  result[0] = MMACC_VALUE(state, MMACC_AT(state, &state->min, 0));
+  result[1] = MMACC_VALUE(state, MMACC_AT(state, &state->max, 0));
+
+  return GSL_SUCCESS;
+}
+
+#undef MMACC_VALUE
+#undef MMACC_AT
+
+static const gsl_movstat_accum min_accum_type =
+{
+  mmacc_size,
+  mmacc_init,
+  mmacc_insert,
+  mmacc_delete,
+  mmacc_min
+};
+
+static const gsl_movstat_accum max_accum_type =
+{
+  mmacc_size,
+  mmacc_init,
+  mmacc_insert,
+  mmacc_delete,
+  mmacc_max
+};
+
+static const gsl_movstat_accum minmax_accum_type =
+{
+  mmacc_size,
+  mmacc_init,
+  mmacc_insert,
+  mmacc_delete,
+  mmacc_minmax
+};
+
+const gsl_movstat_accum *gsl_movstat_accum_min = &min_accum_type;
+const gsl_movstat_accum *gsl_movstat_accum_max = &max_accum_type;
+const gsl_movstat_accum *gsl_movstat_accum_minmax = &minmax_accum_type;
+
+int
+gsl_movstat_min(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_min, NULL, y, NULL, w);
+}
+
+int
+gsl_movstat_max(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_max, NULL, y, NULL, w);
+}
+
+int
+gsl_movstat_minmax(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                   gsl_vector * y_min, gsl_vector * y_max, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_minmax, NULL, y_min, y_max, w);
+}
@@ -0,0 +1,286 @@
+/* movstat/mvacc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module contains the accumulators for the moving mean,
+ * variance, standard deviation and sum. The samples of the window are
+ * kept in a ring buffer, and the mean and sum of squared deviations M2
+ * are updated in O(1) as each sample enters and the oldest one leaves:
+ *
+ *   mean' = mean + (x - y) / k
+ *   M2'   = M2 + (x - y) (x - mean' + y - mean)
+ *
+ * for a sample x replacing y in a window of k samples, and the usual
+ * Welford updates when the window grows or shrinks. Since removing
+ * samples lets rounding errors accumulate, the mean, M2 and sum are
+ * recomputed from the ring buffer after every n updates, which keeps
+ * the cost amortized O(1) per sample.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_movstat.h>
+
+typedef struct
+{
+  size_t n;       /* window size */
+  size_t k;       /* number of samples in window */
+  size_t head;    /* index of oldest sample */
+  size_t nupdate; /* updates since last recomputation */
+  double mean;    /* mean of window */
+  double M2;      /* sum of squared deviations from mean */
+  double sum;     /* sum of window */
+  double *buf;    /* ring buffer of samples, size n */
+} mvacc_state_t;
+
+static void mvacc_refresh(mvacc_state_t * state);
+
+static size_t
+mvacc_size(const size_t n)
+{
+  return sizeof(mvacc_state_t) + n * sizeof(double);
+}
+
+static int
+mvacc_init(const size_t n, void * vstate)
+{
+  mvacc_state_t * state = (mvacc_state_t *) vstate;
+
+  state->n = n;
+  state->k = 0;
+  state->head = 0;
+  state->nupdate = 0;
+  state->mean = 0.0;
+  state->M2 = 0.0;
+  state->sum = 0.0;
+  state->buf = (double *) ((unsigned char *) vstate + sizeof(mvacc_state_t));
+
+  return GSL_SUCCESS;
+}
+
+static int
+mvacc_insert(const double x, void * vstate)
+{
+  mvacc_state_t * state = (mvacc_state_t *) vstate;
+
+  if (state->k == state->n)
+    {
+      /* replace oldest sample y */
+      const double y = state->buf[state->head];
+      const double mean = state->mean;
+
+      state->mean += (x - y) / (double) state->k;
+      state->M2 += (x - y) * (x - state->mean + y - mean);
+      state->sum += x - y;
+
+      state->buf[state->head] = x;
+      state->head = (state->head + 1) % state->n;
+    }
+  else
+    {
+      const double delta = x - state->mean;
+
+      state->buf[(state->head + state->k) % state->n] = x;
+      state->k++;
+
+      state->mean += delta / (double) state->k;
+      state->M2 += delta * (x - state->mean);
+      state->sum += x;
+    }
+
+  if (++state->nupdate >= state->n)
+    mvacc_refresh(state);
+
+  return GSL_SUCCESS;
+}
+
+static int
+mvacc_delete(void * vstate)
+{
+  mvacc_state_t * state = (mvacc_state_t *) vstate;
+
+  if (state->k > 1)
+    {
+      const double y = state->buf[state->head];
+      const double delta = y - state->mean;
+
+      state->head = (state->head + 1) % state->n;
+      state->k--;
+
+      state->mean -= delta / (double) state->k;
+      state->M2 -= delta * (y - state->mean);
+      state->sum -= y;
+
+      if (++state->nupdate >= state->n)
+        mvacc_refresh(state);
+    }
+  else if (state->k == 1)
+    {
+      state->head = (state->head + 1) % state->n;
+      state->k = 0;
+      state->mean = 0.0;
+      state->M2 = 0.0;
+      state->sum = 0.0;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+mvacc_mean(void * params, double * result, void * vstate)
+{
+  const mvacc_state_t * state = (const mvacc_state_t *) vstate;
+
+  (void) params;
+
+  *result = state->mean;
+
+  return GSL_SUCCESS;
+}
+
+static int
+mvacc_variance(void * params, double * result, void * vstate)
+{
+  const mvacc_state_t * state = (const mvacc_state_t *) vstate;
+
+  (void) params;
+
+  if (state->k < 2)
+    *result = 0.0;
+  else
+    *result = GSL_MAX(state->M2, 0.0) / (state->k - 1.0);
+
+  return GSL_SUCCESS;
+}
+
+static int
+mvacc_sd(void * params, double * result, void * vstate)
+{
+  int status = mvacc_variance(params, result, vstate);
+
+  *result = sqrt(*result);
+
+  return status;
+}
+
+static int
+mvacc_sum(void * params, double * result, void * vstate)
+{
+  const mvacc_state_t * state = (const mvacc_state_t *) vstate;
+
+  (void) params;
+
+  *result = state->sum;
+
+  return GSL_SUCCESS;
+}
+
+/* recompute the mean, M2 and sum of the window with two passes */
+static void
+mvacc_refresh(mvacc_state_t * state)
+{
+  double sum = 0.0, M2 = 0.0, mean;
+  size_t i;
+
+  for (i = 0; i < state->k; ++i)
+    sum += state->buf[(state->head + i) % state->n];
+
+  mean = sum / (double) state->k;
+
+  for (i = 0; i < state->k; ++i)
+    {
+      const double delta = state->buf[(state->head + i) % state->n] - mean;
+      M2 += delta * delta;
+    }
+
+  state->sum = sum;
+  state->mean = mean;
+  state->M2 = M2;
+  state->nupdate = 0;
+}
+
+static const gsl_movstat_accum mean_accum_type =
+{
+  mvacc_size,
+  mvacc_init,
+  mvacc_insert,
+  mvacc_delete,
+  mvacc_mean
+};
+
+static const gsl_movstat_accum variance_accum_type =
+{
+  mvacc_size,
+  mvacc_init,
+  mvacc_insert,
+  mvacc_delete,
+  mvacc_variance
+};
+
+static const gsl_movstat_accum sd_accum_type =
+{
+  mvacc_size,
+  mvacc_init,
+  mvacc_insert,
+  mvacc_delete,
+  mvacc_sd
+};
+
+static const gsl_movstat_accum sum_accum_type =
+{
+  mvacc_size,
+  mvacc_init,
+  mvacc_insert,
+  mvacc_delete,
+  mvacc_sum
+};
+
+const gsl_movstat_accum *gsl_movstat_accum_mean = &mean_accum_type;
+const gsl_movstat_accum *gsl_movstat_accum_variance = &variance_accum_type;
+const gsl_movstat_accum *gsl_movstat_accum_sd = &sd_accum_type;
+const gsl_movstat_accum *gsl_movstat_accum_sum = &sum_accum_type;
+
+int
+gsl_movstat_mean(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                 gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_mean, NULL, y, NULL, w);
+}
+
+int
+gsl_movstat_variance(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                     gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_variance, NULL, y, NULL, w);
+}
+
+int
+gsl_movstat_sd(const gsl_movstat_end_t endtype, const gsl_vector * x,
+               gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_sd, NULL, y, NULL, w);
+}
+
+int
+gsl_movstat_sum(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_sum, NULL, y, NULL, w);
+}
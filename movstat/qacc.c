@@ -0,0 +1,298 @@
+/* movstat/qacc.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * This module contains the accumulators for the moving median and
+ * quantiles, using a pair of heaps over the samples of the window
+ * (Hardle and Steiger 1995). The samples are kept in a ring buffer, and
+ * every slot of the ring belongs to one of two heaps: a max-heap "lo"
+ * of the smallest samples and a min-heap "hi" of the largest, with
+ * every sample in lo no larger than every sample in hi. A new sample
+ * goes into whichever heap keeps this ordering, and the oldest sample
+ * is removed from the middle of its heap through a table of heap
+ * positions, so each update takes O(log n) time.
+ *
+ * The quantile q of k samples is found as in gsl_stats_quantile_from_sorted_data,
+ * by interpolating between the samples of rank floor(q(k-1)) and the
+ * next one. Before it is computed the heaps are balanced so that lo
+ * holds floor(q(k-1)) + 1 samples, and the two samples are the tops of
+ * the heaps. Since each update changes the size of one heap by one,
+ * balancing moves at most a few samples between the heaps.
+ */
+
+#include <config.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_movstat.h>
+
+typedef struct
+{
+  size_t n;       /* window size */
+  size_t k;       /* number of samples in window */
+  size_t head;    /* slot of oldest sample */
+  size_t nlo;     /* number of slots in lo */
+  size_t nhi;     /* number of slots in hi */
+  double *buf;    /* ring buffer of samples, size n */
+  size_t *lo;     /* max-heap of slots, size n */
+  size_t *hi;     /* min-heap of slots, size n */
+  size_t *where;  /* where[slot] = 2*position + (1 if in hi), size n */
+} qacc_state_t;
+
+/* compare slots a and b of a heap; true if a should be above b */
+#define QACC_ABOVE(state, ishi, a, b) \
+  ((ishi) ? (state)->buf[a] < (state)->buf[b] : (state)->buf[a] > (state)->buf[b])
+
+static size_t
+qacc_size(const size_t n)
+{
+  return sizeof(qacc_state_t) + n * (sizeof(double) + 3 * sizeof(size_t));
+}
+
+static int
+qacc_init(const size_t n, void * vstate)
+{
+  qacc_state_t * state = (qacc_state_t *) vstate;
+  unsigned char * ptr = (unsigned char *) vstate + sizeof(qacc_state_t);
+
+  state->n = n;
+  state->k = 0;
+  state->head = 0;
+  state->nlo = 0;
+  state->nhi = 0;
+
+  state->buf = (double *) ptr;
+  ptr += n * sizeof(double);
+
+  state->lo = (size_t *) ptr;
+  ptr += n * sizeof(size_t);
+
+  state->hi = (size_t *) ptr;
+  ptr += n * sizeof(size_t);
+
+  state->where = (size_t *) ptr;
+
+  return GSL_SUCCESS;
+}
+
+static void
+qacc_place(qacc_state_t * state, const int ishi, const size_t pos, const size_t slot)
+{
+  size_t * heap = ishi ? state->hi : state->lo;
+
+  heap[pos] = slot;
+  state->where[slot] = 2 * pos + (ishi ? 1 : 0);
+}
+
+/* move the slot at heap position pos up or down to restore the heap */
+static void
+qacc_sift(qacc_state_t * state, const int ishi, size_t pos)
+{
+  size_t * heap = ishi ? state->hi : state->lo;
+  const size_t size = ishi ? state->nhi : state->nlo;
+  const size_t slot = heap[pos];
+
+  while (pos > 0)
+    {
+      const size_t parent = (pos - 1) / 2;
+
+      if (!QACC_ABOVE(state, ishi, slot, heap[parent]))
+        break;
+
+      qacc_place(state, ishi, pos, heap[parent]);
+      pos = parent;
+    }
+
+  while (1)
+    {
+      size_t child = 2 * pos + 1;
+
+      if (child >= size)
+        break;
+
+      if (child + 1 < size && QACC_ABOVE(state, ishi, heap[child + 1], heap[child]))
+        child++;
+
+      if (!QACC_ABOVE(state, ishi, heap[child], slot))
+        break;
+
+      qacc_place(state, ishi, pos, heap[child]);
+      pos = child;
+    }
+
+  qacc_place(state, ishi, pos, slot);
+}
+
+static void
+qacc_push(qacc_state_t * state, const int ishi, const size_t slot)
+{
+  const size_t pos = ishi ? state->nhi++ : state->nlo++;
+
+  qacc_place(state, ishi, pos, slot);
+  qacc_sift(state, ishi, pos);
+}
+
+/* remove the slot at heap position pos and return it */
+static size_t
+qacc_remove(qacc_state_t * state, const int ishi, const size_t pos)
+{
+  size_t * heap = ishi ? state->hi : state->lo;
+  const size_t slot = heap[pos];
+  const size_t last = ishi ? --state->nhi : --state->nlo;
+
+  if (pos != last)
+    {
+      qacc_place(state, ishi, pos, heap[last]);
+      qacc_sift(state, ishi, pos);
+    }
+
+  return slot;
+}
+
+static int
+qacc_delete(void * vstate)
+{
+  qacc_state_t * state = (qacc_state_t *) vstate;
+
+  if (state->k > 0)
+    {
+      const size_t w = state->where[state->head];
+
+      qacc_remove(state, (int) (w & 1), w / 2);
+
+      state->head = (state->head + 1) % state->n;
+      state->k--;
+    }
+
+  return GSL_SUCCESS;
+}
+
+static int
+qacc_insert(const double x, void * vstate)
+{
+  qacc_state_t * state = (qacc_state_t *) vstate;
+  size_t slot;
+  int ishi;
+
+  if (state->k == state->n)
+    qacc_delete(vstate);
+
+  slot = (state->head + state->k) % state->n;
+  state->buf[slot] = x;
+  state->k++;
+
+  if (state->nlo > 0 && x <= state->buf[state->lo[0]])
+    ishi = 0;
+  else if (state->nhi > 0 && x >= state->buf[state->hi[0]])
+    ishi = 1;
+  else
+    ishi = (state->nhi < state->nlo);
+
+  qacc_push(state, ishi, slot);
+
+  return GSL_SUCCESS;
+}
+
+static int
+qacc_get(const double q, double * result, qacc_state_t * state)
+{
+  double index, delta;
+  size_t nlo;
+
+  if (state->k == 0)
+    {
+      GSL_ERROR ("no samples in window", GSL_EINVAL);
+    }
+
+  index = q * (state->k - 1.0);
+  nlo = (size_t) index;
+  delta = index - nlo;
+  ++nlo;
+
+  /* balance the heaps so that the top of lo has rank nlo - 1 */
+  while (state->nlo > nlo)
+    qacc_push(state, 1, qacc_remove(state, 0, 0));
+
+  while (state->nlo < nlo)
+    qacc_push(state, 0, qacc_remove(state, 1, 0));
+
+  result[0] = state->buf[state->lo[0]];
+
+  if (delta > 0.0 && state->nhi > 0)
+    result[0] = (1.0 - delta) * result[0] + delta * state->buf[state->hi[0]];
+
+  return GSL_SUCCESS;
+}
+
+static int
+qacc_median(void * params, double * result, void * vstate)
+{
+  (void) params;
+  return qacc_get(0.5, result, (qacc_state_t *) vstate);
+}
+
+/* the quantile accumulator takes a pointer to q as its parameter */
+static int
+qacc_quantile(void * params, double * result, void * vstate)
+{
+  return qacc_get(*(double *) params, result, (qacc_state_t *) vstate);
+}
+
+#undef QACC_ABOVE
+
+static const gsl_movstat_accum median_accum_type =
+{
+  qacc_size,
+  qacc_init,
+  qacc_insert,
+  qacc_delete,
+  qacc_median
+};
+
+static const gsl_movstat_accum quantile_accum_type =
+{
+  qacc_size,
+  qacc_init,
+  qacc_insert,
+  qacc_delete,
+  qacc_quantile
+};
+
+const gsl_movstat_accum *gsl_movstat_accum_median = &median_accum_type;
+const gsl_movstat_accum *gsl_movstat_accum_quantile = &quantile_accum_type;
+
+int
+gsl_movstat_median(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                   gsl_vector * y, gsl_movstat_workspace * w)
+{
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_median, NULL, y, NULL, w);
+}
+
+int
+gsl_movstat_quantile(const gsl_movstat_end_t endtype, const gsl_vector * x,
+                     const double q, gsl_vector * y, gsl_movstat_workspace * w)
+{
+  double params = q;
+
+  if (!(q >= 0.0 && q <= 1.0))
+    {
+      GSL_ERROR ("quantile must lie in [0,1]", GSL_EDOM);
+    }
+
+  return gsl_movstat_apply_accum(endtype, x, gsl_movstat_accum_quantile, &params, y, NULL, w);
+}
@@ -0,0 +1,299 @@
+/* movstat/test.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_statistics_double.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_movstat.h>
+
+static const char *
+end_str(const gsl_movstat_end_t endtype)
+{
+  switch (endtype)
+    {
+      case GSL_MOVSTAT_END_PADZERO:
+        return "padzero";
+      case GSL_MOVSTAT_END_PADVALUE:
+        return "padvalue";
+      default:
+        return "truncate";
+    }
+}
+
+/* random data; if nlevels > 0 the samples take only nlevels values,
+   to test ties */
+static void
+random_vector(const size_t nlevels, gsl_vector * v, gsl_rng * r)
+{
+  size_t i;
+
+  for (i = 0; i < v->size; ++i)
+    {
+      double x = 2.0 * gsl_rng_uniform(r) - 1.0;
+
+      if (nlevels > 0)
+        x = floor(nlevels * gsl_rng_uniform(r));
+
+      gsl_vector_set(v, i, x);
+    }
+}
+
+/* brute force statistics of a window */
+
+static double
+slow_mean(const size_t n, double x[], void * params)
+{
+  (void) params;
+  return gsl_stats_mean(x, 1, n);
+}
+
+static double
+slow_variance(const size_t n, double x[], void * params)
+{
+  (void) params;
+  return (n > 1) ? gsl_stats_variance(x, 1, n) : 0.0;
+}
+
+static double
+slow_sum(const size_t n, double x[], void * params)
+{
+  double sum = 0.0;
+  size_t i;
+
+  (void) params;
+
+  for (i = 0; i < n; ++i)
+    sum += x[i];
+
+  return sum;
+}
+
+static double
+slow_min(const size_t n, double x[], void * params)
+{
+  (void) params;
+  return gsl_stats_min(x, 1, n);
+}
+
+static double
+slow_max(const size_t n, double x[], void * params)
+{
+  (void) params;
+  return gsl_stats_max(x, 1, n);
+}
+
+static double
+slow_quantile(const size_t n, double x[], void * params)
+{
+  return gsl_stats_quantile(x, 1, n, *(double *) params);
+}
+
+static double
+slow_mad(const size_t n, double x[], void * params)
+{
+  const double median = gsl_stats_median(x, 1, n);
+  size_t i;
+
+  (void) params;
+
+  for (i = 0; i < n; ++i)
+    x[i] = fabs(x[i] - median);
+
+  return 1.482602218505602 * gsl_stats_median(x, 1, n);
+}
+
+/* compute the statistic F of each window of x by brute force */
+static void
+slow_movstat(const gsl_movstat_end_t endtype, const gsl_vector * x,
+             double (*F)(const size_t n, double x[], void * params), void * params,
+             const size_t H, const size_t J, gsl_vector * y)
+{
+  double *window = malloc((H + J + 1) * sizeof(double));
+  size_t i;
+
+  for (i = 0; i < x->size; ++i)
+    {
+      const size_t k = gsl_movstat_fill(endtype, x, i, H, J, window);
+      gsl_vector_set(y, i, F(k, window, params));
+    }
+
+  free(window);
+}
+
+static void
+compare_vectors(const double tol, const gsl_vector * v, const gsl_vector * expected,
+                const char * desc, const size_t n, const size_t H, const size_t J,
+                const gsl_movstat_end_t endtype)
+{
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      const double vi = gsl_vector_get(v, i);
+      const double ei = gsl_vector_get(expected, i);
+
+      gsl_test_rel(vi, ei, tol, "%s n=%zu H=%zu J=%zu %s i=%zu",
+                   desc, n, H, J, end_str(endtype), i);
+    }
+}
+
+static void
+test_movstat(const size_t n, const size_t H, const size_t J, const size_t nlevels,
+             const gsl_movstat_end_t endtype, gsl_rng * r)
+{
+  gsl_movstat_workspace *w = gsl_movstat_alloc2(H, J);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *z = gsl_vector_alloc(n);
+  gsl_vector *expected = gsl_vector_alloc(n);
+  const double tol = 1.0e-10;
+  gsl_movstat_function F;
+  double q;
+
+  random_vector(nlevels, x, r);
+
+  gsl_movstat_mean(endtype, x, y, w);
+  slow_movstat(endtype, x, slow_mean, NULL, H, J, expected);
+  compare_vectors(tol, y, expected, "mean", n, H, J, endtype);
+
+  gsl_movstat_variance(endtype, x, y, w);
+  slow_movstat(endtype, x, slow_variance, NULL, H, J, expected);
+  compare_vectors(tol, y, expected, "variance", n, H, J, endtype);
+
+  gsl_movstat_sum(endtype, x, y, w);
+  slow_movstat(endtype, x, slow_sum, NULL, H, J, expected);
+  compare_vectors(tol, y, expected, "sum", n, H, J, endtype);
+
+  gsl_movstat_minmax(endtype, x, y, z, w);
+  slow_movstat(endtype, x, slow_min, NULL, H, J, expected);
+  compare_vectors(0.0, y, expected, "minmax min", n, H, J, endtype);
+  gsl_movstat_min(endtype, x, y, w);
+  compare_vectors(0.0, y, expected, "min", n, H, J, endtype);
+  slow_movstat(endtype, x, slow_max, NULL, H, J, expected);
+  compare_vectors(0.0, z, expected, "minmax max", n, H, J, endtype);
+  gsl_movstat_max(endtype, x, y, w);
+  compare_vectors(0.0, y, expected, "max", n, H, J, endtype);
+
+  q = 0.5;
+  gsl_movstat_median(endtype, x, y, w);
+  slow_movstat(endtype, x, slow_quantile, &q, H, J, expected);
+  compare_vectors(GSL_DBL_EPSILON, y, expected, "median", n, H, J, endtype);
+
+  for (q = 0.0; q <= 1.0; q += 0.125)
+    {
+      gsl_movstat_quantile(endtype, x, q, y, w);
+      slow_movstat(endtype, x, slow_quantile, &q, H, J, expected);
+      compare_vectors(4.0 * GSL_DBL_EPSILON, y, expected, "quantile", n, H, J, endtype);
+    }
+
+  gsl_movstat_mad(endtype, x, y, z, w);
+  slow_movstat(endtype, x, slow_mad, NULL, H, J, expected);
+  compare_vectors(GSL_DBL_EPSILON, z, expected, "mad", n, H, J, endtype);
+  q = 0.5;
+  slow_movstat(endtype, x, slow_quantile, &q, H, J, expected);
+  compare_vectors(GSL_DBL_EPSILON, y, expected, "mad median", n, H, J, endtype);
+
+  F.function = slow_mean;
+  F.params = NULL;
+  gsl_movstat_apply(endtype, &F, x, y, w);
+  slow_movstat(endtype, x, slow_mean, NULL, H, J, expected);
+  compare_vectors(0.0, y, expected, "apply", n, H, J, endtype);
+
+  /* in-place */
+  q = 0.5;
+  slow_movstat(endtype, x, slow_quantile, &q, H, J, expected);
+  gsl_movstat_median(endtype, x, x, w);
+  compare_vectors(GSL_DBL_EPSILON, x, expected, "median in-place", n, H, J, endtype);
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(z);
+  gsl_vector_free(expected);
+  gsl_movstat_free(w);
+}
+
+/* a long series with a large offset, to check that the running
+   updates of the variance do not drift */
+static void
+test_variance_drift(gsl_rng * r)
+{
+  const size_t n = 100000;
+  const size_t K = 11;
+  gsl_movstat_workspace *w = gsl_movstat_alloc(K);
+  gsl_vector *x = gsl_vector_alloc(n);
+  gsl_vector *y = gsl_vector_alloc(n);
+  gsl_vector *expected = gsl_vector_alloc(n);
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    gsl_vector_set(x, i, 1.0e6 + gsl_rng_uniform(r));
+
+  gsl_movstat_variance(GSL_MOVSTAT_END_TRUNCATE, x, y, w);
+  slow_movstat(GSL_MOVSTAT_END_TRUNCATE, x, slow_variance, NULL, K / 2, K / 2, expected);
+
+  for (i = n - 10; i < n; ++i)
+    {
+      gsl_test_rel(gsl_vector_get(y, i), gsl_vector_get(expected, i), 1.0e-6,
+                   "variance drift i=%zu", i);
+    }
+
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_free(expected);
+  gsl_movstat_free(w);
+}
+
+int
+main()
+{
+  const gsl_movstat_end_t endtypes[] = { GSL_MOVSTAT_END_PADZERO,
+                                         GSL_MOVSTAT_END_PADVALUE,
+                                         GSL_MOVSTAT_END_TRUNCATE };
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  size_t i;
+
+  gsl_ieee_env_setup();
+
+  for (i = 0; i < 3; ++i)
+    {
+      test_movstat(1, 0, 0, 0, endtypes[i], r);
+      test_movstat(1, 3, 2, 0, endtypes[i], r);
+      test_movstat(10, 1, 1, 0, endtypes[i], r);
+      test_movstat(10, 7, 12, 0, endtypes[i], r);
+      test_movstat(50, 0, 4, 0, endtypes[i], r);
+      test_movstat(50, 4, 0, 0, endtypes[i], r);
+      test_movstat(100, 3, 8, 3, endtypes[i], r);
+      test_movstat(500, 10, 10, 0, endtypes[i], r);
+      test_movstat(500, 15, 6, 5, endtypes[i], r);
+      test_movstat(1000, 50, 50, 0, endtypes[i], r);
+    }
+
+  test_variance_drift(r);
+
+  gsl_rng_free(r);
+
+  exit (gsl_test_summary());
+}
@@ -0,0 +1,95 @@
+/* nufft/gsl_nufft.h
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#ifndef __GSL_NUFFT_H__
+#define __GSL_NUFFT_H__
+
+#include <stdlib.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_fft.h>
+#include <gsl/gsl_fft_complex.h>
+
+#undef __BEGIN_DECLS
+#undef __END_DECLS
+#ifdef __cplusplus
+# define __BEGIN_DECLS extern "C" {
+# define __END_DECLS }
+#else
+# define __BEGIN_DECLS /* empty */
+# define __END_DECLS /* empty */
+#endif
+
+__BEGIN_DECLS
+
+typedef struct
+{
+  size_t N;                                   /* number of Fourier modes */
+  size_t n;                                   /* oversampled grid size */
+  size_t nspread;                             /* kernel width in grid points */
+  double beta;                                /* kernel shape parameter */
+  double *correction;                         /* deconvolution factors for |k| = 0..N/2 */
+  double *ker;                                /* kernel values at one point, size nspread */
+  double *grid;                               /* complex packed grid, size n */
+  gsl_fft_complex_wavetable *wavetable;
+  gsl_fft_complex_workspace *workspace;
+} gsl_nufft_workspace;
+
+typedef struct
+{
+  size_t N1;                                  /* number of modes in first dimension */
+  size_t N2;                                  /* number of modes in second dimension */
+  size_t n1;                                  /* oversampled grid rows */
+  size_t n2;                                  /* oversampled grid columns */
+  size_t nspread;                             /* kernel width in grid points */
+  double beta;                                /* kernel shape parameter */
+  double *correction1;                        /* deconvolution factors for |k1| = 0..N1/2 */
+  double *correction2;                        /* deconvolution factors for |k2| = 0..N2/2 */
+  double *ker1;                               /* kernel values in first dimension, size nspread */
+  double *ker2;                               /* kernel values in second dimension, size nspread */
+  double *grid;                               /* complex packed grid, n1-by-n2 row-major */
+  gsl_fft_complex_wavetable *wavetable1;      /* column transforms of length n1 */
+  gsl_fft_complex_wavetable *wavetable2;      /* row transforms of length n2 */
+  gsl_fft_complex_workspace *workspace1;
+  gsl_fft_complex_workspace *workspace2;
+} gsl_nufft2d_workspace;
+
+/* 1D */
+gsl_nufft_workspace *gsl_nufft_alloc(const size_t N, const double tol);
+void gsl_nufft_free(gsl_nufft_workspace * w);
+int gsl_nufft_type1(const gsl_fft_direction sign, const gsl_vector * x,
+                    const gsl_vector_complex * c, gsl_vector_complex * f,
+                    gsl_nufft_workspace * w);
+int gsl_nufft_type2(const gsl_fft_direction sign, const gsl_vector * x,
+                    const gsl_vector_complex * f, gsl_vector_complex * c,
+                    gsl_nufft_workspace * w);
+
+/* 2D */
+gsl_nufft2d_workspace *gsl_nufft2d_alloc(const size_t N1, const size_t N2, const double tol);
+void gsl_nufft2d_free(gsl_nufft2d_workspace * w);
+int gsl_nufft2d_type1(const gsl_fft_direction sign, const gsl_vector * x,
+                      const gsl_vector * y, const gsl_vector_complex * c,
+                      gsl_matrix_complex * F, gsl_nufft2d_workspace * w);
+int gsl_nufft2d_type2(const gsl_fft_direction sign, const gsl_vector * x,
+                      const gsl_vector * y, const gsl_matrix_complex * F,
+                      gsl_vector_complex * c, gsl_nufft2d_workspace * w);
+
+__END_DECLS
+
+#endif /* __GSL_NUFFT_H__ */
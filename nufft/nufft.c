@@ -0,0 +1,282 @@
+/* nufft/nufft.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * One dimensional non-uniform FFT
+ *
+ * type 1: f_k = sum_{j=0}^{M-1} c_j exp(i sign k x_j)
+ * type 2: c_j = sum_k f_k exp(i sign k x_j)
+ *
+ * for the N modes k = -N/2, ..., (N-1)/2 (integer division), stored
+ * in increasing order, so that mode k is element k + N/2 of f.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_integration.h>
+#include <gsl/gsl_nufft.h>
+
+#include "nufft_common.c"
+
+/*
+gsl_nufft_alloc()
+  Allocate a workspace for 1D non-uniform FFTs
+
+Inputs: N   - number of Fourier modes
+        tol - requested relative accuracy, in (0,1)
+
+Return: pointer to workspace
+*/
+
+gsl_nufft_workspace *
+gsl_nufft_alloc(const size_t N, const double tol)
+{
+  gsl_nufft_workspace *w;
+  int status;
+
+  if (N == 0)
+    {
+      GSL_ERROR_NULL ("number of modes must be positive", GSL_EINVAL);
+    }
+  else if (!(tol > 0.0 && tol < 1.0))
+    {
+      GSL_ERROR_NULL ("tolerance must be in (0,1)", GSL_EDOM);
+    }
+
+  w = calloc(1, sizeof(gsl_nufft_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->N = N;
+  w->nspread = nufft_spread_width(tol);
+  w->beta = 2.30 * (double) w->nspread;
+  w->n = nufft_grid_size(GSL_MAX(2 * N, 2 * w->nspread));
+
+  w->correction = malloc((N / 2 + 1) * sizeof(double));
+  if (w->correction == 0)
+    {
+      gsl_nufft_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for correction factors", GSL_ENOMEM);
+    }
+
+  w->ker = malloc(w->nspread * sizeof(double));
+  if (w->ker == 0)
+    {
+      gsl_nufft_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel", GSL_ENOMEM);
+    }
+
+  w->grid = malloc(2 * w->n * sizeof(double));
+  if (w->grid == 0)
+    {
+      gsl_nufft_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for grid", GSL_ENOMEM);
+    }
+
+  w->wavetable = gsl_fft_complex_wavetable_alloc(w->n);
+  w->workspace = gsl_fft_complex_workspace_alloc(w->n);
+  if (w->wavetable == 0 || w->workspace == 0)
+    {
+      gsl_nufft_free(w);
+      GSL_ERROR_NULL ("failed to allocate FFT workspace", GSL_ENOMEM);
+    }
+
+  status = nufft_correction(N, w->n, w->nspread, w->beta, w->correction);
+  if (status)
+    {
+      gsl_nufft_free(w);
+      GSL_ERROR_NULL ("failed to compute correction factors", status);
+    }
+
+  return w;
+}
+
+void
+gsl_nufft_free(gsl_nufft_workspace * w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->correction)
+    free(w->correction);
+
+  if (w->ker)
+    free(w->ker);
+
+  if (w->grid)
+    free(w->grid);
+
+  if (w->wavetable)
+    gsl_fft_complex_wavetable_free(w->wavetable);
+
+  if (w->workspace)
+    gsl_fft_complex_workspace_free(w->workspace);
+
+  free(w);
+}
+
+/*
+gsl_nufft_type1()
+  Compute the Fourier coefficients of a sum of point sources
+
+f_k = sum_j c_j exp(i sign k x_j)
+
+Inputs: sign - gsl_fft_forward (-1) or gsl_fft_backward (+1)
+        x    - non-uniform points, size M
+        c    - strengths, size M
+        f    - (output) modes k = -N/2, ..., (N-1)/2, size N
+        w    - workspace
+*/
+
+int
+gsl_nufft_type1(const gsl_fft_direction sign, const gsl_vector * x,
+                const gsl_vector_complex * c, gsl_vector_complex * f,
+                gsl_nufft_workspace * w)
+{
+  if (x->size != c->size)
+    {
+      GSL_ERROR("x and c vectors must have the same length", GSL_EBADLEN);
+    }
+  else if (f->size != w->N)
+    {
+      GSL_ERROR("f vector does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = w->n;
+      const size_t N = w->N;
+      const size_t nspread = w->nspread;
+      double *grid = w->grid;
+      size_t i, j;
+
+      for (i = 0; i < 2 * n; ++i)
+        grid[i] = 0.0;
+
+      /* spread each point onto the grid */
+      for (j = 0; j < x->size; ++j)
+        {
+          const double cr = c->data[2 * j * c->stride];
+          const double ci = c->data[2 * j * c->stride + 1];
+          size_t l = nufft_kernel(gsl_vector_get(x, j), n, nspread, w->beta, w->ker);
+
+          for (i = 0; i < nspread; ++i)
+            {
+              grid[2 * l] += w->ker[i] * cr;
+              grid[2 * l + 1] += w->ker[i] * ci;
+
+              if (++l == n)
+                l = 0;
+            }
+        }
+
+      gsl_fft_complex_transform(grid, 1, n, w->wavetable, w->workspace, sign);
+
+      /* extract and deconvolve the central modes */
+      for (i = 0; i < N; ++i)
+        {
+          const size_t kabs = (i >= N / 2) ? i - N / 2 : N / 2 - i;
+          const size_t l = (i >= N / 2) ? kabs : n - kabs;
+          const double s = w->correction[kabs];
+
+          f->data[2 * i * f->stride] = s * grid[2 * l];
+          f->data[2 * i * f->stride + 1] = s * grid[2 * l + 1];
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_nufft_type2()
+  Evaluate a Fourier series at non-uniform points
+
+c_j = sum_k f_k exp(i sign k x_j)
+
+Inputs: sign - gsl_fft_forward (-1) or gsl_fft_backward (+1)
+        x    - non-uniform points, size M
+        f    - modes k = -N/2, ..., (N-1)/2, size N
+        c    - (output) values at points x, size M
+        w    - workspace
+*/
+
+int
+gsl_nufft_type2(const gsl_fft_direction sign, const gsl_vector * x,
+                const gsl_vector_complex * f, gsl_vector_complex * c,
+                gsl_nufft_workspace * w)
+{
+  if (x->size != c->size)
+    {
+      GSL_ERROR("x and c vectors must have the same length", GSL_EBADLEN);
+    }
+  else if (f->size != w->N)
+    {
+      GSL_ERROR("f vector does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n = w->n;
+      const size_t N = w->N;
+      const size_t nspread = w->nspread;
+      double *grid = w->grid;
+      size_t i, j;
+
+      for (i = 0; i < 2 * n; ++i)
+        grid[i] = 0.0;
+
+      /* place the pre-corrected modes on the grid */
+      for (i = 0; i < N; ++i)
+        {
+          const size_t kabs = (i >= N / 2) ? i - N / 2 : N / 2 - i;
+          const size_t l = (i >= N / 2) ? kabs : n - kabs;
+          const double s = w->correction[kabs];
+
+          grid[2 * l] = s * f->data[2 * i * f->stride];
+          grid[2 * l + 1] = s * f->data[2 * i * f->stride + 1];
+        }
+
+      gsl_fft_complex_transform(grid, 1, n, w->wavetable, w->workspace, sign);
+
+      /* interpolate the grid at each point */
+      for (j = 0; j < x->size; ++j)
+        {
+          size_t l = nufft_kernel(gsl_vector_get(x, j), n, nspread, w->beta, w->ker);
+          double sr = 0.0, si = 0.0;
+
+          for (i = 0; i < nspread; ++i)
+            {
+              sr += w->ker[i] * grid[2 * l];
+              si += w->ker[i] * grid[2 * l + 1];
+
+              if (++l == n)
+                l = 0;
+            }
+
+          c->data[2 * j * c->stride] = sr;
+          c->data[2 * j * c->stride + 1] = si;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
@@ -0,0 +1,389 @@
+/* nufft/nufft2d.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Two dimensional non-uniform FFT
+ *
+ * type 1: F_{k1,k2} = sum_{j=0}^{M-1} c_j exp(i sign (k1 x_j + k2 y_j))
+ * type 2: c_j = sum_{k1,k2} F_{k1,k2} exp(i sign (k1 x_j + k2 y_j))
+ *
+ * with the same mode ordering as the 1D routines along each dimension
+ * of F. The kernel is the tensor product of the 1D kernels. Only N2 of
+ * the n2 grid columns carry modes which are used, so the transforms
+ * along the first dimension are restricted to those columns.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_fft_complex.h>
+#include <gsl/gsl_integration.h>
+#include <gsl/gsl_nufft.h>
+
+#include "nufft_common.c"
+
+static void nufft2d_rows(const gsl_fft_direction sign, gsl_nufft2d_workspace * w);
+static void nufft2d_columns(const gsl_fft_direction sign, gsl_nufft2d_workspace * w);
+
+/*
+gsl_nufft2d_alloc()
+  Allocate a workspace for 2D non-uniform FFTs
+
+Inputs: N1  - number of Fourier modes in first dimension
+        N2  - number of Fourier modes in second dimension
+        tol - requested relative accuracy, in (0,1)
+
+Return: pointer to workspace
+*/
+
+gsl_nufft2d_workspace *
+gsl_nufft2d_alloc(const size_t N1, const size_t N2, const double tol)
+{
+  gsl_nufft2d_workspace *w;
+  int status;
+
+  if (N1 == 0 || N2 == 0)
+    {
+      GSL_ERROR_NULL ("number of modes must be positive", GSL_EINVAL);
+    }
+  else if (!(tol > 0.0 && tol < 1.0))
+    {
+      GSL_ERROR_NULL ("tolerance must be in (0,1)", GSL_EDOM);
+    }
+
+  w = calloc(1, sizeof(gsl_nufft2d_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->N1 = N1;
+  w->N2 = N2;
+  w->nspread = nufft_spread_width(tol);
+  w->beta = 2.30 * (double) w->nspread;
+  w->n1 = nufft_grid_size(GSL_MAX(2 * N1, 2 * w->nspread));
+  w->n2 = nufft_grid_size(GSL_MAX(2 * N2, 2 * w->nspread));
+
+  w->correction1 = malloc((N1 / 2 + 1) * sizeof(double));
+  w->correction2 = malloc((N2 / 2 + 1) * sizeof(double));
+  if (w->correction1 == 0 || w->correction2 == 0)
+    {
+      gsl_nufft2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for correction factors", GSL_ENOMEM);
+    }
+
+  w->ker1 = malloc(w->nspread * sizeof(double));
+  w->ker2 = malloc(w->nspread * sizeof(double));
+  if (w->ker1 == 0 || w->ker2 == 0)
+    {
+      gsl_nufft2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for kernel", GSL_ENOMEM);
+    }
+
+  w->grid = malloc(2 * w->n1 * w->n2 * sizeof(double));
+  if (w->grid == 0)
+    {
+      gsl_nufft2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for grid", GSL_ENOMEM);
+    }
+
+  w->wavetable1 = gsl_fft_complex_wavetable_alloc(w->n1);
+  w->wavetable2 = gsl_fft_complex_wavetable_alloc(w->n2);
+  w->workspace1 = gsl_fft_complex_workspace_alloc(w->n1);
+  w->workspace2 = gsl_fft_complex_workspace_alloc(w->n2);
+  if (w->wavetable1 == 0 || w->wavetable2 == 0 ||
+      w->workspace1 == 0 || w->workspace2 == 0)
+    {
+      gsl_nufft2d_free(w);
+      GSL_ERROR_NULL ("failed to allocate FFT workspace", GSL_ENOMEM);
+    }
+
+  status = nufft_correction(N1, w->n1, w->nspread, w->beta, w->correction1);
+  if (status == GSL_SUCCESS)
+    status = nufft_correction(N2, w->n2, w->nspread, w->beta, w->correction2);
+
+  if (status)
+    {
+      gsl_nufft2d_free(w);
+      GSL_ERROR_NULL ("failed to compute correction factors", status);
+    }
+
+  return w;
+}
+
+void
+gsl_nufft2d_free(gsl_nufft2d_workspace * w)
+{
+  RETURN_IF_NULL(w);
+
+  if (w->correction1)
+    free(w->correction1);
+
+  if (w->correction2)
+    free(w->correction2);
+
+  if (w->ker1)
+    free(w->ker1);
+
+  if (w->ker2)
+    free(w->ker2);
+
+  if (w->grid)
+    free(w->grid);
+
+  if (w->wavetable1)
+    gsl_fft_complex_wavetable_free(w->wavetable1);
+
+  if (w->wavetable2)
+    gsl_fft_complex_wavetable_free(w->wavetable2);
+
+  if (w->workspace1)
+    gsl_fft_complex_workspace_free(w->workspace1);
+
+  if (w->workspace2)
+    gsl_fft_complex_workspace_free(w->workspace2);
+
+  free(w);
+}
+
+/*
+gsl_nufft2d_type1()
+  Compute the 2D Fourier coefficients of a sum of point sources
+
+F_{k1,k2} = sum_j c_j exp(i sign (k1 x_j + k2 y_j))
+
+Inputs: sign - gsl_fft_forward (-1) or gsl_fft_backward (+1)
+        x    - first coordinates of points, size M
+        y    - second coordinates of points, size M
+        c    - strengths, size M
+        F    - (output) modes, N1-by-N2; element (i1,i2) is the
+               mode (i1 - N1/2, i2 - N2/2)
+        w    - workspace
+*/
+
+int
+gsl_nufft2d_type1(const gsl_fft_direction sign, const gsl_vector * x,
+                  const gsl_vector * y, const gsl_vector_complex * c,
+                  gsl_matrix_complex * F, gsl_nufft2d_workspace * w)
+{
+  if (x->size != c->size || y->size != c->size)
+    {
+      GSL_ERROR("x, y and c vectors must have the same length", GSL_EBADLEN);
+    }
+  else if (F->size1 != w->N1 || F->size2 != w->N2)
+    {
+      GSL_ERROR("F matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n1 = w->n1;
+      const size_t n2 = w->n2;
+      const size_t N1 = w->N1;
+      const size_t N2 = w->N2;
+      const size_t nspread = w->nspread;
+      double *grid = w->grid;
+      size_t i, j, a, b;
+
+      for (i = 0; i < 2 * n1 * n2; ++i)
+        grid[i] = 0.0;
+
+      /* spread each point onto the grid */
+      for (j = 0; j < x->size; ++j)
+        {
+          const double cr = c->data[2 * j * c->stride];
+          const double ci = c->data[2 * j * c->stride + 1];
+          size_t l1 = nufft_kernel(gsl_vector_get(x, j), n1, nspread, w->beta, w->ker1);
+          const size_t l20 = nufft_kernel(gsl_vector_get(y, j), n2, nspread, w->beta, w->ker2);
+
+          for (a = 0; a < nspread; ++a)
+            {
+              const double vr = w->ker1[a] * cr;
+              const double vi = w->ker1[a] * ci;
+              double *row = grid + 2 * l1 * n2;
+              size_t l2 = l20;
+
+              for (b = 0; b < nspread; ++b)
+                {
+                  row[2 * l2] += w->ker2[b] * vr;
+                  row[2 * l2 + 1] += w->ker2[b] * vi;
+
+                  if (++l2 == n2)
+                    l2 = 0;
+                }
+
+              if (++l1 == n1)
+                l1 = 0;
+            }
+        }
+
+      nufft2d_rows(sign, w);
+      nufft2d_columns(sign, w);
+
+      /* extract and deconvolve the central modes */
+      for (i = 0; i < N1; ++i)
+        {
+          const size_t k1 = (i >= N1 / 2) ? i - N1 / 2 : N1 / 2 - i;
+          const size_t l1 = (i >= N1 / 2) ? k1 : n1 - k1;
+
+          for (j = 0; j < N2; ++j)
+            {
+              const size_t k2 = (j >= N2 / 2) ? j - N2 / 2 : N2 / 2 - j;
+              const size_t l2 = (j >= N2 / 2) ? k2 : n2 - k2;
+              const double s = w->correction1[k1] * w->correction2[k2];
+              double *Fij = F->data + 2 * (i * F->tda + j);
+
+              Fij[0] = s * grid[2 * (l1 * n2 + l2)];
+              Fij[1] = s * grid[2 * (l1 * n2 + l2) + 1];
+            }
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/*
+gsl_nufft2d_type2()
+  Evaluate a 2D Fourier series at non-uniform points
+
+c_j = sum_{k1,k2} F_{k1,k2} exp(i sign (k1 x_j + k2 y_j))
+
+Inputs: sign - gsl_fft_forward (-1) or gsl_fft_backward (+1)
+        x    - first coordinates of points, size M
+        y    - second coordinates of points, size M
+        F    - modes, N1-by-N2, ordered as in gsl_nufft2d_type1
+        c    - (output) values at points, size M
+        w    - workspace
+*/
+
+int
+gsl_nufft2d_type2(const gsl_fft_direction sign, const gsl_vector * x,
+                  const gsl_vector * y, const gsl_matrix_complex * F,
+                  gsl_vector_complex * c, gsl_nufft2d_workspace * w)
+{
+  if (x->size != c->size || y->size != c->size)
+    {
+      GSL_ERROR("x, y and c vectors must have the same length", GSL_EBADLEN);
+    }
+  else if (F->size1 != w->N1 || F->size2 != w->N2)
+    {
+      GSL_ERROR("F matrix does not match workspace", GSL_EBADLEN);
+    }
+  else
+    {
+      const size_t n1 = w->n1;
+      const size_t n2 = w->n2;
+      const size_t N1 = w->N1;
+      const size_t N2 = w->N2;
+      const size_t nspread = w->nspread;
+      double *grid = w->grid;
+      size_t i, j, a, b;
+
+      for (i = 0; i < 2 * n1 * n2; ++i)
+        grid[i] = 0.0;
+
+      /* place the pre-corrected modes on the grid */
+      for (i = 0; i < N1; ++i)
+        {
+          const size_t k1 = (i >= N1 / 2) ? i - N1 / 2 : N1 / 2 - i;
+          const size_t l1 = (i >= N1 / 2) ? k1 : n1 - k1;
+
+          for (j = 0; j < N2; ++j)
+            {
+              const size_t k2 = (j >= N2 / 2) ? j - N2 / 2 : N2 / 2 - j;
+              const size_t l2 = (j >= N2 / 2) ? k2 : n2 - k2;
+              const double s = w->correction1[k1] * w->correction2[k2];
+              const double *Fij = F->data + 2 * (i * F->tda + j);
+
+              grid[2 * (l1 * n2 + l2)] = s * Fij[0];
+              grid[2 * (l1 * n2 + l2) + 1] = s * Fij[1];
+            }
+        }
+
+      nufft2d_columns(sign, w);
+      nufft2d_rows(sign, w);
+
+      /* interpolate the grid at each point */
+      for (j = 0; j < x->size; ++j)
+        {
+          size_t l1 = nufft_kernel(gsl_vector_get(x, j), n1, nspread, w->beta, w->ker1);
+          const size_t l20 = nufft_kernel(gsl_vector_get(y, j), n2, nspread, w->beta, w->ker2);
+          double sr = 0.0, si = 0.0;
+
+          for (a = 0; a < nspread; ++a)
+            {
+              const double *row = grid + 2 * l1 * n2;
+              double tr = 0.0, ti = 0.0;
+              size_t l2 = l20;
+
+              for (b = 0; b < nspread; ++b)
+                {
+                  tr += w->ker2[b] * row[2 * l2];
+                  ti += w->ker2[b] * row[2 * l2 + 1];
+
+                  if (++l2 == n2)
+                    l2 = 0;
+                }
+
+              sr += w->ker1[a] * tr;
+              si += w->ker1[a] * ti;
+
+              if (++l1 == n1)
+                l1 = 0;
+            }
+
+          c->data[2 * j * c->stride] = sr;
+          c->data[2 * j * c->stride + 1] = si;
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* transform all rows of the grid (second dimension) */
+static void
+nufft2d_rows(const gsl_fft_direction sign, gsl_nufft2d_workspace * w)
+{
+  const size_t n2 = w->n2;
+  size_t i;
+
+  for (i = 0; i < w->n1; ++i)
+    gsl_fft_complex_transform(w->grid + 2 * i * n2, 1, n2, w->wavetable2, w->workspace2, sign);
+}
+
+/* transform the columns of the grid (first dimension) holding the
+ * modes |k2| <= N2/2 */
+static void
+nufft2d_columns(const gsl_fft_direction sign, gsl_nufft2d_workspace * w)
+{
+  const size_t n2 = w->n2;
+  const size_t N2 = w->N2;
+  size_t j;
+
+  for (j = 0; j < N2; ++j)
+    {
+      const size_t k2 = (j >= N2 / 2) ? j - N2 / 2 : N2 / 2 - j;
+      const size_t l2 = (j >= N2 / 2) ? k2 : n2 - k2;
+
+      gsl_fft_complex_transform(w->grid + 2 * l2, n2, w->n1, w->wavetable1, w->workspace1, sign);
+    }
+}
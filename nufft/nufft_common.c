@@ -0,0 +1,201 @@
+/* nufft/nufft_common.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/*
+ * Routines shared by the 1D and 2D transforms.
+ *
+ * Each non-uniform point x is spread onto (or interpolated from) an
+ * oversampled grid of n >= 2N points with spacing h = 2 pi / n, using
+ * the "exponential of semicircle" kernel
+ *
+ *   phi(z) = exp(beta (sqrt(1 - z^2) - 1)),   |z| <= 1
+ *
+ * scaled to a width of nspread grid points. The uniform FFT of the
+ * grid then approximates the desired sums multiplied by the Fourier
+ * transform of the kernel, which is divided out at the end (type 1) or
+ * beforehand (type 2). The parameters follow
+ *
+ * Barnett, Magland and af Klinteberg, "A parallel non-uniform fast
+ * Fourier transform library based on an exponential of semicircle
+ * kernel", SIAM J. Sci. Comput. 41 (2019), C479-C504.
+ */
+
+#define NUFFT_MAX_SPREAD 16
+
+/* kernel width in grid points needed for a relative tolerance tol */
+static size_t
+nufft_spread_width(const double tol)
+{
+  double d = ceil(-log10(tol)) + 1.0;
+
+  if (d < 2.0)
+    d = 2.0;
+  else if (d > NUFFT_MAX_SPREAD)
+    d = NUFFT_MAX_SPREAD;
+
+  return (size_t) d;
+}
+
+/* smallest even integer >= nmin with no prime factors other than
+ * 2, 3 and 5, which the mixed-radix FFT handles efficiently */
+static size_t
+nufft_grid_size(const size_t nmin)
+{
+  size_t n = nmin + (nmin % 2);
+
+  while (1)
+    {
+      size_t m = n;
+
+      while (m % 2 == 0)
+        m /= 2;
+      while (m % 3 == 0)
+        m /= 3;
+      while (m % 5 == 0)
+        m /= 5;
+
+      if (m == 1)
+        return n;
+
+      n += 2;
+    }
+}
+
+static double
+nufft_phi(const double z, const double beta)
+{
+  const double t = 1.0 - z * z;
+
+  if (t <= 0.0)
+    return 0.0;
+
+  return exp(beta * (sqrt(t) - 1.0));
+}
+
+/*
+nufft_correction()
+  Compute the deconvolution factors for the modes |k| = 0, ..., N/2.
+
+With alpha = pi * nspread / n, the Fourier transform of the scaled
+kernel at frequency k is proportional to
+
+p(k) = 2 int_0^1 phi(z) cos(k alpha z) dz
+
+which is computed by Gauss-Legendre quadrature. The factor returned
+also absorbs the grid spacing, so that the mode k of the final result
+is correction[|k|] times mode k of the grid FFT.
+
+Inputs: N          - number of modes
+        n          - grid size
+        nspread    - kernel width
+        beta       - kernel shape parameter
+        correction - (output) factors, size N/2 + 1
+
+Return: success/error
+*/
+
+static int
+nufft_correction(const size_t N, const size_t n, const size_t nspread,
+                 const double beta, double *correction)
+{
+  const size_t q = 2 * nspread + 8;
+  const double alpha = M_PI * (double) nspread / (double) n;
+  gsl_integration_glfixed_table *t = gsl_integration_glfixed_table_alloc(q);
+  double *z, *wphi;
+  size_t i, k;
+
+  if (t == 0)
+    {
+      GSL_ERROR("failed to allocate quadrature table", GSL_ENOMEM);
+    }
+
+  z = malloc(2 * q * sizeof(double));
+  if (z == 0)
+    {
+      gsl_integration_glfixed_table_free(t);
+      GSL_ERROR("failed to allocate quadrature nodes", GSL_ENOMEM);
+    }
+
+  wphi = z + q;
+
+  for (i = 0; i < q; ++i)
+    {
+      double wi;
+
+      gsl_integration_glfixed_point(0.0, 1.0, i, &z[i], &wi, t);
+      wphi[i] = wi * nufft_phi(z[i], beta);
+    }
+
+  for (k = 0; k <= N / 2; ++k)
+    {
+      double p = 0.0;
+
+      for (i = 0; i < q; ++i)
+        p += wphi[i] * cos((double) k * alpha * z[i]);
+
+      correction[k] = 1.0 / ((double) nspread * p);
+    }
+
+  free(z);
+  gsl_integration_glfixed_table_free(t);
+
+  return GSL_SUCCESS;
+}
+
+/*
+nufft_kernel()
+  Evaluate the kernel weights of a point on the grid
+
+Inputs: x       - point, any real value; it is taken modulo 2 pi
+        n       - grid size
+        nspread - kernel width
+        beta    - kernel shape parameter
+        ker     - (output) weights of grid points l0, ..., l0 + nspread - 1
+                  (modulo n), size nspread
+
+Return: index l0 of the first grid point, in [0, n)
+*/
+
+static size_t
+nufft_kernel(const double x, const size_t n, const size_t nspread,
+             const double beta, double *ker)
+{
+  const double half = 0.5 * (double) nspread;
+  double t = x / (2.0 * M_PI);
+  double u, first;
+  size_t i, l0;
+
+  /* grid coordinate of x in [0, n) */
+  t -= floor(t);
+  u = t * (double) n;
+  if (u >= (double) n)
+    u -= (double) n;
+
+  first = ceil(u - half);
+
+  for (i = 0; i < nspread; ++i)
+    ker[i] = nufft_phi((first + (double) i - u) / half, beta);
+
+  /* first >= -half > -n */
+  l0 = (size_t) (first + (double) n);
+  if (l0 >= n)
+    l0 -= n;
+
+  return l0;
+}
@@ -0,0 +1,234 @@
+/* nufft/test.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_matrix.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_test.h>
+#include <gsl/gsl_ieee_utils.h>
+#include <gsl/gsl_nufft.h>
+
+static void
+random_points(const double range, gsl_vector * x, gsl_rng * r)
+{
+  size_t i;
+
+  for (i = 0; i < x->size; ++i)
+    gsl_vector_set(x, i, range * M_PI * (2.0 * gsl_rng_uniform(r) - 1.0));
+}
+
+static void
+random_vector_complex(gsl_vector_complex * v, gsl_rng * r)
+{
+  size_t i;
+
+  for (i = 0; i < 2 * v->size; ++i)
+    v->data[i] = 2.0 * gsl_rng_uniform(r) - 1.0;
+}
+
+/* relative 2-norm error of n complex values */
+static double
+rel_error(const size_t n, const double * a, const double * b)
+{
+  double num = 0.0, den = 0.0;
+  size_t i;
+
+  for (i = 0; i < 2 * n; ++i)
+    {
+      num += (a[i] - b[i]) * (a[i] - b[i]);
+      den += b[i] * b[i];
+    }
+
+  return sqrt(num / den);
+}
+
+/* direct evaluation of 1D type 1 (type = 1) or type 2 (type = 2) sums */
+static void
+slow_nufft(const int type, const int sign, const gsl_vector * x,
+           const gsl_vector_complex * in, gsl_vector_complex * out)
+{
+  const size_t N = (type == 1) ? out->size : in->size;
+  size_t i, j;
+
+  for (i = 0; i < 2 * out->size; ++i)
+    out->data[i] = 0.0;
+
+  for (j = 0; j < x->size; ++j)
+    {
+      for (i = 0; i < N; ++i)
+        {
+          const double k = (double) i - (double) (N / 2);
+          const double theta = sign * k * gsl_vector_get(x, j);
+          const double cs = cos(theta), sn = sin(theta);
+          const size_t p = (type == 1) ? j : i;
+          const size_t q = (type == 1) ? i : j;
+          const double re = in->data[2 * p], im = in->data[2 * p + 1];
+
+          out->data[2 * q] += re * cs - im * sn;
+          out->data[2 * q + 1] += re * sn + im * cs;
+        }
+    }
+}
+
+static void
+slow_nufft2d(const int type, const int sign, const gsl_vector * x, const gsl_vector * y,
+             const size_t N1, const size_t N2, const double * in, double * out)
+{
+  const size_t M = x->size;
+  size_t i1, i2, j;
+
+  for (i1 = 0; i1 < 2 * ((type == 1) ? N1 * N2 : M); ++i1)
+    out[i1] = 0.0;
+
+  for (j = 0; j < M; ++j)
+    {
+      for (i1 = 0; i1 < N1; ++i1)
+        {
+          for (i2 = 0; i2 < N2; ++i2)
+            {
+              const double k1 = (double) i1 - (double) (N1 / 2);
+              const double k2 = (double) i2 - (double) (N2 / 2);
+              const double theta = sign * (k1 * gsl_vector_get(x, j) + k2 * gsl_vector_get(y, j));
+              const double cs = cos(theta), sn = sin(theta);
+              const size_t p = (type == 1) ? j : i1 * N2 + i2;
+              const size_t q = (type == 1) ? i1 * N2 + i2 : j;
+              const double re = in[2 * p], im = in[2 * p + 1];
+
+              out[2 * q] += re * cs - im * sn;
+              out[2 * q + 1] += re * sn + im * cs;
+            }
+        }
+    }
+}
+
+static void
+test_nufft(const size_t N, const size_t M, const double tol, const double range, gsl_rng * r)
+{
+  gsl_nufft_workspace *w = gsl_nufft_alloc(N, tol);
+  gsl_vector *x = gsl_vector_alloc(M);
+  gsl_vector_complex *c = gsl_vector_complex_alloc(M);
+  gsl_vector_complex *c_expected = gsl_vector_complex_alloc(M);
+  gsl_vector_complex *f = gsl_vector_complex_alloc(N);
+  gsl_vector_complex *f_expected = gsl_vector_complex_alloc(N);
+  const int signs[] = { gsl_fft_forward, gsl_fft_backward };
+  size_t s;
+
+  random_points(range, x, r);
+
+  for (s = 0; s < 2; ++s)
+    {
+      random_vector_complex(c, r);
+      slow_nufft(1, signs[s], x, c, f_expected);
+      gsl_nufft_type1(signs[s], x, c, f, w);
+      gsl_test(rel_error(N, f->data, f_expected->data) > 10.0 * tol,
+               "nufft type1 N=%zu M=%zu tol=%g sign=%d error=%e",
+               N, M, tol, signs[s], rel_error(N, f->data, f_expected->data));
+
+      random_vector_complex(f, r);
+      slow_nufft(2, signs[s], x, f, c_expected);
+      gsl_nufft_type2(signs[s], x, f, c, w);
+      gsl_test(rel_error(M, c->data, c_expected->data) > 10.0 * tol,
+               "nufft type2 N=%zu M=%zu tol=%g sign=%d error=%e",
+               N, M, tol, signs[s], rel_error(M, c->data, c_expected->data));
+    }
+
+  gsl_nufft_free(w);
+  gsl_vector_free(x);
+  gsl_vector_complex_free(c);
+  gsl_vector_complex_free(c_expected);
+  gsl_vector_complex_free(f);
+  gsl_vector_complex_free(f_expected);
+}
+
+static void
+test_nufft2d(const size_t N1, const size_t N2, const size_t M, const double tol, gsl_rng * r)
+{
+  gsl_nufft2d_workspace *w = gsl_nufft2d_alloc(N1, N2, tol);
+  gsl_vector *x = gsl_vector_alloc(M);
+  gsl_vector *y = gsl_vector_alloc(M);
+  gsl_vector_complex *c = gsl_vector_complex_alloc(M);
+  gsl_vector_complex *c_expected = gsl_vector_complex_alloc(M);
+  gsl_matrix_complex *F = gsl_matrix_complex_alloc(N1, N2);
+  gsl_matrix_complex *F_expected = gsl_matrix_complex_alloc(N1, N2);
+  const int signs[] = { gsl_fft_forward, gsl_fft_backward };
+  size_t s, i;
+
+  random_points(1.0, x, r);
+  random_points(1.0, y, r);
+
+  for (s = 0; s < 2; ++s)
+    {
+      random_vector_complex(c, r);
+      slow_nufft2d(1, signs[s], x, y, N1, N2, c->data, F_expected->data);
+      gsl_nufft2d_type1(signs[s], x, y, c, F, w);
+      gsl_test(rel_error(N1 * N2, F->data, F_expected->data) > 10.0 * tol,
+               "nufft2d type1 N=%zu,%zu M=%zu tol=%g sign=%d error=%e",
+               N1, N2, M, tol, signs[s], rel_error(N1 * N2, F->data, F_expected->data));
+
+      for (i = 0; i < 2 * N1 * N2; ++i)
+        F->data[i] = 2.0 * gsl_rng_uniform(r) - 1.0;
+
+      slow_nufft2d(2, signs[s], x, y, N1, N2, F->data, c_expected->data);
+      gsl_nufft2d_type2(signs[s], x, y, F, c, w);
+      gsl_test(rel_error(M, c->data, c_expected->data) > 10.0 * tol,
+               "nufft2d type2 N=%zu,%zu M=%zu tol=%g sign=%d error=%e",
+               N1, N2, M, tol, signs[s], rel_error(M, c->data, c_expected->data));
+    }
+
+  gsl_nufft2d_free(w);
+  gsl_vector_free(x);
+  gsl_vector_free(y);
+  gsl_vector_complex_free(c);
+  gsl_vector_complex_free(c_expected);
+  gsl_matrix_complex_free(F);
+  gsl_matrix_complex_free(F_expected);
+}
+
+int
+main()
+{
+  const double tols[] = { 1.0e-3, 1.0e-6, 1.0e-9, 1.0e-12 };
+  gsl_rng *r = gsl_rng_alloc(gsl_rng_default);
+  size_t i;
+
+  gsl_ieee_env_setup();
+
+  for (i = 0; i < 4; ++i)
+    {
+      test_nufft(1, 10, tols[i], 1.0, r);
+      test_nufft(2, 1, tols[i], 1.0, r);
+      test_nufft(7, 30, tols[i], 1.0, r);
+      test_nufft(64, 200, tols[i], 1.0, r);
+      test_nufft(101, 500, tols[i], 1.0, r);
+      test_nufft(300, 1000, tols[i], 3.0, r);
+
+      test_nufft2d(1, 1, 5, tols[i], r);
+      test_nufft2d(8, 13, 100, tols[i], r);
+      test_nufft2d(32, 25, 400, tols[i], r);
+    }
+
+  gsl_rng_free(r);
+
+  exit (gsl_test_summary());
+}
@@ -7,6 +7,7 @@
 #include <gsl/gsl_types.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_inline.h>
+#include <gsl/gsl_rng.h>
 
 #undef __BEGIN_DECLS
 #undef __END_DECLS
@@ -32,6 +33,8 @@ typedef struct
   size_t (*state_size) (unsigned int dimension);
   int (*init_state) (void * state, unsigned int dimension);
   int (*get) (void * state, unsigned int dimension, double x[]);
+  int (*skip) (void * state, unsigned int dimension, size_t n);
+  int (*scramble) (void * state, unsigned int dimension, const gsl_rng * r);
 }
 gsl_qrng_type;
 
@@ -53,6 +56,7 @@ gsl_qrng;
  */
 GSL_VAR const gsl_qrng_type * gsl_qrng_niederreiter_2;
 GSL_VAR const gsl_qrng_type * gsl_qrng_sobol;
+GSL_VAR const gsl_qrng_type * gsl_qrng_sobol_jk;
 GSL_VAR const gsl_qrng_type * gsl_qrng_halton;
 GSL_VAR const gsl_qrng_type * gsl_qrng_reversehalton;
 
@@ -93,6 +97,18 @@ size_t gsl_qrng_size (const gsl_qrng * q);
 void * gsl_qrng_state (const gsl_qrng * q);
 
 
+/* Advance the generator by n points. */
+int gsl_qrng_skip (gsl_qrng * q, size_t n);
+
+
+/* Randomize the sequence, for generators which support it. */
+int gsl_qrng_scramble (gsl_qrng * q, const gsl_rng * r);
+
+
+/* Retrieve the next n vectors in sequence, stored consecutively. */
+int gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n);
+
+
 /* Retrieve next vector in sequence. */
 INLINE_DECL int gsl_qrng_get (const gsl_qrng * q, double x[]);
 
@@ -23,6 +23,7 @@
  */
 
 #include <config.h>
+#include <limits.h>
 #include <gsl/gsl_qrng.h>
 
 /* maximum allowed space dimension */
@@ -32,6 +33,7 @@
 static size_t halton_state_size (unsigned int dimension);
 static int halton_init (void *state, unsigned int dimension);
 static int halton_get (void *state, unsigned int dimension, double *v);
+static int halton_skip (void *state, unsigned int dimension, size_t n);
 
 /* global Halton generator type object */
 static const gsl_qrng_type halton_type = {
@@ -39,7 +41,8 @@ static const gsl_qrng_type halton_type = {
   HALTON_MAX_DIMENSION,
   halton_state_size,
   halton_init,
-  halton_get
+  halton_get,
+  halton_skip
 };
 
 const gsl_qrng_type *gsl_qrng_halton = &halton_type;
@@ -237,3 +240,19 @@ halton_get (void *state, unsigned int dimension, double *v)
 
   return GSL_SUCCESS;
 }
+
+static int
+halton_skip (void *state, unsigned int dimension, size_t n)
+{
+  halton_state_t *h_state = (halton_state_t *) state;
+
+  /* the count is used as an int in vdcorput */
+  if (n > (size_t) (INT_MAX - h_state->sequence_count))
+    {
+      return GSL_EFAILED;
+    }
+
+  h_state->sequence_count += n;
+
+  return GSL_SUCCESS;
+}
@@ -5,6 +5,10 @@
 #include <string.h>
 #include <gsl/gsl_errno.h>
 
+/* gsl_qrng.h includes gsl_rng.h, whose inline functions are compiled
+   in rng/inline.c, so include it before COMPILE_INLINE_STATIC */
+#include <gsl/gsl_rng.h>
+
 /* Compile all the inline functions */
 
 #define COMPILE_INLINE_STATIC
@@ -29,6 +29,7 @@
 static size_t nied2_state_size(unsigned int dimension);
 static int nied2_init(void * state, unsigned int dimension);
 static int nied2_get(void * state, unsigned int dimension, double * v);
+static int nied2_skip(void * state, unsigned int dimension, size_t n);
 
 
 static const gsl_qrng_type nied2_type = 
@@ -37,7 +38,8 @@ static const gsl_qrng_type nied2_type =
   NIED2_MAX_DIMENSION,
   nied2_state_size,
   nied2_init,
-  nied2_get
+  nied2_get,
+  nied2_skip
 };
 
 const gsl_qrng_type * gsl_qrng_niederreiter_2 = &nied2_type;
@@ -351,3 +353,31 @@ static int nied2_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* Skip ahead by computing the next point directly from the Gray code
+ * of the new count.
+ */
+static int nied2_skip(void * state, unsigned int dimension, size_t n)
+{
+  nied2_state_t * n_state = (nied2_state_t *) state;
+  const unsigned int max_count = (1U << NIED2_NBITS) - 1;
+  unsigned int gray;
+  unsigned int i_dim;
+  int r;
+
+  if(n > max_count - n_state->sequence_count) return GSL_EFAILED;
+
+  n_state->sequence_count += n;
+  gray = n_state->sequence_count ^ (n_state->sequence_count >> 1);
+
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    int q = 0;
+    for(r=0; r<NIED2_NBITS; r++) {
+      if((gray >> r) & 1) q ^= n_state->cj[r][i_dim];
+    }
+    n_state->nextq[i_dim] = q;
+  }
+
+  return GSL_SUCCESS;
+}
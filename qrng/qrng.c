@@ -109,6 +109,58 @@ gsl_qrng_state (const gsl_qrng * q)
 }
 
 
+int
+gsl_qrng_skip (gsl_qrng * q, size_t n)
+{
+  int status;
+
+  if (q->type->skip == 0)
+    {
+      GSL_ERROR ("generator does not support skipping ahead", GSL_EUNIMPL);
+    }
+
+  status = (q->type->skip) (q->state, q->dimension, n);
+
+  if (status)
+    {
+      GSL_ERROR ("skip exceeds the length of the sequence", status);
+    }
+
+  return GSL_SUCCESS;
+}
+
+
+int
+gsl_qrng_scramble (gsl_qrng * q, const gsl_rng * r)
+{
+  if (q->type->scramble == 0)
+    {
+      GSL_ERROR ("generator does not support scrambling", GSL_EUNIMPL);
+    }
+
+  return (q->type->scramble) (q->state, q->dimension, r);
+}
+
+
+int
+gsl_qrng_get_array (const gsl_qrng * q, double x[], size_t n)
+{
+  int (*get) (void *, unsigned int, double *) = q->type->get;
+  const unsigned int dimension = q->dimension;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      int status = get (q->state, dimension, x + i * dimension);
+
+      if (status)
+        return status;
+    }
+
+  return GSL_SUCCESS;
+}
+
+
 void
 gsl_qrng_free (gsl_qrng * q)
 {
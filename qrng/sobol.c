@@ -19,6 +19,7 @@
 static size_t sobol_state_size(unsigned int dimension);
 static int sobol_init(void * state, unsigned int dimension);
 static int sobol_get(void * state, unsigned int dimension, double * v);
+static int sobol_skip(void * state, unsigned int dimension, size_t n);
 
 /* global Sobol generator type object */
 static const gsl_qrng_type sobol_type = 
@@ -27,7 +28,8 @@ static const gsl_qrng_type sobol_type =
   SOBOL_MAX_DIMENSION,
   sobol_state_size,
   sobol_init,
-  sobol_get
+  sobol_get,
+  sobol_skip
 };
 const gsl_qrng_type * gsl_qrng_sobol = &sobol_type;
 
@@ -229,3 +231,31 @@ static int sobol_get(void * state, unsigned int dimension, double * v)
 
   return GSL_SUCCESS;
 }
+
+
+/* Skip ahead by computing the numerators directly from the Gray code
+ * of the new count, rather than by the recursion in sobol_get().
+ */
+static int sobol_skip(void * state, unsigned int dimension, size_t n)
+{
+  sobol_state_t * s_state = (sobol_state_t *) state;
+  const unsigned int max_count = (1U << SOBOL_BIT_COUNT) - 1;
+  unsigned int gray;
+  unsigned int i_dim;
+  int k;
+
+  if(n > max_count - s_state->sequence_count) return GSL_EFAILED;
+
+  s_state->sequence_count += n;
+  gray = s_state->sequence_count ^ (s_state->sequence_count >> 1);
+
+  for(i_dim=0; i_dim<dimension; i_dim++) {
+    int numerator = 0;
+    for(k=0; k<SOBOL_BIT_COUNT; k++) {
+      if((gray >> k) & 1) numerator ^= s_state->v_direction[k][i_dim];
+    }
+    s_state->last_numerator_vec[i_dim] = numerator;
+  }
+
+  return GSL_SUCCESS;
+}
@@ -0,0 +1,296 @@
+/* qrng/sobol_jk.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Sobol sequence with the direction numbers of Joe and Kuo, in up to
+ * 3667 dimensions and with 32 bits of resolution.  See
+ *   [Joe+Kuo, SIAM J. Sci. Comput. 30, 2635 (2008)]
+ *   [Antonov+Saleev, USSR Comput. Maths. Math. Phys. 19, 252 (1980)]
+ *
+ * Point n of the sequence, counting from zero, is
+ *
+ *   x_n = s ^ v_1 g_1 ^ v_2 g_2 ^ ...
+ *
+ * where g = n ^ (n >> 1) is the Gray code of n with bits g_1, g_2, ...,
+ * v_j are the direction numbers and s is a digital shift, which is zero
+ * unless the sequence has been scrambled.  Successive points differ by
+ * a single direction number, and any point can be computed directly,
+ * which gives skip-ahead in O(32 dimension) operations.
+ *
+ * Scrambling multiplies the direction numbers of each dimension by a
+ * random lower triangular binary matrix and adds a random digital
+ * shift [Matousek, J. Complexity 14, 527 (1998)].  The result is still
+ * a digital net, so the recursion and skip-ahead are unchanged.
+ */
+
+#include <config.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_qrng.h>
+
+#include "sobol_jk_table.c"
+
+/* bits of resolution; assumes unsigned int has at least 32 bits */
+#define SOBOL_JK_BIT_COUNT 32
+#define SOBOL_JK_MASK 0xffffffffU
+
+/* the sequence is limited to 2^32 - 1 points */
+#define SOBOL_JK_MAX_COUNT 0xffffffffUL
+
+static size_t sobol_jk_state_size (unsigned int dimension);
+static int sobol_jk_init (void *state, unsigned int dimension);
+static int sobol_jk_get (void *state, unsigned int dimension, double *v);
+static int sobol_jk_skip (void *state, unsigned int dimension, size_t n);
+static int sobol_jk_scramble (void *state, unsigned int dimension,
+                              const gsl_rng * r);
+
+static const gsl_qrng_type sobol_jk_type = {
+  "sobol_jk",
+  SOBOL_JK_MAX_DIMENSION,
+  sobol_jk_state_size,
+  sobol_jk_init,
+  sobol_jk_get,
+  sobol_jk_skip,
+  sobol_jk_scramble
+};
+
+const gsl_qrng_type *gsl_qrng_sobol_jk = &sobol_jk_type;
+
+/* Generator state.  The header is followed by the arrays
+ *   v[dimension][SOBOL_JK_BIT_COUNT]  direction numbers
+ *   x[dimension]                      numerators of the next point
+ *   shift[dimension]                  digital shift
+ * so that the whole state can be copied with memcpy.
+ */
+typedef struct
+{
+  unsigned long int sequence_count;     /* index of the next point */
+}
+sobol_jk_state_t;
+
+static inline unsigned int *
+sobol_jk_v (void *state)
+{
+  return (unsigned int *) ((char *) state + sizeof (sobol_jk_state_t));
+}
+
+static size_t
+sobol_jk_state_size (unsigned int dimension)
+{
+  return sizeof (sobol_jk_state_t)
+    + (SOBOL_JK_BIT_COUNT + 2) * dimension * sizeof (unsigned int);
+}
+
+/* set x to point number sequence_count */
+static void
+sobol_jk_position (void *state, unsigned int dimension)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+  const unsigned int *v = sobol_jk_v (state);
+  unsigned int *x = sobol_jk_v (state) + SOBOL_JK_BIT_COUNT * dimension;
+  const unsigned int *shift = x + dimension;
+  const unsigned long int n = s_state->sequence_count;
+  const unsigned long int gray = n ^ (n >> 1);
+  unsigned int i, j;
+
+  for (i = 0; i < dimension; i++)
+    {
+      unsigned int xi = shift[i];
+
+      for (j = 0; j < SOBOL_JK_BIT_COUNT; j++)
+        {
+          if ((gray >> j) & 1)
+            xi ^= v[i * SOBOL_JK_BIT_COUNT + j];
+        }
+
+      x[i] = xi;
+    }
+}
+
+static int
+sobol_jk_init (void *state, unsigned int dimension)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+  unsigned int *v = sobol_jk_v (state);
+  unsigned int *x = v + SOBOL_JK_BIT_COUNT * dimension;
+  unsigned int *shift = x + dimension;
+  const unsigned short *m = sobol_jk_minit;
+  unsigned int i, j, k;
+
+  if (dimension < 1 || dimension > SOBOL_JK_MAX_DIMENSION)
+    {
+      return GSL_EINVAL;
+    }
+
+  /* The first dimension has m_j = 1 for all j. */
+  for (j = 0; j < SOBOL_JK_BIT_COUNT; j++)
+    v[j] = 1U << (SOBOL_JK_BIT_COUNT - 1 - j);
+
+  for (i = 1; i < dimension; i++)
+    {
+      const unsigned int p = sobol_jk_poly[i - 1];
+      unsigned int *vi = v + i * SOBOL_JK_BIT_COUNT;
+      unsigned int s = 0;
+
+      while ((p >> (s + 1)) != 0)
+        s++;
+
+      /* leading direction numbers from the table */
+      for (j = 0; j < s; j++)
+        vi[j] = (unsigned int) m[j] << (SOBOL_JK_BIT_COUNT - 1 - j);
+
+      m += s;
+
+      /* recurrence from the coefficients a_k of the polynomial
+         x^s + a_1 x^(s-1) + ... + a_(s-1) x + 1 */
+      for (j = s; j < SOBOL_JK_BIT_COUNT; j++)
+        {
+          unsigned int vj = vi[j - s] ^ (vi[j - s] >> s);
+
+          for (k = 1; k < s; k++)
+            {
+              if ((p >> (s - k)) & 1)
+                vj ^= vi[j - k];
+            }
+
+          vi[j] = vj;
+        }
+    }
+
+  for (i = 0; i < dimension; i++)
+    {
+      x[i] = 0;
+      shift[i] = 0;
+    }
+
+  s_state->sequence_count = 0;
+
+  return GSL_SUCCESS;
+}
+
+static int
+sobol_jk_get (void *state, unsigned int dimension, double *v)
+{
+  static const double recip = 1.0 / 4294967296.0;     /* 2^(-32) */
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+  const unsigned int *vdir = sobol_jk_v (state);
+  unsigned int *x = sobol_jk_v (state) + SOBOL_JK_BIT_COUNT * dimension;
+  unsigned long int c = s_state->sequence_count;
+  unsigned int i, ell = 0;
+
+  if (c >= SOBOL_JK_MAX_COUNT)
+    return GSL_EFAILED;
+
+  /* Find the position of the least-significant zero in the count,
+     which is the bit of the Gray code that changes next. */
+  while (c & 1)
+    {
+      ++ell;
+      c >>= 1;
+    }
+
+  for (i = 0; i < dimension; i++)
+    {
+      v[i] = x[i] * recip;
+      x[i] ^= vdir[i * SOBOL_JK_BIT_COUNT + ell];
+    }
+
+  s_state->sequence_count++;
+
+  return GSL_SUCCESS;
+}
+
+static int
+sobol_jk_skip (void *state, unsigned int dimension, size_t n)
+{
+  sobol_jk_state_t *s_state = (sobol_jk_state_t *) state;
+
+  if (n > SOBOL_JK_MAX_COUNT - s_state->sequence_count)
+    return GSL_EFAILED;
+
+  s_state->sequence_count += n;
+  sobol_jk_position (state, dimension);
+
+  return GSL_SUCCESS;
+}
+
+/* 32 random bits, taken 16 at a time so that generators with fewer
+   random bits can be used */
+static unsigned int
+sobol_jk_random_bits (const gsl_rng * r)
+{
+  const unsigned int hi = (unsigned int) (gsl_rng_uniform (r) * 65536.0);
+  const unsigned int lo = (unsigned int) (gsl_rng_uniform (r) * 65536.0);
+
+  return (hi << 16) | lo;
+}
+
+static inline unsigned int
+sobol_jk_parity (unsigned int a)
+{
+  a ^= a >> 16;
+  a ^= a >> 8;
+  a ^= a >> 4;
+  a ^= a >> 2;
+  a ^= a >> 1;
+
+  return a & 1;
+}
+
+static int
+sobol_jk_scramble (void *state, unsigned int dimension, const gsl_rng * r)
+{
+  unsigned int *v = sobol_jk_v (state);
+  unsigned int *shift = v + (SOBOL_JK_BIT_COUNT + 1) * dimension;
+  unsigned int L[SOBOL_JK_BIT_COUNT];
+  unsigned int i, j, k;
+
+  for (i = 0; i < dimension; i++)
+    {
+      unsigned int *vi = v + i * SOBOL_JK_BIT_COUNT;
+
+      /* Row k of L gives bit k of the result, counting from the most
+         significant bit; it has a one on the diagonal and random bits
+         in the more significant positions. */
+      for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+        {
+          const unsigned int diag = 1U << (SOBOL_JK_BIT_COUNT - 1 - k);
+          const unsigned int upper = SOBOL_JK_MASK & ~(2 * diag - 1);
+
+          L[k] = (sobol_jk_random_bits (r) & upper) | diag;
+        }
+
+      for (j = 0; j <= SOBOL_JK_BIT_COUNT; j++)
+        {
+          /* scramble each direction number and then the shift */
+          unsigned int *y = (j < SOBOL_JK_BIT_COUNT) ? &vi[j] : &shift[i];
+          unsigned int z = 0;
+
+          for (k = 0; k < SOBOL_JK_BIT_COUNT; k++)
+            z |= sobol_jk_parity (L[k] & *y) << (SOBOL_JK_BIT_COUNT - 1 - k);
+
+          *y = z;
+        }
+
+      shift[i] ^= sobol_jk_random_bits (r);
+    }
+
+  sobol_jk_position (state, dimension);
+
+  return GSL_SUCCESS;
+}
@@ -4,6 +4,8 @@
 #include <stdlib.h>
 #include <gsl/gsl_ieee_utils.h>
 
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
 #include <gsl/gsl_qrng.h>
 #include <gsl/gsl_test.h>
 #include <math.h>
@@ -233,6 +235,234 @@ void test_nied2(void)
 }
 
 
+void test_sobol_jk(void)
+{
+  int status = 0;
+  double v[3];
+  unsigned int i;
+  double *w;
+
+  /* test in dimension 2; the sequence starts at the origin */
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 2);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.0 || v[1] != 0.0 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.5 || v[1] != 0.5 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.75 || v[1] != 0.25 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.25 || v[1] != 0.75 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.375 || v[1] != 0.375 );
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol (Joe-Kuo) d=2");
+
+  status = 0;
+
+  /* test in dimension 3 */
+  g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 3);
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.75 || v[1] != 0.25 || v[2] != 0.25 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.25 || v[1] != 0.75 || v[2] != 0.75 );
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.375 || v[1] != 0.375 || v[2] != 0.625 );
+
+  gsl_qrng_init(g);
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  gsl_qrng_get(g, v);
+  status += ( v[0] != 0.75 || v[1] != 0.25 || v[2] != 0.25 );
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol (Joe-Kuo) d=3");
+
+  /* test in the maximum dimension */
+  g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 3667);
+  w = malloc(3667 * sizeof(double));
+  status = 0;
+
+  for (i = 0; i < 100; i++)
+    status |= gsl_qrng_get(g, w);
+
+  for (i = 0; i < 3667; i++)
+    status |= !(w[i] >= 0.0 && w[i] < 1.0);
+
+  free(w);
+  gsl_qrng_free(g);
+
+  gsl_test (status, "Sobol (Joe-Kuo) d=3667");
+}
+
+/* Check that the first 2^m points fall one in each interval of width
+   2^(-m) in every coordinate, as they must for a digital (t,s)-sequence
+   in base 2. */
+static int
+test_stratified(gsl_qrng * g, unsigned int dim, unsigned int m)
+{
+  const size_t N = (size_t) 1 << m;
+  unsigned char * count = calloc(N * dim, 1);
+  double * x = malloc(N * dim * sizeof(double));
+  int status = 0;
+  size_t i;
+
+  gsl_qrng_get_array(g, x, N);
+
+  for (i = 0; i < N * dim; i++)
+    {
+      const size_t bin = (size_t) (x[i] * N);
+      count[(i % dim) * N + bin]++;
+    }
+
+  for (i = 0; i < N * dim; i++)
+    status |= (count[i] != 1);
+
+  free(x);
+  free(count);
+
+  return status;
+}
+
+void test_sobol_jk_scramble(void)
+{
+  const unsigned int dims[] = { 1, 2, 5, 50, 1111 };
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  double v[2], u[2];
+  size_t k;
+
+  for (k = 0; k < sizeof(dims) / sizeof(dims[0]); k++)
+    {
+      gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_jk, dims[k]);
+
+      gsl_test (test_stratified(g, dims[k], 10),
+                "Sobol (Joe-Kuo) d=%u stratified", dims[k]);
+
+      gsl_qrng_init(g);
+      gsl_qrng_scramble(g, r);
+      gsl_test (test_stratified(g, dims[k], 10),
+                "Sobol (Joe-Kuo) d=%u scrambled stratified", dims[k]);
+
+      gsl_qrng_free(g);
+    }
+
+  {
+    /* scrambling moves the first point away from the origin, and
+       reinitializing restores the unscrambled sequence */
+    gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 2);
+    int status;
+
+    gsl_qrng_scramble(g, r);
+    gsl_qrng_get(g, v);
+    gsl_qrng_init(g);
+    gsl_qrng_get(g, u);
+    status = (v[0] == 0.0 && v[1] == 0.0) || u[0] != 0.0 || u[1] != 0.0;
+    gsl_qrng_free(g);
+
+    gsl_test (status, "Sobol (Joe-Kuo) scramble and init");
+  }
+
+  gsl_rng_free(r);
+}
+
+/* Check gsl_qrng_skip and gsl_qrng_get_array against gsl_qrng_get,
+   and that clones advanced with gsl_qrng_skip partition the sequence */
+void test_skip(const gsl_qrng_type * T, unsigned int dim)
+{
+  const size_t n = 517, nblock = 4;
+  const size_t skips[] = { 0, 1, 2, 3, 7, 64, 100, 255, 256 };
+  gsl_qrng * g = gsl_qrng_alloc(T, dim);
+  double * x = malloc(n * dim * sizeof(double));
+  double * y = malloc(n * dim * sizeof(double));
+  int status = 0;
+  size_t i, j, k;
+
+  for (i = 0; i < n; i++)
+    gsl_qrng_get(g, x + i * dim);
+
+  gsl_qrng_init(g);
+  gsl_qrng_get_array(g, y, n);
+
+  for (i = 0; i < n * dim; i++)
+    status |= (x[i] != y[i]);
+
+  gsl_test (status, "%s d=%u get_array", gsl_qrng_name(g), dim);
+
+  status = 0;
+
+  for (k = 0; k < sizeof(skips) / sizeof(skips[0]); k++)
+    {
+      /* skip from the start, then from the middle of the sequence */
+      gsl_qrng_init(g);
+      gsl_qrng_skip(g, skips[k]);
+      gsl_qrng_get(g, y);
+
+      for (j = 0; j < dim; j++)
+        status |= (y[j] != x[skips[k] * dim + j]);
+
+      gsl_qrng_skip(g, skips[k]);
+      gsl_qrng_get(g, y);
+
+      for (j = 0; j < dim; j++)
+        status |= (y[j] != x[(2 * skips[k] + 1) * dim + j]);
+    }
+
+  gsl_test (status, "%s d=%u skip", gsl_qrng_name(g), dim);
+
+  status = 0;
+  gsl_qrng_init(g);
+
+  for (k = 0; k < nblock; k++)
+    {
+      /* block k of n/nblock points from its own clone */
+      const size_t m = n / nblock;
+      gsl_qrng * c = gsl_qrng_clone(g);
+
+      gsl_qrng_skip(c, k * m);
+      gsl_qrng_get_array(c, y, m);
+
+      for (i = 0; i < m * dim; i++)
+        status |= (y[i] != x[k * m * dim + i]);
+
+      gsl_qrng_free(c);
+    }
+
+  gsl_test (status, "%s d=%u partition with skip", gsl_qrng_name(g), dim);
+
+  free(x);
+  free(y);
+  gsl_qrng_free(g);
+}
+
+void test_errors(void)
+{
+  gsl_error_handler_t * old = gsl_set_error_handler_off();
+  gsl_rng * r = gsl_rng_alloc(gsl_rng_default);
+  gsl_qrng * g = gsl_qrng_alloc(gsl_qrng_sobol, 2);
+  int status;
+
+  status = gsl_qrng_scramble(g, r);
+  gsl_test (status != GSL_EUNIMPL, "sobol scramble not supported");
+
+  status = gsl_qrng_skip(g, (size_t) 1 << 30);
+  gsl_test (status == GSL_SUCCESS, "sobol skip past end of sequence");
+  gsl_qrng_free(g);
+
+  g = gsl_qrng_alloc(gsl_qrng_sobol_jk, 2);
+  status = gsl_qrng_skip(g, 0xfffffffeUL);
+  status |= gsl_qrng_skip(g, 1);
+  gsl_test (status != GSL_SUCCESS, "sobol_jk skip to end of sequence");
+
+  status = gsl_qrng_skip(g, 1);
+  gsl_test (status == GSL_SUCCESS, "sobol_jk skip past end of sequence");
+  gsl_qrng_free(g);
+
+  gsl_rng_free(r);
+  gsl_set_error_handler(old);
+}
+
 int main()
 {
 
@@ -242,6 +472,19 @@ int main()
 	test_halton();
 	test_reversehalton();
   test_nied2();
+  test_sobol_jk();
+  test_sobol_jk_scramble();
+
+  test_skip(gsl_qrng_sobol, 3);
+  test_skip(gsl_qrng_sobol, 40);
+  test_skip(gsl_qrng_niederreiter_2, 3);
+  test_skip(gsl_qrng_niederreiter_2, 12);
+  test_skip(gsl_qrng_halton, 5);
+  test_skip(gsl_qrng_reversehalton, 5);
+  test_skip(gsl_qrng_sobol_jk, 3);
+  test_skip(gsl_qrng_sobol_jk, 300);
+
+  test_errors();
 
   exit (gsl_test_summary ());
 }
@@ -18,8 +18,10 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_sf_gamma.h>
@@ -68,6 +70,112 @@ gsl_ran_beta (const gsl_rng * r, const double a, const double b)
     }
 }
 
+/* A beta sampler stores the constants of gsl_ran_beta for fixed
+   parameters a and b, and returns the same sequence of variates. */
+
+gsl_ran_beta_sampler *
+gsl_ran_beta_sampler_alloc (const double a, const double b)
+{
+  gsl_ran_beta_sampler *s;
+
+  if (!(a > 0) || !(b > 0))
+    {
+      GSL_ERROR_NULL ("parameters a and b must be positive", GSL_EDOM);
+    }
+
+  s = (gsl_ran_beta_sampler *) malloc (sizeof (gsl_ran_beta_sampler));
+
+  if (s == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for beta sampler",
+                      GSL_ENOMEM);
+    }
+
+  s->a = a;
+  s->b = b;
+  s->ainv = 1.0 / a;
+  s->binv = 1.0 / b;
+  s->ga = 0;
+  s->gb = 0;
+
+  if ((a > 1.0) || (b > 1.0))
+    {
+      s->ga = gsl_ran_gamma_sampler_alloc (a, 1.0);
+      s->gb = gsl_ran_gamma_sampler_alloc (b, 1.0);
+
+      if (s->ga == 0 || s->gb == 0)
+        {
+          gsl_ran_beta_sampler_free (s);
+          GSL_ERROR_NULL ("failed to allocate space for gamma samplers",
+                          GSL_ENOMEM);
+        }
+    }
+
+  return s;
+}
+
+void
+gsl_ran_beta_sampler_free (gsl_ran_beta_sampler * s)
+{
+  RETURN_IF_NULL (s);
+
+  if (s->ga)
+    gsl_ran_gamma_sampler_free (s->ga);
+
+  if (s->gb)
+    gsl_ran_gamma_sampler_free (s->gb);
+
+  free (s);
+}
+
+double
+gsl_ran_beta_sampler_get (const gsl_rng * r, const gsl_ran_beta_sampler * s)
+{
+  if (s->ga == 0)
+    {
+      double U, V, X, Y;
+      while (1)
+        {
+          U = gsl_rng_uniform_pos(r);
+          V = gsl_rng_uniform_pos(r);
+          X = pow(U, s->ainv);
+          Y = pow(V, s->binv);
+          if ((X + Y ) <= 1.0)
+            {
+              if (X + Y > 0)
+                {
+                  return X/ (X + Y);
+                }
+              else
+                {
+                  double logX = log(U)/s->a;
+                  double logY = log(V)/s->b;
+                  double logM = logX > logY ? logX: logY;
+                  logX -= logM;
+                  logY -= logM;
+                  return exp(logX - log(exp(logX) + exp(logY)));
+                }
+            }
+        }
+    }
+  else
+    {
+      double x1 = gsl_ran_gamma_sampler_get (r, s->ga);
+      double x2 = gsl_ran_gamma_sampler_get (r, s->gb);
+      return x1 / (x1 + x2);
+    }
+}
+
+void
+gsl_ran_beta_sampler_array (const gsl_rng * r, const gsl_ran_beta_sampler * s,
+                            double * x, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = gsl_ran_beta_sampler_get (r, s);
+}
+
 double
 gsl_ran_beta_pdf (const double x, const double a, const double b)
 {
@@ -18,7 +18,9 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 #include <math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 #include <gsl/gsl_pow_int.h>
@@ -93,31 +95,111 @@ gsl_ran_binomial_tpe (const gsl_rng * rng, double p, unsigned int n)
   return gsl_ran_binomial (rng, p, n);
 }
 
-unsigned int
-gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
+/* Compute the constants of the BINV or BTPE method for fixed p and n.
+   These depend only on the parameters, so a sampler can compute them
+   once and reuse them for every variate. */
+
+static void
+binomial_setup (gsl_ran_binomial_sampler * b, double p, unsigned int n)
 {
-  int ix;                       /* return value */
-  int flipped = 0;
   double q, s, np;
 
-  if (n == 0)
-    return 0;
+  b->n = n;
+  b->flipped = 0;
 
   if (p > 0.5)
     {
       p = 1.0 - p;              /* work with small p */
-      flipped = 1;
+      b->flipped = 1;
     }
 
   q = 1 - p;
   s = p / q;
   np = n * p;
 
+  b->p = p;
+  b->q = q;
+  b->s = s;
+  b->np = np;
+
+  if (n == 0)
+    return;
+
+  if (np < SMALL_MEAN)
+    {
+      b->f0 = gsl_pow_uint (q, n);   /* f(x), starting with x=0 */
+    }
+  else
+    {
+      double ffm = np + p;      /* ffm = n*p+p             */
+      int m = (int) ffm;        /* m = int floor[n*p+p]    */
+      double fm = m;            /* fm = double m;          */
+      double xm = fm + 0.5;     /* xm = half integer mean (tip of triangle)  */
+      double npq = np * q;      /* npq = n*p*q            */
+
+      /* Compute cumulative area of tri, para, exp tails */
+
+      /* p1: radius of triangle region; since height=1, also: area of region */
+      /* p2: p1 + area of parallelogram region */
+      /* p3: p2 + area of left tail */
+      /* p4: p3 + area of right tail */
+      /* pi/p4: probability of i'th area (i=1,2,3,4) */
+
+      /* Note: magic numbers 2.195, 4.6, 0.134, 20.5, 15.3 */
+      /* These magic numbers are not adjustable...at least not easily! */
+
+      double p1 = floor (2.195 * sqrt (npq) - 4.6 * q) + 0.5;
+
+      /* xl, xr: left and right edges of triangle */
+      double xl = xm - p1;
+      double xr = xm + p1;
+
+      /* Parameter of exponential tails */
+      /* Left tail:  t(x) = c*exp(-lambda_l*[xl - (x+0.5)]) */
+      /* Right tail: t(x) = c*exp(-lambda_r*[(x+0.5) - xr]) */
+
+      double c = 0.134 + 20.5 / (15.3 + fm);
+      double p2 = p1 * (1.0 + c + c);
+
+      double al = (ffm - xl) / (ffm - xl * p);
+      double lambda_l = al * (1.0 + 0.5 * al);
+      double ar = (xr - ffm) / (xr * q);
+      double lambda_r = ar * (1.0 + 0.5 * ar);
+      double p3 = p2 + c / lambda_l;
+      double p4 = p3 + c / lambda_r;
+
+      b->m = m;
+      b->fm = fm;
+      b->xm = xm;
+      b->npq = npq;
+      b->g = (n + 1) * s;
+      b->p1 = p1;
+      b->p2 = p2;
+      b->p3 = p3;
+      b->p4 = p4;
+      b->xl = xl;
+      b->xr = xr;
+      b->c = c;
+      b->lambda_l = lambda_l;
+      b->lambda_r = lambda_r;
+    }
+}
+
+static unsigned int
+binomial_sample (const gsl_rng * rng, const gsl_ran_binomial_sampler * b)
+{
+  int ix;                       /* return value */
+  const unsigned int n = b->n;
+  const double p = b->p, q = b->q, s = b->s, np = b->np;
+
+  if (n == 0)
+    return 0;
+
   /* Inverse cdf logic for small mean (BINV in K+S) */
 
   if (np < SMALL_MEAN)
     {
-      double f0 = gsl_pow_uint (q, n);   /* f(x), starting with x=0 */
+      double f0 = b->f0;        /* f(x), starting with x=0 */
 
       while (1)
         {
@@ -168,42 +250,11 @@ gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
 
       int k;
 
-      double ffm = np + p;      /* ffm = n*p+p             */
-      int m = (int) ffm;        /* m = int floor[n*p+p]    */
-      double fm = m;            /* fm = double m;          */
-      double xm = fm + 0.5;     /* xm = half integer mean (tip of triangle)  */
-      double npq = np * q;      /* npq = n*p*q            */
-
-      /* Compute cumulative area of tri, para, exp tails */
-
-      /* p1: radius of triangle region; since height=1, also: area of region */
-      /* p2: p1 + area of parallelogram region */
-      /* p3: p2 + area of left tail */
-      /* p4: p3 + area of right tail */
-      /* pi/p4: probability of i'th area (i=1,2,3,4) */
-
-      /* Note: magic numbers 2.195, 4.6, 0.134, 20.5, 15.3 */
-      /* These magic numbers are not adjustable...at least not easily! */
-
-      double p1 = floor (2.195 * sqrt (npq) - 4.6 * q) + 0.5;
-
-      /* xl, xr: left and right edges of triangle */
-      double xl = xm - p1;
-      double xr = xm + p1;
-
-      /* Parameter of exponential tails */
-      /* Left tail:  t(x) = c*exp(-lambda_l*[xl - (x+0.5)]) */
-      /* Right tail: t(x) = c*exp(-lambda_r*[(x+0.5) - xr]) */
-
-      double c = 0.134 + 20.5 / (15.3 + fm);
-      double p2 = p1 * (1.0 + c + c);
-
-      double al = (ffm - xl) / (ffm - xl * p);
-      double lambda_l = al * (1.0 + 0.5 * al);
-      double ar = (xr - ffm) / (xr * q);
-      double lambda_r = ar * (1.0 + 0.5 * ar);
-      double p3 = p2 + c / lambda_l;
-      double p4 = p3 + c / lambda_r;
+      const int m = b->m;
+      const double fm = b->fm, xm = b->xm, npq = b->npq;
+      const double p1 = b->p1, p2 = b->p2, p3 = b->p3, p4 = b->p4;
+      const double xl = b->xl, xr = b->xr, c = b->c;
+      const double lambda_l = b->lambda_l, lambda_r = b->lambda_r;
 
       double var, accept;
       double u, v;              /* random variates */
@@ -276,7 +327,7 @@ gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
            * If ix near m (ie, |ix-m|<FAR_FROM_MEAN), then do
            * explicit evaluation using recursion relation for f(x)
            */
-          double g = (n + 1) * s;
+          double g = b->g;
           double f = 1.0;
 
           var = v;
@@ -377,5 +428,66 @@ gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
 
 Finish:
 
-  return (flipped) ? (n - ix) : (unsigned int)ix;
+  return (b->flipped) ? (n - ix) : (unsigned int)ix;
+}
+
+unsigned int
+gsl_ran_binomial (const gsl_rng * rng, double p, unsigned int n)
+{
+  gsl_ran_binomial_sampler b;
+
+  binomial_setup (&b, p, n);
+
+  return binomial_sample (rng, &b);
+}
+
+/* A binomial sampler stores the constants of gsl_ran_binomial for
+   fixed p and n, and returns the same sequence of variates. */
+
+gsl_ran_binomial_sampler *
+gsl_ran_binomial_sampler_alloc (const double p, const unsigned int n)
+{
+  gsl_ran_binomial_sampler *b;
+
+  if (!(p >= 0 && p <= 1))
+    {
+      GSL_ERROR_NULL ("probability p must lie in [0,1]", GSL_EDOM);
+    }
+
+  b = (gsl_ran_binomial_sampler *) malloc (sizeof (gsl_ran_binomial_sampler));
+
+  if (b == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for binomial sampler",
+                      GSL_ENOMEM);
+    }
+
+  binomial_setup (b, p, n);
+
+  return b;
+}
+
+void
+gsl_ran_binomial_sampler_free (gsl_ran_binomial_sampler * b)
+{
+  RETURN_IF_NULL (b);
+  free (b);
+}
+
+unsigned int
+gsl_ran_binomial_sampler_get (const gsl_rng * rng,
+                              const gsl_ran_binomial_sampler * b)
+{
+  return binomial_sample (rng, b);
+}
+
+void
+gsl_ran_binomial_sampler_array (const gsl_rng * rng,
+                                const gsl_ran_binomial_sampler * b,
+                                unsigned int * x, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = binomial_sample (rng, b);
 }
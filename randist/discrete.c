@@ -351,12 +351,11 @@ gsl_ran_discrete_preproc(size_t Kevents, const double *ProbArray)
     return g;
 }
 
-size_t
-gsl_ran_discrete(const gsl_rng *r, const gsl_ran_discrete_t *g)
+static inline size_t
+discrete_lookup(const gsl_ran_discrete_t *g, double u)
 {
     size_t c=0;
-    double u,f;
-    u = gsl_rng_uniform(r);
+    double f;
 #if KNUTH_CONVENTION
     c = (u*(g->K));
 #else
@@ -376,6 +375,35 @@ gsl_ran_discrete(const gsl_rng *r, const gsl_ran_discrete_t *g)
     }
 }
 
+size_t
+gsl_ran_discrete(const gsl_rng *r, const gsl_ran_discrete_t *g)
+{
+    double u = gsl_rng_uniform(r);
+    return discrete_lookup(g, u);
+}
+
+/* Fill x[0..n-1] with random indices.  The uniforms are generated a
+   block at a time, giving the same values as n calls to
+   gsl_ran_discrete(). */
+
+#define DISCRETE_BLOCK 256
+
+void
+gsl_ran_discrete_array(const gsl_rng *r, const gsl_ran_discrete_t *g,
+                       size_t *x, size_t n)
+{
+    double u[DISCRETE_BLOCK];
+    size_t i, j, m;
+
+    for (i = 0; i < n; i += m) {
+        m = (n - i < DISCRETE_BLOCK) ? n - i : DISCRETE_BLOCK;
+        gsl_rng_uniform_array(r, u, m);
+        for (j = 0; j < m; ++j) {
+            x[i + j] = discrete_lookup(g, u[j]);
+        }
+    }
+}
+
 void gsl_ran_discrete_free(gsl_ran_discrete_t *g)
 {
     RETURN_IF_NULL (g);
@@ -0,0 +1,323 @@
+/* randist/discrete_dynamic.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Random discrete events with weights that change between draws.
+
+   The weights w[k] are stored together with a Fenwick tree (binary
+   indexed tree) of partial sums, P. M. Fenwick, "A new data structure
+   for cumulative frequency tables", Software: Practice and Experience
+   24, 327-336 (1994).  Node i (counting from 1) holds the sum of the
+   weights w[i-l(i)] ... w[i-1], where l(i) is the lowest set bit of i.
+
+   Changing one weight updates the O(log K) nodes covering it.  A
+   variate is drawn by taking t = u * W, where W is the total weight,
+   and descending the implicit tree from the largest power of two not
+   exceeding K, which finds the first k with w[0]+...+w[k] > t in
+   O(log K) steps.
+
+   The partial sums are updated with differences, so rounding errors
+   accumulate over many updates.  The tree is rebuilt from the weights
+   in O(K) after every K updates, which keeps the error bounded at an
+   amortized cost of O(1) per update. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+#define DISCRETE_BLOCK 256
+
+static void
+dynamic_build (gsl_ran_discrete_dynamic_t * g)
+{
+  const size_t K = g->K;
+  double *tree = g->tree;
+  size_t i;
+
+  for (i = 1; i <= K; i++)
+    tree[i] = g->w[i - 1];
+
+  for (i = 1; i <= K; i++)
+    {
+      size_t j = i + (i & (~i + 1));
+
+      if (j <= K)
+        tree[j] += tree[i];
+    }
+
+  g->nupdate = 0;
+}
+
+/* total weight, summed over the nodes which cover [0,K) */
+static double
+dynamic_total (const gsl_ran_discrete_dynamic_t * g)
+{
+  double sum = 0.0;
+  size_t i = g->K;
+
+  while (i > 0)
+    {
+      sum += g->tree[i];
+      i &= i - 1;
+    }
+
+  return sum;
+}
+
+static inline size_t
+dynamic_search (const gsl_ran_discrete_dynamic_t * g, double t)
+{
+  const double *tree = g->tree;
+  size_t pos = 0, step;
+
+  for (step = g->top; step > 0; step >>= 1)
+    {
+      const size_t next = pos + step;
+
+      if (next <= g->K && tree[next] <= t)
+        {
+          pos = next;
+          t -= tree[next];
+        }
+    }
+
+  return pos;
+}
+
+gsl_ran_discrete_dynamic_t *
+gsl_ran_discrete_dynamic_alloc (size_t K, const double *P)
+{
+  gsl_ran_discrete_dynamic_t *g;
+  size_t k;
+
+  if (K == 0)
+    {
+      GSL_ERROR_NULL ("number of events must be a positive integer",
+                      GSL_EINVAL);
+    }
+
+  for (k = 0; k < K; k++)
+    {
+      if (!(P[k] >= 0))
+        {
+          GSL_ERROR_NULL ("probabilities must be non-negative", GSL_EINVAL);
+        }
+    }
+
+  g = (gsl_ran_discrete_dynamic_t *) malloc (sizeof (gsl_ran_discrete_dynamic_t));
+
+  if (g == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for struct", GSL_ENOMEM);
+    }
+
+  g->w = (double *) malloc (K * sizeof (double));
+
+  if (g->w == 0)
+    {
+      free (g);
+      GSL_ERROR_NULL ("failed to allocate space for weights", GSL_ENOMEM);
+    }
+
+  g->tree = (double *) malloc ((K + 1) * sizeof (double));
+
+  if (g->tree == 0)
+    {
+      free (g->w);
+      free (g);
+      GSL_ERROR_NULL ("failed to allocate space for tree", GSL_ENOMEM);
+    }
+
+  g->K = K;
+  g->tree[0] = 0.0;
+
+  for (g->top = 1; g->top <= K / 2; g->top <<= 1)
+    ;
+
+  gsl_ran_discrete_dynamic_init (g, P);
+
+  return g;
+}
+
+void
+gsl_ran_discrete_dynamic_free (gsl_ran_discrete_dynamic_t * g)
+{
+  RETURN_IF_NULL (g);
+  free (g->tree);
+  free (g->w);
+  free (g);
+}
+
+int
+gsl_ran_discrete_dynamic_init (gsl_ran_discrete_dynamic_t * g,
+                               const double *P)
+{
+  size_t k;
+
+  for (k = 0; k < g->K; k++)
+    {
+      if (!(P[k] >= 0))
+        {
+          GSL_ERROR ("probabilities must be non-negative", GSL_EINVAL);
+        }
+    }
+
+  g->nnonzero = 0;
+
+  for (k = 0; k < g->K; k++)
+    {
+      g->w[k] = P[k];
+      g->nnonzero += (P[k] > 0);
+    }
+
+  dynamic_build (g);
+  g->total = dynamic_total (g);
+
+  return GSL_SUCCESS;
+}
+
+int
+gsl_ran_discrete_dynamic_update (gsl_ran_discrete_dynamic_t * g,
+                                 size_t k, double p)
+{
+  if (k >= g->K)
+    {
+      GSL_ERROR ("index k out of range", GSL_EINVAL);
+    }
+  else if (!(p >= 0))
+    {
+      GSL_ERROR ("probability must be non-negative", GSL_EINVAL);
+    }
+  else
+    {
+      const double delta = p - g->w[k];
+      size_t i;
+
+      g->nnonzero += (p > 0);
+      g->nnonzero -= (g->w[k] > 0);
+      g->w[k] = p;
+
+      if (++g->nupdate >= g->K)
+        {
+          dynamic_build (g);
+        }
+      else
+        {
+          for (i = k + 1; i <= g->K; i += i & (~i + 1))
+            g->tree[i] += delta;
+        }
+
+      g->total = dynamic_total (g);
+
+      if (g->nnonzero > 0 && !(g->total > 0))
+        {
+          /* rounding errors have cancelled the remaining weight */
+          dynamic_build (g);
+          g->total = dynamic_total (g);
+        }
+
+      return GSL_SUCCESS;
+    }
+}
+
+double
+gsl_ran_discrete_dynamic_weight (size_t k, const gsl_ran_discrete_dynamic_t * g)
+{
+  return (k < g->K) ? g->w[k] : 0.0;
+}
+
+double
+gsl_ran_discrete_dynamic_pdf (size_t k, const gsl_ran_discrete_dynamic_t * g)
+{
+  if (k >= g->K || g->total <= 0)
+    return 0.0;
+
+  return g->w[k] / g->total;
+}
+
+/* Return the index for the uniform variate u, or K if u falls outside
+   the events with non-zero weight because of rounding, in which case
+   the caller draws again. */
+
+static inline size_t
+dynamic_lookup (const gsl_ran_discrete_dynamic_t * g, double u)
+{
+  size_t k = dynamic_search (g, u * g->total);
+
+  if (k < g->K && g->w[k] > 0)
+    return k;
+
+  return g->K;
+}
+
+size_t
+gsl_ran_discrete_dynamic (const gsl_rng * r,
+                          const gsl_ran_discrete_dynamic_t * g)
+{
+  size_t k;
+
+  if (g->nnonzero == 0)
+    {
+      GSL_ERROR_VAL ("sum of probabilities must be positive", GSL_EDOM, 0);
+    }
+
+  do
+    {
+      k = dynamic_lookup (g, gsl_rng_uniform (r));
+    }
+  while (k == g->K);
+
+  return k;
+}
+
+/* Fill x[0..n-1] with random indices.  The uniforms are generated a
+   block at a time and used in order, giving the same values as n
+   calls to gsl_ran_discrete_dynamic(). */
+
+void
+gsl_ran_discrete_dynamic_array (const gsl_rng * r,
+                                const gsl_ran_discrete_dynamic_t * g,
+                                size_t * x, size_t n)
+{
+  double u[DISCRETE_BLOCK];
+  size_t i = 0, j = 0, m = 0;
+
+  if (g->nnonzero == 0)
+    {
+      GSL_ERROR_VOID ("sum of probabilities must be positive", GSL_EDOM);
+    }
+
+  while (i < n)
+    {
+      size_t k;
+
+      if (j == m)
+        {
+          m = (n - i < DISCRETE_BLOCK) ? n - i : DISCRETE_BLOCK;
+          gsl_rng_uniform_array (r, u, m);
+          j = 0;
+        }
+
+      k = dynamic_lookup (g, u[j++]);
+
+      if (k < g->K)
+        x[i++] = k;
+    }
+}
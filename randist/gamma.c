@@ -18,8 +18,10 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
 #include <math.h>
 #include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
@@ -189,6 +191,36 @@ gsl_ran_gamma_mt (const gsl_rng * r, const double a, const double b)
   return gsl_ran_gamma (r, a, b);
 }
 
+/* Marsaglia-Tsang rejection loop for shape a >= 1, with d = a - 1/3
+   and c = 1/(3 sqrt(d)).  Returns v, the variate divided by d. */
+
+static inline double
+gamma_mt_v (const gsl_rng * r, const double d, const double c)
+{
+  double x, v, u;
+
+  while (1)
+    {
+      do
+        {
+          x = gsl_ran_gaussian_ziggurat (r, 1.0);
+          v = 1.0 + c * x;
+        }
+      while (v <= 0);
+
+      v = v * v * v;
+      u = gsl_rng_uniform_pos (r);
+
+      if (u < 1 - 0.0331 * x * x * x * x) 
+        break;
+
+      if (log (u) < 0.5 * x * x + d * (1 - v + log (v)))
+        break;
+    }
+
+  return v;
+}
+
 double
 gsl_ran_gamma (const gsl_rng * r, const double a, const double b)
 {
@@ -201,29 +233,74 @@ gsl_ran_gamma (const gsl_rng * r, const double a, const double b)
     }
 
   {
-    double x, v, u;
     double d = a - 1.0 / 3.0;
     double c = (1.0 / 3.0) / sqrt (d);
+    double v = gamma_mt_v (r, d, c);
+    
+    return b * d * v;
+  }
+}
 
-    while (1)
-      {
-        do
-          {
-            x = gsl_ran_gaussian_ziggurat (r, 1.0);
-            v = 1.0 + c * x;
-          }
-        while (v <= 0);
+/* A gamma sampler stores the constants of gsl_ran_gamma for fixed
+   parameters a and b, and returns the same sequence of variates. */
 
-        v = v * v * v;
-        u = gsl_rng_uniform_pos (r);
+gsl_ran_gamma_sampler *
+gsl_ran_gamma_sampler_alloc (const double a, const double b)
+{
+  gsl_ran_gamma_sampler *s;
+  double a1 = (a < 1) ? 1.0 + a : a;
 
-        if (u < 1 - 0.0331 * x * x * x * x) 
-          break;
+  if (!(a > 0))
+    {
+      GSL_ERROR_NULL ("shape parameter a must be positive", GSL_EDOM);
+    }
 
-        if (log (u) < 0.5 * x * x + d * (1 - v + log (v)))
-          break;
-      }
-    
-    return b * d * v;
-  }
+  s = (gsl_ran_gamma_sampler *) malloc (sizeof (gsl_ran_gamma_sampler));
+
+  if (s == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for gamma sampler",
+                      GSL_ENOMEM);
+    }
+
+  s->a = a;
+  s->b = b;
+  s->ainv = 1.0 / a;
+  s->d = a1 - 1.0 / 3.0;
+  s->c = (1.0 / 3.0) / sqrt (s->d);
+  s->bd = b * s->d;
+
+  return s;
+}
+
+void
+gsl_ran_gamma_sampler_free (gsl_ran_gamma_sampler * s)
+{
+  RETURN_IF_NULL (s);
+  free (s);
+}
+
+double
+gsl_ran_gamma_sampler_get (const gsl_rng * r, const gsl_ran_gamma_sampler * s)
+{
+  if (s->a < 1)
+    {
+      double u = gsl_rng_uniform_pos (r);
+      return (s->bd * gamma_mt_v (r, s->d, s->c)) * pow (u, s->ainv);
+    }
+  else
+    {
+      return s->bd * gamma_mt_v (r, s->d, s->c);
+    }
+}
+
+void
+gsl_ran_gamma_sampler_array (const gsl_rng * r,
+                             const gsl_ran_gamma_sampler * s,
+                             double * x, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = gsl_ran_gamma_sampler_get (r, s);
 }
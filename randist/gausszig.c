@@ -163,12 +163,42 @@ static const double wtab[128] = {
 };
 
 
+/* test a candidate from step i which failed the fast rectangle test,
+   using the wedge between the step and the curve or, for the base
+   strip, the exponential tail.  On success the magnitude of the
+   variate is stored in x. */
+
+static inline int
+ziggurat_wedge (const gsl_rng * r, const unsigned long int i, double *x)
+{
+  double y;
+
+  if (i < 127)
+    {
+      double y0, y1, U1;
+      y0 = ytab[i];
+      y1 = ytab[i + 1];
+      U1 = gsl_rng_uniform (r);
+      y = y1 + (y0 - y1) * U1;
+    }
+  else
+    {
+      double U1, U2;
+      U1 = 1.0 - gsl_rng_uniform (r);
+      U2 = gsl_rng_uniform (r);
+      *x = PARAM_R - log (U1) / PARAM_R;
+      y = exp (-PARAM_R * (*x - 0.5 * PARAM_R)) * U2;
+    }
+
+  return (y < exp (-0.5 * (*x) * (*x)));
+}
+
 double
 gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
 {
   unsigned long int i, j;
   int sign;
-  double x, y;
+  double x;
 
   const unsigned long int range = r->type->max - r->type->min;
   const unsigned long int offset = r->type->min;
@@ -202,26 +232,86 @@ gsl_ran_gaussian_ziggurat (const gsl_rng * r, const double sigma)
       if (j < ktab[i])
         break;
 
-      if (i < 127)
+      if (ziggurat_wedge (r, i, &x))
+        break;
+    }
+
+  return sign * sigma * x;
+}
+
+/* Fill an array with n gaussian variates using the ziggurat method.
+
+   For generators with at least 32 random bits, the raw integers for a
+   block of variates are generated at once with gsl_rng_get_array, and
+   the fast rectangle test (accepted about 99% of the time) is applied
+   to the whole block in a loop without data-dependent branches.  The
+   few rejected candidates are then completed with the wedge test,
+   restarting with gsl_ran_gaussian_ziggurat if that also fails.  The
+   variates have the same distribution as those of
+   gsl_ran_gaussian_ziggurat, but the sequence is different. */
+
+#define ZIGGURAT_BLOCK 256
+
+void
+gsl_ran_gaussian_array (const gsl_rng * r, const double sigma,
+                        double * x, size_t n)
+{
+  const unsigned long int range = r->type->max - r->type->min;
+  const unsigned long int offset = r->type->min;
+  unsigned long int k[ZIGGURAT_BLOCK];
+  size_t reject[ZIGGURAT_BLOCK];
+
+  if (range < 0xFFFFFFFF)
+    {
+      size_t l;
+
+      for (l = 0; l < n; l++)
+        x[l] = gsl_ran_gaussian_ziggurat (r, sigma);
+
+      return;
+    }
+
+  while (n > 0)
+    {
+      const size_t m = (n < ZIGGURAT_BLOCK) ? n : ZIGGURAT_BLOCK;
+      size_t l, nreject = 0;
+
+      gsl_rng_get_array (r, k, m);
+
+      for (l = 0; l < m; l++)
         {
-          double y0, y1, U1;
-          y0 = ytab[i];
-          y1 = ytab[i + 1];
-          U1 = gsl_rng_uniform (r);
-          y = y1 + (y0 - y1) * U1;
+          const unsigned long int kl = k[l] - offset;
+          const unsigned long int i = kl & 0x7f;
+          const long int j = (kl >> 8) & 0xFFFFFF;
+          const long int sign = (long int) ((kl >> 6) & 2) - 1;
+
+          /* the sign is applied arithmetically, a branch on a random
+             bit would be mispredicted half of the time */
+          x[l] = (sign * sigma) * (j * wtab[i]);
+          reject[nreject] = l;
+          nreject += ((unsigned long int) j >= ktab[i]);
         }
-      else
+
+      for (l = 0; l < nreject; l++)
         {
-          double U1, U2;
-          U1 = 1.0 - gsl_rng_uniform (r);
-          U2 = gsl_rng_uniform (r);
-          x = PARAM_R - log (U1) / PARAM_R;
-          y = exp (-PARAM_R * (x - 0.5 * PARAM_R)) * U2;
+          const size_t p = reject[l];
+          const unsigned long int kl = k[p] - offset;
+          const unsigned long int i = kl & 0x7f;
+          double xp = ((kl >> 8) & 0xFFFFFF) * wtab[i];
+
+          if (ziggurat_wedge (r, i, &xp))
+            x[p] = ((kl & 0x80) ? sigma : -sigma) * xp;
+          else
+            x[p] = gsl_ran_gaussian_ziggurat (r, sigma);
         }
 
-      if (y < exp (-0.5 * x * x))
-        break;
+      x += m;
+      n -= m;
     }
+}
 
-  return sign * sigma * x;
+void
+gsl_ran_ugaussian_array (const gsl_rng * r, double * x, size_t n)
+{
+  gsl_ran_gaussian_array (r, 1.0, x, n);
 }
@@ -47,6 +47,7 @@ unsigned int gsl_ran_binomial_tpe (const gsl_rng * r, double p, unsigned int n);
 double gsl_ran_binomial_pdf (const unsigned int k, const double p, const unsigned int n);
 
 double gsl_ran_exponential (const gsl_rng * r, const double mu);
+void gsl_ran_exponential_array (const gsl_rng * r, const double mu, double * x, size_t n);
 double gsl_ran_exponential_pdf (const double x, const double mu);
 
 double gsl_ran_exppow (const gsl_rng * r, const double a, const double b);
@@ -86,6 +87,9 @@ double gsl_ran_ugaussian (const gsl_rng * r);
 double gsl_ran_ugaussian_ratio_method (const gsl_rng * r);
 double gsl_ran_ugaussian_pdf (const double x);
 
+void gsl_ran_gaussian_array (const gsl_rng * r, const double sigma, double * x, size_t n);
+void gsl_ran_ugaussian_array (const gsl_rng * r, double * x, size_t n);
+
 double gsl_ran_gaussian_tail (const gsl_rng * r, const double a, const double sigma);
 double gsl_ran_gaussian_tail_pdf (const double x, const double a, const double sigma);
 
@@ -96,6 +100,13 @@ void gsl_ran_bivariate_gaussian (const gsl_rng * r, double sigma_x, double sigma
 double gsl_ran_bivariate_gaussian_pdf (const double x, const double y, const double sigma_x, const double sigma_y, const double rho);
 
 int gsl_ran_multivariate_gaussian (const gsl_rng * r, const gsl_vector * mu, const gsl_matrix * L, gsl_vector * result);
+int gsl_ran_multivariate_gaussian_array (const gsl_rng * r, const gsl_vector * mu, const gsl_matrix * L, gsl_matrix * X);
+int gsl_ran_multivariate_gaussian_lowrank_array (const gsl_rng * r,
+                                                 const gsl_vector * mu,
+                                                 const gsl_matrix * F,
+                                                 const gsl_vector * D,
+                                                 gsl_matrix * X,
+                                                 gsl_matrix * work);
 int gsl_ran_multivariate_gaussian_log_pdf (const gsl_vector * x,
                                            const gsl_vector * mu,
                                            const gsl_matrix * L,
@@ -182,6 +193,24 @@ void gsl_ran_dir_nd (const gsl_rng * r, size_t n, double * x);
 void gsl_ran_shuffle (const gsl_rng * r, void * base, size_t nmembm, size_t size);
 int gsl_ran_choose (const gsl_rng * r, void * dest, size_t k, void * src, size_t n, size_t size) ;
 void gsl_ran_sample (const gsl_rng * r, void * dest, size_t k, void * src, size_t n, size_t size) ;
+void gsl_ran_shuffle_merge (const gsl_rng * r, void * base, size_t n1, size_t n2, size_t size);
+
+typedef struct {                /* struct for reservoir sampling */
+    size_t k;                   /* capacity of the reservoir */
+    size_t size;                /* size of each item in bytes */
+    size_t n;                   /* number of items seen */
+    size_t next;                /* index of the next item to be taken */
+    double W;
+    void *sample;
+} gsl_ran_reservoir_t;
+
+gsl_ran_reservoir_t * gsl_ran_reservoir_alloc (size_t k, size_t size);
+void gsl_ran_reservoir_free (gsl_ran_reservoir_t * res);
+void gsl_ran_reservoir_reset (gsl_ran_reservoir_t * res);
+void gsl_ran_reservoir_add (const gsl_rng * r, gsl_ran_reservoir_t * res, const void * x);
+void gsl_ran_reservoir_add_array (const gsl_rng * r, gsl_ran_reservoir_t * res,
+                                  const void * src, size_t n);
+size_t gsl_ran_reservoir_get (void * dest, const gsl_ran_reservoir_t * res);
 
 
 typedef struct {                /* struct for Walker algorithm */
@@ -194,6 +223,82 @@ gsl_ran_discrete_t * gsl_ran_discrete_preproc (size_t K, const double *P);
 void gsl_ran_discrete_free(gsl_ran_discrete_t *g);
 size_t gsl_ran_discrete (const gsl_rng *r, const gsl_ran_discrete_t *g);
 double gsl_ran_discrete_pdf (size_t k, const gsl_ran_discrete_t *g);
+void gsl_ran_discrete_array (const gsl_rng *r, const gsl_ran_discrete_t *g,
+                             size_t *x, size_t n);
+
+typedef struct {                /* struct for weights which change */
+    size_t K;
+    size_t top;                 /* largest power of two <= K */
+    size_t nnonzero;            /* number of non-zero weights */
+    size_t nupdate;             /* updates since tree was rebuilt */
+    double total;
+    double *w;                  /* weights */
+    double *tree;               /* Fenwick tree of partial sums */
+} gsl_ran_discrete_dynamic_t;
+
+gsl_ran_discrete_dynamic_t * gsl_ran_discrete_dynamic_alloc (size_t K, const double *P);
+void gsl_ran_discrete_dynamic_free (gsl_ran_discrete_dynamic_t *g);
+int gsl_ran_discrete_dynamic_init (gsl_ran_discrete_dynamic_t *g, const double *P);
+int gsl_ran_discrete_dynamic_update (gsl_ran_discrete_dynamic_t *g, size_t k, double p);
+double gsl_ran_discrete_dynamic_weight (size_t k, const gsl_ran_discrete_dynamic_t *g);
+size_t gsl_ran_discrete_dynamic (const gsl_rng *r, const gsl_ran_discrete_dynamic_t *g);
+void gsl_ran_discrete_dynamic_array (const gsl_rng *r, const gsl_ran_discrete_dynamic_t *g,
+                                     size_t *x, size_t n);
+double gsl_ran_discrete_dynamic_pdf (size_t k, const gsl_ran_discrete_dynamic_t *g);
+
+/* samplers with precomputed constants for fixed parameters */
+
+typedef struct {
+    double a, b;                /* shape and scale */
+    double ainv;                /* 1/a, used when a < 1 */
+    double d, c, bd;            /* Marsaglia-Tsang constants */
+} gsl_ran_gamma_sampler;
+
+gsl_ran_gamma_sampler * gsl_ran_gamma_sampler_alloc (const double a, const double b);
+void gsl_ran_gamma_sampler_free (gsl_ran_gamma_sampler * s);
+double gsl_ran_gamma_sampler_get (const gsl_rng * r, const gsl_ran_gamma_sampler * s);
+void gsl_ran_gamma_sampler_array (const gsl_rng * r, const gsl_ran_gamma_sampler * s,
+                                  double * x, size_t n);
+
+typedef struct {
+    double a, b;
+    double ainv, binv;          /* used when a <= 1 and b <= 1 */
+    gsl_ran_gamma_sampler *ga, *gb;     /* used otherwise */
+} gsl_ran_beta_sampler;
+
+gsl_ran_beta_sampler * gsl_ran_beta_sampler_alloc (const double a, const double b);
+void gsl_ran_beta_sampler_free (gsl_ran_beta_sampler * s);
+double gsl_ran_beta_sampler_get (const gsl_rng * r, const gsl_ran_beta_sampler * s);
+void gsl_ran_beta_sampler_array (const gsl_rng * r, const gsl_ran_beta_sampler * s,
+                                 double * x, size_t n);
+
+typedef struct {
+    double mu;
+    double emu;                 /* exp(-mu), used when mu <= 10 */
+    double a, b, vr, loginvalpha, logmu;     /* PTRS constants */
+} gsl_ran_poisson_sampler;
+
+gsl_ran_poisson_sampler * gsl_ran_poisson_sampler_alloc (const double mu);
+void gsl_ran_poisson_sampler_free (gsl_ran_poisson_sampler * s);
+unsigned int gsl_ran_poisson_sampler_get (const gsl_rng * r, const gsl_ran_poisson_sampler * s);
+void gsl_ran_poisson_sampler_array (const gsl_rng * r, const gsl_ran_poisson_sampler * s,
+                                    unsigned int * x, size_t n);
+
+typedef struct {
+    unsigned int n;
+    int flipped;                /* set if p > 0.5 was replaced by 1-p */
+    double p, q, s, np;
+    double f0;                  /* (1-p)^n, used by BINV */
+    int m;                      /* BTPE constants */
+    double fm, xm, npq, g;
+    double p1, p2, p3, p4, xl, xr, c, lambda_l, lambda_r;
+} gsl_ran_binomial_sampler;
+
+gsl_ran_binomial_sampler * gsl_ran_binomial_sampler_alloc (const double p, const unsigned int n);
+void gsl_ran_binomial_sampler_free (gsl_ran_binomial_sampler * s);
+unsigned int gsl_ran_binomial_sampler_get (const gsl_rng * r, const gsl_ran_binomial_sampler * s);
+void gsl_ran_binomial_sampler_array (const gsl_rng * r, const gsl_ran_binomial_sampler * s,
+                                     unsigned int * x, size_t n);
 
 
 __END_DECLS
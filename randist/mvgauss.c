@@ -30,6 +30,8 @@
 
 static int multivar_vcov (const double data[], size_t d, size_t tda, size_t n,
                           double vcov[], size_t tda2);
+static void multivar_ugaussian (const gsl_rng * r, gsl_matrix * A);
+static void multivar_add_mean (const gsl_vector * mu, gsl_matrix * X);
 
 /* Generate a random vector from a multivariate Gaussian distribution using
  * the Cholesky decomposition of the variance-covariance matrix, following
@@ -75,6 +77,165 @@ gsl_ran_multivariate_gaussian (const gsl_rng * r,
     }
 }
 
+/* Generate n random vectors from a multivariate Gaussian distribution at
+ * once. The rows of X are filled with standard normal variates and
+ * multiplied by L^T with a single level-3 BLAS call,
+ *
+ *   X := mu^T + Z L^T
+ *
+ * which is much faster than n calls to gsl_ran_multivariate_gaussian()
+ * for large n. The variates are not the same as those from repeated
+ * calls to gsl_ran_multivariate_gaussian().
+ *
+ * mu      mean vector (dimension d)
+ * L       matrix resulting from the Cholesky decomposition of
+ *         variance-covariance matrix Sigma = L L^T (dimension d x d)
+ * X       output samples, one per row (dimension n x d)
+ */
+int
+gsl_ran_multivariate_gaussian_array (const gsl_rng * r,
+                                     const gsl_vector * mu,
+                                     const gsl_matrix * L,
+                                     gsl_matrix * X)
+{
+  const size_t M = L->size1;
+  const size_t N = L->size2;
+
+  if (M != N)
+    {
+      GSL_ERROR("requires square matrix", GSL_ENOTSQR);
+    }
+  else if (mu->size != M)
+    {
+      GSL_ERROR("incompatible dimension of mean vector with variance-covariance matrix", GSL_EBADLEN);
+    }
+  else if (X->size2 != M)
+    {
+      GSL_ERROR("incompatible dimension of result matrix", GSL_EBADLEN);
+    }
+  else
+    {
+      multivar_ugaussian(r, X);
+
+      /* compute: X = X L^T */
+      gsl_blas_dtrmm(CblasRight, CblasLower, CblasTrans, CblasNonUnit, 1.0, L, X);
+
+      multivar_add_mean(mu, X);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* Generate n random vectors from a multivariate Gaussian distribution whose
+ * variance-covariance matrix has the factor structure
+ *
+ *   Sigma = F F^T + diag(D)
+ *
+ * where F has d rows and q << d columns, for example the loadings of a
+ * factor model. No d x d factorization is needed, and the samples are
+ *
+ *   X := mu^T + Z F^T + E diag(sqrt(D))
+ *
+ * where Z and E are matrices of standard normal variates, so that the
+ * cost is O(n d q) in one level-3 BLAS call.
+ *
+ * mu      mean vector (dimension d)
+ * F       factor loadings (dimension d x q)
+ * D       diagonal variances, D_i >= 0 (dimension d)
+ * X       output samples, one per row (dimension n x d)
+ * work    on output, the factor variates Z (dimension n x q)
+ */
+int
+gsl_ran_multivariate_gaussian_lowrank_array (const gsl_rng * r,
+                                             const gsl_vector * mu,
+                                             const gsl_matrix * F,
+                                             const gsl_vector * D,
+                                             gsl_matrix * X,
+                                             gsl_matrix * work)
+{
+  const size_t M = F->size1;
+
+  if (mu->size != M)
+    {
+      GSL_ERROR("incompatible dimension of mean vector with factor matrix", GSL_EBADLEN);
+    }
+  else if (D->size != M)
+    {
+      GSL_ERROR("incompatible dimension of diagonal vector with factor matrix", GSL_EBADLEN);
+    }
+  else if (X->size2 != M)
+    {
+      GSL_ERROR("incompatible dimension of result matrix", GSL_EBADLEN);
+    }
+  else if (work->size1 != X->size1 || work->size2 != F->size2)
+    {
+      GSL_ERROR("work matrix must be n-by-q", GSL_EBADLEN);
+    }
+  else
+    {
+      size_t i, j;
+
+      for (j = 0; j < M; ++j)
+        {
+          if (!(gsl_vector_get(D, j) >= 0.0))
+            {
+              GSL_ERROR("diagonal variances must be non-negative", GSL_EDOM);
+            }
+        }
+
+      multivar_ugaussian(r, work);
+      multivar_ugaussian(r, X);
+
+      /* compute: X = E diag(sqrt(D)) */
+      for (j = 0; j < M; ++j)
+        {
+          const double sj = sqrt(gsl_vector_get(D, j));
+
+          for (i = 0; i < X->size1; ++i)
+            X->data[i * X->tda + j] *= sj;
+        }
+
+      /* compute: X = X + Z F^T */
+      gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, work, F, 1.0, X);
+
+      multivar_add_mean(mu, X);
+
+      return GSL_SUCCESS;
+    }
+}
+
+/* fill A with standard normal variates, row by row */
+static void
+multivar_ugaussian (const gsl_rng * r, gsl_matrix * A)
+{
+  if (A->tda == A->size2)
+    {
+      gsl_ran_ugaussian_array(r, A->data, A->size1 * A->size2);
+    }
+  else
+    {
+      size_t i;
+
+      for (i = 0; i < A->size1; ++i)
+        gsl_ran_ugaussian_array(r, A->data + i * A->tda, A->size2);
+    }
+}
+
+/* add the vector mu to each row of X */
+static void
+multivar_add_mean (const gsl_vector * mu, gsl_matrix * X)
+{
+  size_t i, j;
+
+  for (i = 0; i < X->size1; ++i)
+    {
+      double *xi = X->data + i * X->tda;
+
+      for (j = 0; j < X->size2; ++j)
+        xi[j] += gsl_vector_get(mu, j);
+    }
+}
+
 /* Compute the log of the probability density function at a given quantile
  * vector for a multivariate Gaussian distribution using the Cholesky
  * decomposition of the variance-covariance matrix.
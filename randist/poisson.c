@@ -18,7 +18,10 @@
  */
 
 #include <config.h>
+#include <stdlib.h>
+#include <limits.h>
 #include <math.h>
+#include <gsl/gsl_errno.h>
 #include <gsl/gsl_sf_gamma.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
@@ -82,6 +85,110 @@ gsl_ran_poisson_array (const gsl_rng * r, size_t n, unsigned int array[],
   return;
 }
 
+/* A Poisson sampler precomputes the constants for a fixed mean mu.
+   For mu <= 10 it uses the same method as gsl_ran_poisson, and gives
+   the same sequence of variates.  For mu > 10 it uses the PTRS
+   transformed rejection method of W. Hormann, "The transformed
+   rejection method for generating Poisson random variables",
+   Insurance: Mathematics and Economics 12 (1993) 39-45, whose cost is
+   independent of mu once the constants are known. */
+
+gsl_ran_poisson_sampler *
+gsl_ran_poisson_sampler_alloc (const double mu)
+{
+  gsl_ran_poisson_sampler *s;
+
+  if (!(mu >= 0))
+    {
+      GSL_ERROR_NULL ("mean mu must be non-negative", GSL_EDOM);
+    }
+
+  s = (gsl_ran_poisson_sampler *) malloc (sizeof (gsl_ran_poisson_sampler));
+
+  if (s == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for poisson sampler",
+                      GSL_ENOMEM);
+    }
+
+  s->mu = mu;
+  s->emu = exp (-mu);
+  s->a = 0;
+  s->b = 0;
+  s->vr = 0;
+  s->loginvalpha = 0;
+  s->logmu = 0;
+
+  if (mu > 10)
+    {
+      s->b = 0.931 + 2.53 * sqrt (mu);
+      s->a = -0.059 + 0.02483 * s->b;
+      s->vr = 0.9277 - 3.6224 / (s->b - 2.0);
+      s->loginvalpha = log (1.1239 + 1.1328 / (s->b - 3.4));
+      s->logmu = log (mu);
+    }
+
+  return s;
+}
+
+void
+gsl_ran_poisson_sampler_free (gsl_ran_poisson_sampler * s)
+{
+  RETURN_IF_NULL (s);
+  free (s);
+}
+
+unsigned int
+gsl_ran_poisson_sampler_get (const gsl_rng * r,
+                             const gsl_ran_poisson_sampler * s)
+{
+  if (s->mu <= 10)
+    {
+      double prod = 1.0;
+      unsigned int k = 0;
+
+      do
+        {
+          prod *= gsl_rng_uniform (r);
+          k++;
+        }
+      while (prod > s->emu);
+
+      return k - 1;
+    }
+
+  while (1)
+    {
+      double u = gsl_rng_uniform_pos (r) - 0.5;
+      double v = gsl_rng_uniform_pos (r);
+      double us = 0.5 - fabs (u);
+      double k = floor ((2.0 * s->a / us + s->b) * u + s->mu + 0.43);
+
+      /* fast acceptance in the central region */
+
+      if (us >= 0.07 && v <= s->vr)
+        return (unsigned int) k;
+
+      if (k < 0 || k > UINT_MAX || (us < 0.013 && v > us))
+        continue;
+
+      if (log (v) + s->loginvalpha - log (s->a / (us * us) + s->b)
+          <= -s->mu + k * s->logmu - gsl_sf_lnfact ((unsigned int) k))
+        return (unsigned int) k;
+    }
+}
+
+void
+gsl_ran_poisson_sampler_array (const gsl_rng * r,
+                               const gsl_ran_poisson_sampler * s,
+                               unsigned int * x, size_t n)
+{
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = gsl_ran_poisson_sampler_get (r, s);
+}
+
 double
 gsl_ran_poisson_pdf (const unsigned int k, const double mu)
 {
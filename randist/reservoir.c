@@ -0,0 +1,173 @@
+/* randist/reservoir.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Reservoir sampling: choose k items without replacement, each with
+   equal probability, from a stream whose length is not known in
+   advance.
+
+   The first k items fill the reservoir.  After that, the gaps between
+   items which enter the reservoir are generated directly, using
+   Algorithm L of K.-H. Li, "Reservoir-sampling algorithms of time
+   complexity O(n(1 + log(N/n)))", ACM Trans. Math. Softw. 20, 481-493
+   (1994).  The variable W is distributed as the largest of k uniform
+   variates, and the number of items skipped before the next one is
+   taken is geometric with parameter W.  The expected number of random
+   numbers used for N items is O(k (1 + log(N/k))), so items which are
+   skipped cost only a counter increment. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_rng.h>
+#include <gsl/gsl_randist.h>
+
+/* advance W and the index of the next item to be taken */
+static void
+reservoir_next (const gsl_rng * r, gsl_ran_reservoir_t * res)
+{
+  const size_t limit = (size_t) -1;
+  double skip;
+
+  res->W *= exp (log (gsl_rng_uniform_pos (r)) / res->k);
+  skip = floor (log (gsl_rng_uniform_pos (r)) / log1p (-res->W));
+
+  if (skip < (double) (limit - res->next - 1))
+    res->next += (size_t) skip + 1;
+  else
+    res->next = limit;          /* beyond the end of any stream */
+}
+
+static inline void
+reservoir_store (gsl_ran_reservoir_t * res, size_t i, const void * x)
+{
+  memcpy ((char *) res->sample + i * res->size, x, res->size);
+}
+
+gsl_ran_reservoir_t *
+gsl_ran_reservoir_alloc (size_t k, size_t size)
+{
+  gsl_ran_reservoir_t *res;
+
+  if (k == 0)
+    {
+      GSL_ERROR_NULL ("reservoir size k must be positive", GSL_EINVAL);
+    }
+  else if (size == 0)
+    {
+      GSL_ERROR_NULL ("element size must be positive", GSL_EINVAL);
+    }
+
+  res = (gsl_ran_reservoir_t *) malloc (sizeof (gsl_ran_reservoir_t));
+
+  if (res == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for struct", GSL_ENOMEM);
+    }
+
+  res->sample = malloc (k * size);
+
+  if (res->sample == 0)
+    {
+      free (res);
+      GSL_ERROR_NULL ("failed to allocate space for sample", GSL_ENOMEM);
+    }
+
+  res->k = k;
+  res->size = size;
+
+  gsl_ran_reservoir_reset (res);
+
+  return res;
+}
+
+void
+gsl_ran_reservoir_free (gsl_ran_reservoir_t * res)
+{
+  RETURN_IF_NULL (res);
+  free (res->sample);
+  free (res);
+}
+
+void
+gsl_ran_reservoir_reset (gsl_ran_reservoir_t * res)
+{
+  res->n = 0;
+  res->next = 0;
+  res->W = 1.0;
+}
+
+void
+gsl_ran_reservoir_add (const gsl_rng * r, gsl_ran_reservoir_t * res,
+                       const void * x)
+{
+  if (res->n < res->k)
+    {
+      reservoir_store (res, res->n, x);
+
+      if (res->n + 1 == res->k)
+        {
+          res->next = res->n;
+          reservoir_next (r, res);
+        }
+    }
+  else if (res->n == res->next)
+    {
+      reservoir_store (res, gsl_rng_uniform_int (r, res->k), x);
+      reservoir_next (r, res);
+    }
+
+  res->n++;
+}
+
+/* Add n items from the array src, jumping directly to the items which
+   enter the reservoir.  The result is the same as n calls to
+   gsl_ran_reservoir_add(). */
+
+void
+gsl_ran_reservoir_add_array (const gsl_rng * r, gsl_ran_reservoir_t * res,
+                             const void * src, size_t n)
+{
+  const char *x = (const char *) src;
+  const size_t start = res->n;
+
+  while (res->n < res->k && res->n - start < n)
+    {
+      gsl_ran_reservoir_add (r, res, x + (res->n - start) * res->size);
+    }
+
+  while (res->n >= res->k && res->next - start < n)
+    {
+      res->n = res->next;
+      gsl_ran_reservoir_add (r, res, x + (res->n - start) * res->size);
+    }
+
+  res->n = start + n;
+}
+
+size_t
+gsl_ran_reservoir_get (void * dest, const gsl_ran_reservoir_t * res)
+{
+  const size_t m = (res->n < res->k) ? res->n : res->k;
+
+  memcpy (dest, res->sample, m * res->size);
+
+  return m;
+}
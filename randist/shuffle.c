@@ -20,10 +20,24 @@
 #include <config.h>
 #include <stdlib.h>
 #include <math.h>
+#include <string.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_randist.h>
 
-/* Inline swap and copy functions for moving objects around */
+/* Inline swap and copy functions for moving objects around.  Objects
+   of 4, 8 or 16 bytes are moved with fixed-size memcpy calls, which
+   compile to single loads and stores and do not require alignment;
+   other sizes are moved byte by byte. */
+
+#define SWAP_FIXED(n)                           \
+  do                                            \
+    {                                           \
+      char tmp[n];                              \
+      memcpy (tmp, a, n);                       \
+      memcpy (a, b, n);                         \
+      memcpy (b, tmp, n);                       \
+    }                                           \
+  while (0)
 
 static inline 
 void swap (void * base, size_t size, size_t i, size_t j)
@@ -34,6 +48,19 @@ void swap (void * base, size_t size, size_t i, size_t j)
 
   if (i == j)
     return ;
+
+  switch (size)
+    {
+    case 4:
+      SWAP_FIXED (4);
+      return ;
+    case 8:
+      SWAP_FIXED (8);
+      return ;
+    case 16:
+      SWAP_FIXED (16);
+      return ;
+    }
   
   do                                            
     {                                           
@@ -50,6 +77,19 @@ copy (void * dest, size_t i, void * src, size_t j, size_t size)
   register char * a = size * i + (char *) dest ;
   register char * b = size * j + (char *) src ;
   register size_t s = size ;
+
+  switch (size)
+    {
+    case 4:
+      memcpy (a, b, 4);
+      return ;
+    case 8:
+      memcpy (a, b, 8);
+      return ;
+    case 16:
+      memcpy (a, b, 16);
+      return ;
+    }
   
   do                                            
     {                                           
@@ -70,6 +110,9 @@ gsl_ran_shuffle (const gsl_rng * r, void * base, size_t n, size_t size)
 {
   size_t i ;
 
+  if (n == 0)
+    return ;
+
   for (i = n - 1; i > 0; i--)
     {
       size_t j = gsl_rng_uniform_int(r, i+1); /* originally (i + 1) * gsl_rng_uniform (r) */
@@ -78,6 +121,86 @@ gsl_ran_shuffle (const gsl_rng * r, void * base, size_t n, size_t size)
     }
 }
 
+/* Random bits for the merge step, 32 at a time from generators whose
+   output covers a power of two range of at least 2^32, and one at a
+   time otherwise. */
+
+static inline int
+merge_bit (const gsl_rng * r, int word, unsigned long int * bits, int * nbits)
+{
+  int b;
+
+  if (!word)
+    return (int) gsl_rng_uniform_int (r, 2);
+
+  if (*nbits == 0)
+    {
+      *bits = (gsl_rng_get (r) - r->type->min) & 0xffffffffUL;
+      *nbits = 32;
+    }
+
+  b = (int) (*bits & 1);
+  *bits >>= 1;
+  (*nbits)--;
+
+  return b;
+}
+
+/* Merge two shuffled arrays into one uniformly shuffled array, using
+   the MergeShuffle algorithm of A. Bacher, O. Bodini, A. Hollender and
+   J. Lumbroso, "MergeShuffle: a very fast, parallel random permutation
+   algorithm", arXiv:1508.03167 (2015).
+
+   On input base[0..n1-1] and base[n1..n1+n2-1] are each in uniformly
+   random order.  Elements are taken from the two halves by coin flips
+   until one of them runs out, and the rest are inserted at random
+   positions as in the Fisher-Yates shuffle.  The expected number of
+   random numbers is n1 + n2 + O(sqrt(n1 + n2) log(n1 + n2)), most of
+   them single bits.
+
+   Shuffling blocks of a large array independently, for example in
+   separate threads with generators from gsl_rng_split, and merging
+   them pairwise gives a uniformly random permutation of the whole
+   array. */
+
+void
+gsl_ran_shuffle_merge (const gsl_rng * r, void * base, size_t n1, size_t n2,
+                       size_t size)
+{
+  const unsigned long int range = r->type->max - r->type->min;
+  const int word = (range >= 0xffffffffUL && (range & (range + 1)) == 0);
+  const size_t n = n1 + n2;
+  unsigned long int bits = 0;
+  int nbits = 0;
+  size_t i = 0, j = n1;
+
+  while (1)
+    {
+      if (merge_bit (r, word, &bits, &nbits) == 0)
+        {
+          if (i == j)
+            break ;
+        }
+      else
+        {
+          if (j == n)
+            break ;
+
+          swap (base, size, i, j) ;
+          j++ ;
+        }
+
+      i++ ;
+    }
+
+  for (; i < n; i++)
+    {
+      size_t k = gsl_rng_uniform_int (r, i + 1);
+
+      swap (base, size, i, k) ;
+    }
+}
+
 int
 gsl_ran_choose (const gsl_rng * r, void * dest, size_t k, void * src, 
                  size_t n, size_t size)
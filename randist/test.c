@@ -47,8 +47,13 @@ void testDiscretePDF (double (*f) (void), double (*pdf) (unsigned int),
 
 void test_shuffle (void);
 void test_choose (void);
+void test_shuffle_size (size_t size);
+void test_shuffle_merge (size_t n1, size_t n2);
+void test_reservoir (void);
 double test_beta (void);
 double test_beta_pdf (double x);
+double test_beta_sampler (void);
+double test_beta_sampler_pdf (double x);
 double test_bernoulli (void);
 double test_bernoulli_pdf (unsigned int n);
 
@@ -56,6 +61,8 @@ double test_binomial (void);
 double test_binomial_pdf (unsigned int n);
 double test_binomial_large (void);
 double test_binomial_large_pdf (unsigned int n);
+double test_binomial_sampler (void);
+double test_binomial_sampler_pdf (unsigned int n);
 double test_binomial_huge (void);
 double test_binomial_huge_pdf (unsigned int n);
 double test_binomial_max (void);
@@ -91,10 +98,16 @@ double test_discrete2 (void);
 double test_discrete2_pdf (unsigned int n);
 double test_discrete3 (void);
 double test_discrete3_pdf (unsigned int n);
+double test_discrete_dynamic (void);
+double test_discrete_dynamic_pdf (unsigned int n);
+void test_discrete_array (void);
+void test_discrete_dynamic_updates (void);
 double test_erlang (void);
 double test_erlang_pdf (double x);
 double test_exponential (void);
 double test_exponential_pdf (double x);
+double test_exponential_array (void);
+double test_exponential_array_pdf (double x);
 double test_exppow0 (void);
 double test_exppow0_pdf (double x);
 double test_exppow1 (void);
@@ -125,6 +138,10 @@ double test_gamma_vlarge (void);
 double test_gamma_vlarge_pdf (double x);
 double test_gamma_small (void);
 double test_gamma_small_pdf (double x);
+double test_gamma_sampler (void);
+double test_gamma_sampler_pdf (double x);
+double test_gamma_sampler_small (void);
+double test_gamma_sampler_small_pdf (double x);
 double test_gamma_mt (void);
 double test_gamma_mt_pdf (double x);
 double test_gamma_mt1 (void);
@@ -143,6 +160,8 @@ double test_gaussian_ratio_method (void);
 double test_gaussian_ratio_method_pdf (double x);
 double test_gaussian_ziggurat (void);
 double test_gaussian_ziggurat_pdf (double x);
+double test_gaussian_array (void);
+double test_gaussian_array_pdf (double x);
 double test_gaussian_tail (void);
 double test_gaussian_tail_pdf (double x);
 double test_gaussian_tail1 (void);
@@ -153,6 +172,8 @@ double test_ugaussian (void);
 double test_ugaussian_pdf (double x);
 double test_ugaussian_ratio_method (void);
 double test_ugaussian_ratio_method_pdf (double x);
+double test_ugaussian_array (void);
+double test_ugaussian_array_pdf (double x);
 double test_ugaussian_tail (void);
 double test_ugaussian_tail_pdf (double x);
 double test_bivariate_gaussian1 (void);
@@ -166,6 +187,8 @@ double test_bivariate_gaussian4_pdf (double x);
 void test_multivariate_gaussian_log_pdf (void);
 void test_multivariate_gaussian_pdf (void);
 void test_multivariate_gaussian (void);
+void test_multivariate_gaussian_array (void);
+void test_multivariate_gaussian_lowrank_array (void);
 double test_gumbel1 (void);
 double test_gumbel1_pdf (double x);
 double test_gumbel2 (void);
@@ -219,6 +242,7 @@ double test_multinomial_pdf (unsigned int n);
 double test_multinomial_large (void);
 double test_multinomial_large_pdf (unsigned int n);
 void test_multinomial_moments (void);
+void test_samplers (void);
 double test_negative_binomial (void);
 double test_negative_binomial_pdf (unsigned int n);
 double test_pascal (void);
@@ -229,6 +253,12 @@ double test_poisson (void);
 double test_poisson_pdf (unsigned int x);
 double test_poisson_large (void);
 double test_poisson_large_pdf (unsigned int x);
+double test_poisson_sampler (void);
+double test_poisson_sampler_pdf (unsigned int x);
+double test_poisson_sampler_large (void);
+double test_poisson_sampler_large_pdf (unsigned int x);
+double test_poisson_sampler_vlarge (void);
+double test_poisson_sampler_vlarge_pdf (unsigned int x);
 double test_dir2d (void);
 double test_dir2d_pdf (double x);
 double test_dir2d_trig_method (void);
@@ -259,6 +289,15 @@ gsl_rng *r_global;
 static gsl_ran_discrete_t *g1 = NULL;
 static gsl_ran_discrete_t *g2 = NULL;
 static gsl_ran_discrete_t *g3 = NULL;
+static gsl_ran_discrete_dynamic_t *gd = NULL;
+
+static gsl_ran_gamma_sampler *sgamma = NULL;
+static gsl_ran_gamma_sampler *sgamma_small = NULL;
+static gsl_ran_beta_sampler *sbeta = NULL;
+static gsl_ran_poisson_sampler *spoisson = NULL;
+static gsl_ran_poisson_sampler *spoisson_large = NULL;
+static gsl_ran_poisson_sampler *spoisson_vlarge = NULL;
+static gsl_ran_binomial_sampler *sbinomial = NULL;
 
 int
 main (void)
@@ -273,10 +312,22 @@ main (void)
 
   test_shuffle ();
   test_choose ();
+  test_shuffle_size (1);
+  test_shuffle_size (8);
+  test_shuffle_size (16);
+  test_shuffle_size (24);
+  test_shuffle_merge (2, 2);
+  test_shuffle_merge (1, 3);
+  test_shuffle_merge (3, 1);
+  test_shuffle_merge (0, 4);
+  test_shuffle_merge (4, 0);
+  test_reservoir ();
 
   testMoments (FUNC (ugaussian), 0.0, 100.0, 0.5);
   testMoments (FUNC (ugaussian), -1.0, 1.0, 0.6826895);
   testMoments (FUNC (ugaussian), 3.0, 3.5, 0.0011172689);
+  testMoments (FUNC (ugaussian_array), -1.0, 1.0, 0.6826895);
+  testMoments (FUNC (ugaussian_array), 3.0, 3.5, 0.0011172689);
   testMoments (FUNC (ugaussian_tail), 3.0, 3.5, 0.0011172689 / 0.0013498981);
   testMoments (FUNC (exponential), 0.0, 1.0, 1 - exp (-0.5));
   testMoments (FUNC (cauchy), 0.0, 10000.0, 0.5);
@@ -292,10 +343,15 @@ main (void)
   testMoments (FUNC (discrete3),  0.5, 1.5, 0.05 );
   testMoments (FUNC (discrete3), -0.5, 9.5, 0.5 );
 
+  test_discrete_array ();
+  test_discrete_dynamic_updates ();
+
   test_dirichlet_moments ();
   test_multinomial_moments ();
+  test_samplers ();
 
   testPDF (FUNC2 (beta));
+  testPDF (FUNC2 (beta_sampler));
   testPDF (FUNC2 (cauchy));
   testPDF (FUNC2 (chisq));
   testPDF (FUNC2 (chisqnu2));
@@ -303,6 +359,7 @@ main (void)
   testPDF (FUNC2 (dirichlet_small));
   testPDF (FUNC2 (erlang));
   testPDF (FUNC2 (exponential));
+  testPDF (FUNC2 (exponential_array));
 
   testPDF (FUNC2 (exppow0));
   testPDF (FUNC2 (exppow1));
@@ -321,6 +378,8 @@ main (void)
   testPDF (FUNC2 (gamma_vlarge));
   testPDF (FUNC2 (gamma_knuth_vlarge));
   testPDF (FUNC2 (gamma_small));
+  testPDF (FUNC2 (gamma_sampler));
+  testPDF (FUNC2 (gamma_sampler_small));
   testPDF (FUNC2 (gamma_mt));
   testPDF (FUNC2 (gamma_mt1));
   testPDF (FUNC2 (gamma_mt_int));
@@ -329,8 +388,10 @@ main (void)
   testPDF (FUNC2 (gaussian));
   testPDF (FUNC2 (gaussian_ratio_method));
   testPDF (FUNC2 (gaussian_ziggurat));
+  testPDF (FUNC2 (gaussian_array));
   testPDF (FUNC2 (ugaussian));
   testPDF (FUNC2 (ugaussian_ratio_method));
+  testPDF (FUNC2 (ugaussian_array));
   testPDF (FUNC2 (gaussian_tail));
   testPDF (FUNC2 (gaussian_tail1));
   testPDF (FUNC2 (gaussian_tail2));
@@ -344,6 +405,8 @@ main (void)
   test_multivariate_gaussian_log_pdf ();
   test_multivariate_gaussian_pdf ();
   test_multivariate_gaussian ();
+  test_multivariate_gaussian_array ();
+  test_multivariate_gaussian_lowrank_array ();
 
   testPDF (FUNC2 (gumbel1));
   testPDF (FUNC2 (gumbel2));
@@ -378,14 +441,19 @@ main (void)
   testDiscretePDF (FUNC2 (discrete1));
   testDiscretePDF (FUNC2 (discrete2));
   testDiscretePDF (FUNC2 (discrete3));
+  testDiscretePDF (FUNC2 (discrete_dynamic));
   testDiscretePDF (FUNC2 (poisson));
   testDiscretePDF (FUNC2 (poisson_large));
+  testDiscretePDF (FUNC2 (poisson_sampler));
+  testDiscretePDF (FUNC2 (poisson_sampler_large));
+  testDiscretePDF (FUNC2 (poisson_sampler_vlarge));
   testDiscretePDF (FUNC2 (bernoulli));
   testDiscretePDF (FUNC2 (binomial));
   testDiscretePDF (FUNC2 (binomial0));
   testDiscretePDF (FUNC2 (binomial1));
   testDiscretePDF (FUNC2 (binomial_knuth));
   testDiscretePDF (FUNC2 (binomial_large));
+  testDiscretePDF (FUNC2 (binomial_sampler));
   testDiscretePDF (FUNC2 (binomial_large_knuth));
   testDiscretePDF (FUNC2 (binomial_huge));
   testDiscretePDF (FUNC2 (binomial_huge_knuth));
@@ -408,6 +476,14 @@ main (void)
   gsl_ran_discrete_free (g1);
   gsl_ran_discrete_free (g2);
   gsl_ran_discrete_free (g3);
+  gsl_ran_discrete_dynamic_free (gd);
+  gsl_ran_gamma_sampler_free (sgamma);
+  gsl_ran_gamma_sampler_free (sgamma_small);
+  gsl_ran_beta_sampler_free (sbeta);
+  gsl_ran_poisson_sampler_free (spoisson);
+  gsl_ran_poisson_sampler_free (spoisson_large);
+  gsl_ran_poisson_sampler_free (spoisson_vlarge);
+  gsl_ran_binomial_sampler_free (sbinomial);
 
   exit (gsl_test_summary ());
 }
@@ -501,6 +577,211 @@ test_choose (void)
 
 }
 
+/* Shuffle, choose and sample objects of the given size, identified by
+   their first byte.  These tests use their own generators so that the
+   sequence seen by the other tests is unchanged. */
+void
+test_shuffle_size (size_t size)
+{
+  double count[10][10], ccount[10], scount[10];
+  unsigned char x[10 * 24], y[3 * 24];
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  int i, j, status = 0;
+
+  for (i = 0; i < 10; i++)
+    {
+      ccount[i] = 0;
+      scount[i] = 0;
+
+      for (j = 0; j < 10; j++)
+        count[i][j] = 0;
+    }
+
+  for (i = 0; i < N; i++)
+    {
+      for (j = 0; j < 10 * (int) size; j++)
+        x[j] = (unsigned char) (j / size + (j % size) * 11);
+
+      gsl_ran_shuffle (r, x, 10, size);
+
+      for (j = 0; j < 10; j++)
+        {
+          int k = x[j * size];
+          size_t l;
+
+          count[k][j]++;
+
+          for (l = 1; l < size; l++)
+            status |= (x[j * size + l] != (unsigned char) (k + l * 11));
+        }
+
+      gsl_ran_choose (r, y, 3, x, 10, size);
+
+      for (j = 0; j < 3; j++)
+        ccount[y[j * size]]++;
+
+      gsl_ran_sample (r, y, 3, x, 10, size);
+
+      for (j = 0; j < 3; j++)
+        scount[y[j * size]]++;
+    }
+
+  gsl_test (status, "gsl_ran_shuffle size %u, objects intact", (unsigned int) size);
+  status = 0;
+
+  for (i = 0; i < 10; i++)
+    {
+      const double cexp = 3.0 * N / 10.0;
+
+      for (j = 0; j < 10; j++)
+        {
+          double expected = N / 10.0;
+          double d = fabs (count[i][j] - expected);
+          status |= (d / sqrt (expected) > 5 && d > 1);
+        }
+
+      status |= (fabs (ccount[i] - cexp) / sqrt (cexp) > 5);
+      status |= (fabs (scount[i] - cexp) / sqrt (cexp) > 5);
+    }
+
+  gsl_test (status, "gsl_ran_shuffle, choose and sample, size %u",
+            (unsigned int) size);
+
+  gsl_rng_free (r);
+}
+
+/* shuffle the two parts of {0,1,2,3} separately, merge them, and check
+   that all 24 permutations are equally likely */
+void
+test_shuffle_merge (size_t n1, size_t n2)
+{
+  double count[24];
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  int i, j, status = 0;
+
+  for (i = 0; i < 24; i++)
+    count[i] = 0;
+
+  for (i = 0; i < N; i++)
+    {
+      int x[4] = { 0, 1, 2, 3 };
+      int k, rank = 0, used = 0;
+
+      gsl_ran_shuffle (r, x, n1, sizeof (int));
+      gsl_ran_shuffle (r, x + n1, n2, sizeof (int));
+      gsl_ran_shuffle_merge (r, x, n1, n2, sizeof (int));
+
+      /* lexicographic rank of the permutation */
+      for (j = 0; j < 4; j++)
+        {
+          int smaller = 0;
+
+          for (k = 0; k < x[j]; k++)
+            smaller += !((used >> k) & 1);
+
+          used |= 1 << x[j];
+          rank = rank * (4 - j) + smaller;
+        }
+
+      count[rank]++;
+    }
+
+  for (i = 0; i < 24; i++)
+    {
+      double expected = N / 24.0;
+      double d = fabs (count[i] - expected);
+      status |= (d / sqrt (expected) > 5);
+    }
+
+  gsl_test (status, "gsl_ran_shuffle_merge n1=%u n2=%u",
+            (unsigned int) n1, (unsigned int) n2);
+
+  gsl_rng_free (r);
+}
+
+void
+test_reservoir (void)
+{
+  const size_t k = 5, n = 40;
+  double count[40];
+  int x[40], y[5], z[5];
+  gsl_ran_reservoir_t *res = gsl_ran_reservoir_alloc (k, sizeof (int));
+  gsl_ran_reservoir_t *res2 = gsl_ran_reservoir_alloc (k, sizeof (int));
+  gsl_rng *r = gsl_rng_alloc (gsl_rng_default);
+  gsl_rng *r2 = gsl_rng_alloc (gsl_rng_default);
+  size_t i, j, m;
+  int status = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      x[i] = i;
+      count[i] = 0;
+    }
+
+  /* fewer than k items */
+  gsl_ran_reservoir_add_array (r, res, x, 3);
+  m = gsl_ran_reservoir_get (y, res);
+  status |= (m != 3 || y[0] != 0 || y[1] != 1 || y[2] != 2);
+  gsl_test (status, "gsl_ran_reservoir with n < k");
+
+  for (i = 0; i < N / 10; i++)
+    {
+      gsl_ran_reservoir_reset (res);
+
+      for (j = 0; j < n; j++)
+        gsl_ran_reservoir_add (r, res, &x[j]);
+
+      gsl_ran_reservoir_get (y, res);
+
+      for (j = 0; j < k; j++)
+        count[y[j]]++;
+    }
+
+  status = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      double expected = (double) k / n * (N / 10);
+      double d = fabs (count[i] - expected);
+      status |= (d / sqrt (expected) > 5);
+    }
+
+  gsl_test (status, "gsl_ran_reservoir k=%u n=%u", (unsigned int) k,
+            (unsigned int) n);
+
+  /* adding arrays in pieces gives the same sample as single items */
+  status = 0;
+
+  for (i = 0; i < 100; i++)
+    {
+      gsl_rng_memcpy (r2, r);
+      gsl_ran_reservoir_reset (res);
+      gsl_ran_reservoir_reset (res2);
+
+      for (j = 0; j < n; j++)
+        gsl_ran_reservoir_add (r, res, &x[j]);
+
+      gsl_ran_reservoir_add_array (r2, res2, x, 3);
+      gsl_ran_reservoir_add_array (r2, res2, x + 3, 10);
+      gsl_ran_reservoir_add_array (r2, res2, x + 13, n - 13);
+
+      gsl_ran_reservoir_get (y, res);
+      gsl_ran_reservoir_get (z, res2);
+
+      for (j = 0; j < k; j++)
+        status |= (y[j] != z[j]);
+
+      status |= (gsl_rng_get (r) != gsl_rng_get (r2));
+    }
+
+  gsl_test (status, "gsl_ran_reservoir_add_array");
+
+  gsl_ran_reservoir_free (res);
+  gsl_ran_reservoir_free (res2);
+  gsl_rng_free (r);
+  gsl_rng_free (r2);
+}
+
 
 
 
@@ -737,6 +1018,21 @@ test_beta_pdf (double x)
   return gsl_ran_beta_pdf (x, 2.0, 3.0);
 }
 
+double
+test_beta_sampler (void)
+{
+  if (sbeta == NULL)
+    sbeta = gsl_ran_beta_sampler_alloc (2.0, 3.0);
+
+  return gsl_ran_beta_sampler_get (r_global, sbeta);
+}
+
+double
+test_beta_sampler_pdf (double x)
+{
+  return gsl_ran_beta_pdf (x, 2.0, 3.0);
+}
+
 double
 test_bernoulli (void)
 {
@@ -810,6 +1106,30 @@ test_binomial_large_pdf (unsigned int n)
   return gsl_ran_binomial_pdf (n, 0.3, 55);
 }
 
+double
+test_binomial_sampler (void)
+{
+  static unsigned int x[100];
+  static size_t i = 100;
+
+  if (sbinomial == NULL)
+    sbinomial = gsl_ran_binomial_sampler_alloc (0.7, 55);
+
+  if (i == 100)
+    {
+      gsl_ran_binomial_sampler_array (r_global, sbinomial, x, 100);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_binomial_sampler_pdf (unsigned int n)
+{
+  return gsl_ran_binomial_pdf (n, 0.7, 55);
+}
+
 double
 test_binomial_large_knuth (void)
 {
@@ -1158,6 +1478,98 @@ test_multinomial_moments (void)
 }
 
 
+/* check that the samplers give the same variates as the corresponding
+   scalar functions, where they are documented to do so */
+
+#define NSAMPLE 1000
+
+void
+test_samplers (void)
+{
+  const double gamma_a[] = { 0.3, 1.0, 2.5, 37.2 };
+  const double beta_ab[][2] = { { 0.5, 0.8 }, { 2.0, 3.0 }, { 0.7, 4.1 } };
+  const double binomial_p[] = { 0.0, 0.1, 0.3, 0.7, 0.95, 1.0 };
+  const unsigned int binomial_n[] = { 0, 5, 55, 1000 };
+  const double poisson_mu[] = { 0.0, 0.5, 5.0, 10.0 };
+  gsl_rng *r1 = gsl_rng_alloc (gsl_rng_default);
+  gsl_rng *r2 = gsl_rng_alloc (gsl_rng_default);
+  double x[NSAMPLE];
+  unsigned int k[NSAMPLE];
+  size_t i, j, l;
+  int status;
+
+  for (i = 0; i < sizeof (gamma_a) / sizeof (gamma_a[0]); i++)
+    {
+      gsl_ran_gamma_sampler *g = gsl_ran_gamma_sampler_alloc (gamma_a[i], 1.7);
+
+      gsl_ran_gamma_sampler_array (r1, g, x, NSAMPLE);
+
+      for (j = 0, status = 0; j < NSAMPLE; j++)
+        status |= (x[j] != gsl_ran_gamma (r2, gamma_a[i], 1.7));
+
+      gsl_test (status, "gsl_ran_gamma_sampler_array, a=%g", gamma_a[i]);
+      gsl_ran_gamma_sampler_free (g);
+    }
+
+  for (i = 0; i < sizeof (beta_ab) / sizeof (beta_ab[0]); i++)
+    {
+      const double a = beta_ab[i][0], b = beta_ab[i][1];
+      gsl_ran_beta_sampler *g = gsl_ran_beta_sampler_alloc (a, b);
+
+      gsl_ran_beta_sampler_array (r1, g, x, NSAMPLE);
+
+      for (j = 0, status = 0; j < NSAMPLE; j++)
+        status |= (x[j] != gsl_ran_beta (r2, a, b));
+
+      gsl_test (status, "gsl_ran_beta_sampler_array, a=%g b=%g", a, b);
+      gsl_ran_beta_sampler_free (g);
+    }
+
+  for (i = 0; i < sizeof (binomial_p) / sizeof (binomial_p[0]); i++)
+    {
+      for (l = 0; l < sizeof (binomial_n) / sizeof (binomial_n[0]); l++)
+        {
+          const double p = binomial_p[i];
+          const unsigned int n = binomial_n[l];
+          gsl_ran_binomial_sampler *g = gsl_ran_binomial_sampler_alloc (p, n);
+
+          gsl_ran_binomial_sampler_array (r1, g, k, NSAMPLE);
+
+          for (j = 0, status = 0; j < NSAMPLE; j++)
+            status |= (k[j] != gsl_ran_binomial (r2, p, n));
+
+          gsl_test (status, "gsl_ran_binomial_sampler_array, p=%g n=%u",
+                    p, n);
+          gsl_ran_binomial_sampler_free (g);
+        }
+    }
+
+  for (i = 0; i < sizeof (poisson_mu) / sizeof (poisson_mu[0]); i++)
+    {
+      gsl_ran_poisson_sampler *g = gsl_ran_poisson_sampler_alloc (poisson_mu[i]);
+
+      gsl_ran_poisson_sampler_array (r1, g, k, NSAMPLE);
+
+      for (j = 0, status = 0; j < NSAMPLE; j++)
+        status |= (k[j] != gsl_ran_poisson (r2, poisson_mu[i]));
+
+      gsl_test (status, "gsl_ran_poisson_sampler_array, mu=%g",
+                poisson_mu[i]);
+      gsl_ran_poisson_sampler_free (g);
+    }
+
+  gsl_ran_exponential_array (r1, 3.5, x, NSAMPLE);
+
+  for (j = 0, status = 0; j < NSAMPLE; j++)
+    status |= (x[j] != gsl_ran_exponential (r2, 3.5));
+
+  gsl_test (status, "gsl_ran_exponential_array");
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
+
+
 double
 test_discrete1 (void)
 {
@@ -1209,6 +1621,142 @@ test_discrete3_pdf (unsigned int n)
   return gsl_ran_discrete_pdf ((size_t) n, g3);
 }
 
+/* weights changed after construction, sampled in blocks whose length
+   is not a multiple of the internal block size */
+
+double
+test_discrete_dynamic (void)
+{
+  static double P[10] = { 1, 9, 3, 4, 5, 8, 6, 7, 2, 0 };
+  static size_t x[1000];
+  static size_t i = 1000;
+
+  if (gd == NULL)
+    {
+      gd = gsl_ran_discrete_dynamic_alloc (10, P);
+      gsl_ran_discrete_dynamic_update (gd, 1, 0.0);
+      gsl_ran_discrete_dynamic_update (gd, 9, 4.5);
+      gsl_ran_discrete_dynamic_update (gd, 3, 12.0);
+      gsl_ran_discrete_dynamic_update (gd, 6, 0.25);
+    }
+
+  if (i == 1000)
+    {
+      gsl_ran_discrete_dynamic_array (r_global, gd, x, 1000);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_discrete_dynamic_pdf (unsigned int n)
+{
+  return gsl_ran_discrete_dynamic_pdf ((size_t) n, gd);
+}
+
+/* check that the array functions give the same values as repeated
+   single draws */
+
+void
+test_discrete_array (void)
+{
+  const size_t K = 37, n = 1000;
+  double P[37];
+  size_t x[1000];
+  gsl_rng *r1 = gsl_rng_alloc (gsl_rng_default);
+  gsl_rng *r2 = gsl_rng_alloc (gsl_rng_default);
+  gsl_ran_discrete_t *g;
+  gsl_ran_discrete_dynamic_t *h;
+  size_t i;
+  int status = 0;
+
+  for (i = 0; i < K; i++)
+    P[i] = (i % 5 == 0) ? 0.0 : 1.0 + i % 7;
+
+  g = gsl_ran_discrete_preproc (K, P);
+  gsl_ran_discrete_array (r1, g, x, n);
+
+  for (i = 0; i < n; i++)
+    status |= (x[i] != gsl_ran_discrete (r2, g));
+
+  gsl_test (status, "gsl_ran_discrete_array");
+
+  h = gsl_ran_discrete_dynamic_alloc (K, P);
+  gsl_ran_discrete_dynamic_array (r1, h, x, n);
+
+  for (i = 0, status = 0; i < n; i++)
+    status |= (x[i] != gsl_ran_discrete_dynamic (r2, h));
+
+  gsl_test (status, "gsl_ran_discrete_dynamic_array");
+
+  gsl_ran_discrete_free (g);
+  gsl_ran_discrete_dynamic_free (h);
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
+
+/* apply many random updates, including zero weights, and compare the
+   probabilities and the draws with the current weights */
+
+void
+test_discrete_dynamic_updates (void)
+{
+  const size_t K = 100, nupdate = 1000;
+  double P[100], sum = 0;
+  size_t x[1000];
+  gsl_ran_discrete_dynamic_t *h;
+  size_t i;
+  int status = 0;
+
+  for (i = 0; i < K; i++)
+    P[i] = gsl_rng_uniform (r_global);
+
+  h = gsl_ran_discrete_dynamic_alloc (K, P);
+
+  for (i = 0; i < nupdate; i++)
+    {
+      size_t k = gsl_rng_uniform_int (r_global, K);
+      double u = gsl_rng_uniform (r_global);
+
+      /* make half of the weights zero and the others span 12 decades */
+      P[k] = (k % 2) ? 0.0 : pow (10.0, 12.0 * u - 6.0);
+      gsl_ran_discrete_dynamic_update (h, k, P[k]);
+    }
+
+  for (i = 0; i < K; i++)
+    sum += P[i];
+
+  for (i = 0; i < K; i++)
+    {
+      double p = gsl_ran_discrete_dynamic_pdf (i, h);
+      status |= (fabs (p - P[i] / sum) > 1e-12 * (P[i] / sum) + 1e-18);
+      status |= (gsl_ran_discrete_dynamic_weight (i, h) != P[i]);
+    }
+
+  gsl_test (status, "gsl_ran_discrete_dynamic_update, probabilities");
+
+  gsl_ran_discrete_dynamic_array (r_global, h, x, 1000);
+
+  for (i = 0, status = 0; i < 1000; i++)
+    status |= (x[i] >= K || P[x[i]] == 0);
+
+  gsl_test (status, "gsl_ran_discrete_dynamic_update, zero weights");
+
+  for (i = 0; i < K; i++)
+    P[i] = (i == 17) ? 3.0 : 0.0;
+
+  gsl_ran_discrete_dynamic_init (h, P);
+  gsl_ran_discrete_dynamic_array (r_global, h, x, 1000);
+
+  for (i = 0, status = 0; i < 1000; i++)
+    status |= (x[i] != 17);
+
+  gsl_test (status, "gsl_ran_discrete_dynamic_init, single event");
+
+  gsl_ran_discrete_dynamic_free (h);
+}
+
 
 double
 test_erlang (void)
@@ -1234,6 +1782,27 @@ test_exponential_pdf (double x)
   return gsl_ran_exponential_pdf (x, 2.0);
 }
 
+double
+test_exponential_array (void)
+{
+  static double x[100];
+  static size_t i = 100;
+
+  if (i == 100)
+    {
+      gsl_ran_exponential_array (r_global, 2.0, x, 100);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_exponential_array_pdf (double x)
+{
+  return gsl_ran_exponential_pdf (x, 2.0);
+}
+
 double
 test_exppow0 (void)
 {
@@ -1407,6 +1976,45 @@ test_gamma_small_pdf (double x)
   return gsl_ran_gamma_pdf (x, 0.92, 2.17);
 }
 
+double
+test_gamma_sampler (void)
+{
+  static double x[100];
+  static size_t i = 100;
+
+  if (sgamma == NULL)
+    sgamma = gsl_ran_gamma_sampler_alloc (2.5, 2.17);
+
+  if (i == 100)
+    {
+      gsl_ran_gamma_sampler_array (r_global, sgamma, x, 100);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gamma_sampler_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 2.5, 2.17);
+}
+
+double
+test_gamma_sampler_small (void)
+{
+  if (sgamma_small == NULL)
+    sgamma_small = gsl_ran_gamma_sampler_alloc (0.92, 2.17);
+
+  return gsl_ran_gamma_sampler_get (r_global, sgamma_small);
+}
+
+double
+test_gamma_sampler_small_pdf (double x)
+{
+  return gsl_ran_gamma_pdf (x, 0.92, 2.17);
+}
+
 double
 test_gamma_vlarge (void)
 {
@@ -1545,6 +2153,30 @@ test_gaussian_ziggurat_pdf (double x)
   return gsl_ran_gaussian_pdf (x, 3.12);
 }
 
+/* return the variates from an array one at a time, refilling it with
+   a length which is not a multiple of the internal block size */
+
+double
+test_gaussian_array (void)
+{
+  static double x[1000];
+  static size_t i = 1000;
+
+  if (i == 1000)
+    {
+      gsl_ran_gaussian_array (r_global, 3.12, x, 1000);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_gaussian_array_pdf (double x)
+{
+  return gsl_ran_gaussian_pdf (x, 3.12);
+}
+
 double
 test_gaussian_tail (void)
 {
@@ -1606,6 +2238,27 @@ test_ugaussian_ratio_method_pdf (double x)
   return gsl_ran_ugaussian_pdf (x);
 }
 
+double
+test_ugaussian_array (void)
+{
+  static double x[3];
+  static size_t i = 3;
+
+  if (i == 3)
+    {
+      gsl_ran_ugaussian_array (r_global, x, 3);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_ugaussian_array_pdf (double x)
+{
+  return gsl_ran_ugaussian_pdf (x);
+}
+
 double
 test_ugaussian_tail (void)
 {
@@ -1852,6 +2505,138 @@ test_multivariate_gaussian (void)
   gsl_vector_free(tmp);
 }
 
+/* Check the sample mean and variance-covariance matrix of the rows of X
+ * against mu and Sigma, allowing 5 standard errors for each element.
+ */
+static void
+test_multivariate_moments (const gsl_matrix * X, const gsl_vector * mu,
+                           const gsl_matrix * Sigma, const char * desc)
+{
+  const size_t n = X->size1, d = X->size2;
+  gsl_vector * mu_hat = gsl_vector_alloc(d);
+  gsl_matrix * Sigma_hat = gsl_matrix_alloc(d, d);
+  int status = 0;
+  size_t i, j;
+
+  gsl_ran_multivariate_gaussian_mean (X, mu_hat);
+  gsl_ran_multivariate_gaussian_vcov (X, Sigma_hat);
+
+  for (i = 0; i < d; ++i)
+    {
+      const double sii = gsl_matrix_get(Sigma, i, i);
+
+      status |= fabs(gsl_vector_get(mu_hat, i) - gsl_vector_get(mu, i))
+                > 5.0 * sqrt(sii / n);
+
+      for (j = 0; j < d; ++j)
+        {
+          const double sij = gsl_matrix_get(Sigma, i, j);
+          const double sjj = gsl_matrix_get(Sigma, j, j);
+
+          status |= fabs(gsl_matrix_get(Sigma_hat, i, j) - sij)
+                    > 5.0 * sqrt((sii * sjj + sij * sij) / n);
+        }
+    }
+
+  gsl_test(status, "test %s: sample mean and covariance", desc);
+
+  gsl_vector_free(mu_hat);
+  gsl_matrix_free(Sigma_hat);
+}
+
+void
+test_multivariate_gaussian_array (void)
+{
+  const size_t d = 4;
+  const double A[] = {  4.0,  2.0, -1.0,  0.5,
+                        2.0,  3.0,  0.5,  0.0,
+                       -1.0,  0.5,  2.0, -0.3,
+                        0.5,  0.0, -0.3,  1.0 };
+  gsl_matrix_const_view Sigma = gsl_matrix_const_view_array(A, d, d);
+  gsl_vector * mu = gsl_vector_alloc(d);
+  gsl_matrix * L = gsl_matrix_alloc(d, d);
+  gsl_matrix * X = gsl_matrix_alloc(N, d);
+  gsl_matrix * Y = gsl_matrix_alloc(N / 10, 2 * d);
+  gsl_matrix_view Ysub = gsl_matrix_submatrix(Y, 0, 1, N / 10, d);
+  size_t i;
+
+  for (i = 0; i < d; ++i)
+    gsl_vector_set(mu, i, i - 1.5);
+
+  gsl_matrix_memcpy(L, &Sigma.matrix);
+  gsl_linalg_cholesky_decomp1(L);
+
+  gsl_ran_multivariate_gaussian_array(r_global, mu, L, X);
+  test_multivariate_moments(X, mu, &Sigma.matrix,
+                            "gsl_ran_multivariate_gaussian_array");
+
+  /* non-contiguous output */
+  gsl_ran_multivariate_gaussian_array(r_global, mu, L, &Ysub.matrix);
+  test_multivariate_moments(&Ysub.matrix, mu, &Sigma.matrix,
+                            "gsl_ran_multivariate_gaussian_array submatrix");
+
+  gsl_vector_free(mu);
+  gsl_matrix_free(L);
+  gsl_matrix_free(X);
+  gsl_matrix_free(Y);
+}
+
+void
+test_multivariate_gaussian_lowrank_array (void)
+{
+  const size_t d = 5, q = 2;
+  const double Fdata[] = {  1.0,  0.5,
+                            0.8, -0.2,
+                           -0.5,  1.2,
+                            0.0,  0.7,
+                            1.5,  0.3 };
+  const double Ddata[] = { 0.5, 0.2, 1.0, 0.1, 0.3 };
+  gsl_matrix_const_view F = gsl_matrix_const_view_array(Fdata, d, q);
+  gsl_vector_const_view D = gsl_vector_const_view_array(Ddata, d);
+  gsl_vector * mu = gsl_vector_alloc(d);
+  gsl_vector * zero = gsl_vector_calloc(d);
+  gsl_matrix * Sigma = gsl_matrix_alloc(d, d);
+  gsl_matrix * X = gsl_matrix_alloc(N, d);
+  gsl_matrix * Z = gsl_matrix_alloc(N, q);
+  gsl_matrix * Y = gsl_matrix_alloc(N, d);
+  int status = 0;
+  size_t i, j;
+
+  for (i = 0; i < d; ++i)
+    gsl_vector_set(mu, i, 2.0 - i);
+
+  /* Sigma = F F^T + diag(D) */
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, &F.matrix, &F.matrix, 0.0, Sigma);
+  for (i = 0; i < d; ++i)
+    *gsl_matrix_ptr(Sigma, i, i) += Ddata[i];
+
+  gsl_ran_multivariate_gaussian_lowrank_array(r_global, mu, &F.matrix, &D.vector, X, Z);
+  test_multivariate_moments(X, mu, Sigma,
+                            "gsl_ran_multivariate_gaussian_lowrank_array");
+
+  /* with D = 0 the samples are mu + Z F^T for the returned factors Z */
+  gsl_ran_multivariate_gaussian_lowrank_array(r_global, mu, &F.matrix, zero, X, Z);
+  gsl_blas_dgemm(CblasNoTrans, CblasTrans, 1.0, Z, &F.matrix, 0.0, Y);
+
+  for (i = 0; i < N; ++i)
+    {
+      for (j = 0; j < d; ++j)
+        {
+          const double y = gsl_matrix_get(Y, i, j) + gsl_vector_get(mu, j);
+          status |= fabs(gsl_matrix_get(X, i, j) - y) > 1.0e-12 * (1.0 + fabs(y));
+        }
+    }
+
+  gsl_test(status, "test gsl_ran_multivariate_gaussian_lowrank_array: factors");
+
+  gsl_vector_free(mu);
+  gsl_vector_free(zero);
+  gsl_matrix_free(Sigma);
+  gsl_matrix_free(X);
+  gsl_matrix_free(Z);
+  gsl_matrix_free(Y);
+}
+
 
 double
 test_geometric (void)
@@ -2285,6 +3070,60 @@ test_poisson_large_pdf (unsigned int n)
   return gsl_ran_poisson_pdf (n, 30.0);
 }
 
+double
+test_poisson_sampler (void)
+{
+  if (spoisson == NULL)
+    spoisson = gsl_ran_poisson_sampler_alloc (5.0);
+
+  return gsl_ran_poisson_sampler_get (r_global, spoisson);
+}
+
+double
+test_poisson_sampler_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 5.0);
+}
+
+double
+test_poisson_sampler_large (void)
+{
+  static unsigned int x[100];
+  static size_t i = 100;
+
+  if (spoisson_large == NULL)
+    spoisson_large = gsl_ran_poisson_sampler_alloc (10.5);
+
+  if (i == 100)
+    {
+      gsl_ran_poisson_sampler_array (r_global, spoisson_large, x, 100);
+      i = 0;
+    }
+
+  return x[i++];
+}
+
+double
+test_poisson_sampler_large_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 10.5);
+}
+
+double
+test_poisson_sampler_vlarge (void)
+{
+  if (spoisson_vlarge == NULL)
+    spoisson_vlarge = gsl_ran_poisson_sampler_alloc (62.3);
+
+  return gsl_ran_poisson_sampler_get (r_global, spoisson_vlarge);
+}
+
+double
+test_poisson_sampler_vlarge_pdf (unsigned int n)
+{
+  return gsl_ran_poisson_pdf (n, 62.3);
+}
+
 
 double
 test_tdist1 (void)
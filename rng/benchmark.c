@@ -1,140 +1,810 @@
 /* rng/benchmark.c
- * 
+ *
  * Copyright (C) 1996, 1997, 1998, 1999, 2000, 2007 James Theiler, Brian Gough
- * 
+ * Copyright (C) 2026 The GSL Team
+ *
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
  * the Free Software Foundation; either version 3 of the License, or (at
  * your option) any later version.
- * 
+ *
  * This program is distributed in the hope that it will be useful, but
  * WITHOUT ANY WARRANTY; without even the implied warranty of
  * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
  * General Public License for more details.
- * 
+ *
  * You should have received a copy of the GNU General Public License
  * along with this program; if not, write to the Free Software
  * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
  */
 
+/* Speed and quality benchmark of the random number generators.
+
+   Usage: benchmark [--csv | --json] [--min-time SECONDS]
+                    [--threads N] [--quality] [NAME ...]
+
+   For each generator (by default every type in gsl_rng_types_setup)
+   the time per number is measured for gsl_rng_get, gsl_rng_uniform,
+   gsl_rng_get_array and gsl_rng_uniform_array.
+
+   With --threads N and a build with OpenMP (for example "make
+   benchmark CFLAGS='-O2 -fopenmp'"), gsl_rng_uniform_array is also
+   timed with 1, 2, 4, ... N threads, each with its own generator from
+   gsl_rng_split (or a differently seeded generator for types without
+   jump-ahead), and the aggregate time per number and the speedup are
+   reported.
+
+   With --quality a battery of statistical tests is run on the output
+   of gsl_rng_uniform instead, in the spirit of the SmallCrush battery
+   of P. L'Ecuyer and R. Simard, "TestU01: A C library for empirical
+   testing of random number generators", ACM Trans. Math. Softw. 33,
+   22 (2007).  The tests are
+
+     frequency    2^22 values in 4096 equal bins
+     serial       2^20 non-overlapping pairs in a 64 x 64 grid
+     gap          2^18 gaps between visits to [0,1/16)
+     maxoft       2^17 maxima of 8 values, transformed to uniform
+     birthday     birthday spacings of 2^11 points in a 2^30 cell
+                  cube (10 bits from each of 3 values), 100 times
+     rank         ranks of 2^14 random 32 x 32 binary matrices, each
+                  row made from the leading 16 bits of 2 values
+
+   Each test reports a p-value.  As in TestU01, values outside
+   [0.001, 0.999] are marked "suspect" and values outside
+   [1e-10, 1 - 1e-10] are marked "FAIL".  The tests take a few seconds
+   per generator and are sensitive enough to reject the classic
+   linear congruential generators (randu, vax, slatec, ...).
+
+   The output is a table, or CSV or JSON for tracking regressions.
+
+   The program is not built by default; use "make benchmark" in this
+   directory. */
+
 #include <config.h>
-#include <time.h>
+#include <stdlib.h>
 #include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include <gsl/gsl_math.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_errno.h>
 
-void benchmark (const gsl_rng_type * T);
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 
-#define N  1000000
-int isum;
-double dsum;
+enum { OUTPUT_TABLE, OUTPUT_CSV, OUTPUT_JSON };
 
-int
-main (void)
-{
-
-  benchmark(gsl_rng_borosh13);
-  benchmark(gsl_rng_cmrg);
-  benchmark(gsl_rng_coveyou);
-  benchmark(gsl_rng_fishman18);
-  benchmark(gsl_rng_fishman20);
-  benchmark(gsl_rng_fishman2x);
-  benchmark(gsl_rng_gfsr4);
-  benchmark(gsl_rng_knuthran);
-  benchmark(gsl_rng_knuthran2);
-  benchmark(gsl_rng_lecuyer21);
-  benchmark(gsl_rng_minstd);
-  benchmark(gsl_rng_mrg);
-  benchmark(gsl_rng_mt19937);
-  benchmark(gsl_rng_r250);
-  benchmark(gsl_rng_ran0);
-  benchmark(gsl_rng_ran1);
-  benchmark(gsl_rng_ran2);
-  benchmark(gsl_rng_ran3);
-  benchmark(gsl_rng_rand);
-  benchmark(gsl_rng_rand48);
-  benchmark(gsl_rng_random128_bsd);
-  benchmark(gsl_rng_random128_glibc2);
-  benchmark(gsl_rng_random128_libc5);
-  benchmark(gsl_rng_random256_bsd);
-  benchmark(gsl_rng_random256_glibc2);
-  benchmark(gsl_rng_random256_libc5);
-  benchmark(gsl_rng_random32_bsd);
-  benchmark(gsl_rng_random32_glibc2);
-  benchmark(gsl_rng_random32_libc5);
-  benchmark(gsl_rng_random64_bsd);
-  benchmark(gsl_rng_random64_glibc2);
-  benchmark(gsl_rng_random64_libc5);
-  benchmark(gsl_rng_random8_bsd);
-  benchmark(gsl_rng_random8_glibc2);
-  benchmark(gsl_rng_random8_libc5);
-  benchmark(gsl_rng_random_bsd);
-  benchmark(gsl_rng_random_glibc2);
-  benchmark(gsl_rng_random_libc5);
-  benchmark(gsl_rng_randu);
-  benchmark(gsl_rng_ranf);
-  benchmark(gsl_rng_ranlux);
-  benchmark(gsl_rng_ranlux389);
-  benchmark(gsl_rng_ranlxd1);
-  benchmark(gsl_rng_ranlxd2);
-  benchmark(gsl_rng_ranlxs0);
-  benchmark(gsl_rng_ranlxs1);
-  benchmark(gsl_rng_ranlxs2);
-  benchmark(gsl_rng_ranmar);
-  benchmark(gsl_rng_slatec);
-  benchmark(gsl_rng_taus);
-  benchmark(gsl_rng_taus113);
-  benchmark(gsl_rng_transputer);
-  benchmark(gsl_rng_tt800);
-  benchmark(gsl_rng_uni);
-  benchmark(gsl_rng_uni32);
-  benchmark(gsl_rng_vax);
-  benchmark(gsl_rng_waterman14);
-  benchmark(gsl_rng_zuf);
+#define BLOCK 4096
 
-  return 0;
+static volatile unsigned long int isink;
+static volatile double dsink;
+
+/* wall clock time in seconds */
+static double
+bench_clock (void)
+{
+#ifdef _OPENMP
+  return omp_get_wtime ();
+#else
+  return clock () / (double) CLOCKS_PER_SEC;
+#endif
 }
 
-void
-benchmark (const gsl_rng_type * T)
+/* Speed benchmarks.  Each function generates n numbers. */
+
+static void
+run_get (gsl_rng * r, size_t n)
 {
-  int start, end;
-  int i = 0, d = 0 ;
-  double t1, t2;
+  unsigned long int sum = 0;
+  size_t i;
 
-  gsl_rng *r = gsl_rng_alloc (T);
+  for (i = 0; i < n; i++)
+    sum += gsl_rng_get (r);
 
-  start = clock ();
-  do
+  isink += sum;
+}
+
+static void
+run_uniform (gsl_rng * r, size_t n)
+{
+  double sum = 0.0;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    sum += gsl_rng_uniform (r);
+
+  dsink += sum;
+}
+
+static void
+run_get_array (gsl_rng * r, size_t n)
+{
+  unsigned long int x[BLOCK];
+  size_t i;
+
+  for (i = 0; i < n; i += BLOCK)
     {
-      int j;
-      for (j = 0; j < N; j++)
-        isum += gsl_rng_get (r);
+      gsl_rng_get_array (r, x, BLOCK);
+      isink += x[0];
+    }
+}
+
+static void
+run_uniform_array (gsl_rng * r, size_t n)
+{
+  double x[BLOCK];
+  size_t i;
 
-      i += N;
-      end = clock ();
+  for (i = 0; i < n; i += BLOCK)
+    {
+      gsl_rng_uniform_array (r, x, BLOCK);
+      dsink += x[0];
     }
-  while (end < start + CLOCKS_PER_SEC/10);
+}
+
+typedef struct
+{
+  const char *name;
+  void (*run) (gsl_rng * r, size_t n);
+} bench_method;
+
+static const bench_method bench_methods[] = {
+  {"get", run_get},
+  {"uniform", run_uniform},
+  {"get_array", run_get_array},
+  {"uniform_array", run_uniform_array},
+  {0, 0}
+};
+
+/* return the time per number in nanoseconds, repeating batches of
+   numbers until at least min_time seconds have elapsed */
+static double
+bench_time (const bench_method * m, gsl_rng * r, double min_time)
+{
+  const size_t batch = 64 * BLOCK;
+  double start, elapsed;
+  size_t n = 0;
+
+  m->run (r, batch);            /* warm up */
 
-  t1 = (end - start) / (double) CLOCKS_PER_SEC;
+  start = bench_clock ();
 
-  start = clock ();
   do
     {
-      int j;
-      for (j = 0; j < N; j++)
-        dsum += gsl_rng_uniform (r);
+      m->run (r, batch);
+      n += batch;
+      elapsed = bench_clock () - start;
+    }
+  while (elapsed < min_time);
+
+  return 1.0e9 * elapsed / (double) n;
+}
+
+/* aggregate time per number for nthreads threads, each generating
+   numbers from its own stream, or a negative value on failure */
+static double
+bench_threads (const gsl_rng_type * T, int nthreads, double min_time)
+{
+#ifdef _OPENMP
+  const size_t batch = 64 * BLOCK;
+  gsl_rng **r = malloc (nthreads * sizeof (gsl_rng *));
+  double start = 0.0, elapsed = 0.0;
+  size_t total = 0;
+  int done = 0, t;
+
+  r[0] = gsl_rng_alloc (T);
+
+  for (t = 1; t < nthreads; t++)
+    {
+      r[t] = gsl_rng_split (r[t - 1]);
 
-      d += N;
-      end = clock ();
+      if (r[t] == 0)
+        {
+          r[t] = gsl_rng_alloc (T);
+          gsl_rng_set (r[t], gsl_rng_default_seed + t + 1);
+        }
     }
-  while (end < start + CLOCKS_PER_SEC/10);
 
-  t2 = (end - start) / (double) CLOCKS_PER_SEC;
+#pragma omp parallel num_threads(nthreads) reduction(+:total)
+  {
+    const int id = omp_get_thread_num ();
+
+    run_uniform_array (r[id], batch);
+
+#pragma omp barrier
+#pragma omp master
+    start = bench_clock ();
+#pragma omp barrier
+
+    do
+      {
+        run_uniform_array (r[id], batch);
+        total += batch;
 
+        /* all threads read the same value of done before it changes */
+#pragma omp barrier
+#pragma omp master
+        {
+          elapsed = bench_clock () - start;
+          done = (elapsed >= min_time);
+        }
+#pragma omp barrier
+      }
+    while (!done);
+  }
+
+  for (t = 0; t < nthreads; t++)
+    gsl_rng_free (r[t]);
+
+  free (r);
+
+  return 1.0e9 * elapsed / (double) total;
+#else
+  (void) T;
+  (void) nthreads;
+  (void) min_time;
+  return -1.0;
+#endif
+}
 
-  printf ("%6.0f k ints/sec, %6.0f k doubles/sec, %s\n",
-          i / t1 / 1000.0, d / t2 / 1000.0, gsl_rng_name (r));
+/* Upper tail probabilities for the statistical tests. */
 
-  gsl_rng_free (r);
+static double
+normal_q (double z)
+{
+  return 0.5 * erfc (z / M_SQRT2);
+}
+
+/* Q(chi^2 >= x) for nu degrees of freedom, summing the terms of the
+   series for the incomplete gamma function with integer or half
+   integer parameter */
+static double
+chisq_q (double x, unsigned int nu)
+{
+  const double h = 0.5 * x;
+  double q, a;
+
+  if (x <= 0.0)
+    return 1.0;
+
+  if (nu % 2 == 0)
+    {
+      q = 0.0;
+      a = 0.0;
+    }
+  else
+    {
+      q = erfc (sqrt (h));
+      a = 0.5;
+    }
+
+  for (; a < 0.5 * nu - 0.25; a += 1.0)
+    q += exp (a * log (h) - h - lgamma (a + 1.0));
+
+  return (q > 1.0) ? 1.0 : q;
+}
+
+/* chi-square statistic for observed counts against probabilities */
+static double
+chisq_stat (const double *count, const double *prob, size_t k, double n)
+{
+  double chi2 = 0.0;
+  size_t i;
+
+  for (i = 0; i < k; i++)
+    {
+      const double e = n * prob[i];
+      chi2 += (count[i] - e) * (count[i] - e) / e;
+    }
+
+  return chi2;
+}
+
+typedef struct
+{
+  double stat;
+  double p;
+} test_result;
+
+/* chi-square test of equal counts in k bins */
+static test_result
+chisq_equal (const double *count, size_t k, double n)
+{
+  test_result res;
+  double chi2 = 0.0;
+  const double e = n / k;
+  size_t i;
+
+  for (i = 0; i < k; i++)
+    chi2 += (count[i] - e) * (count[i] - e) / e;
+
+  res.stat = chi2;
+  res.p = chisq_q (chi2, (unsigned int) (k - 1));
+
+  return res;
+}
+
+static test_result
+test_frequency (gsl_rng * r)
+{
+  const size_t k = 4096, n = 1UL << 22;
+  double *count = calloc (k, sizeof (double));
+  test_result res;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    count[(size_t) (gsl_rng_uniform (r) * k)]++;
+
+  res = chisq_equal (count, k, (double) n);
+  free (count);
+
+  return res;
+}
+
+static test_result
+test_serial (gsl_rng * r)
+{
+  const size_t d = 64, n = 1UL << 20;
+  double *count = calloc (d * d, sizeof (double));
+  test_result res;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      const size_t a = (size_t) (gsl_rng_uniform (r) * d);
+      const size_t b = (size_t) (gsl_rng_uniform (r) * d);
+      count[a * d + b]++;
+    }
+
+  res = chisq_equal (count, d * d, (double) n);
+  free (count);
+
+  return res;
+}
+
+static test_result
+test_gap (gsl_rng * r)
+{
+  const size_t t = 32, n = 1UL << 18;
+  const double beta = 1.0 / 16.0;
+  double count[33], prob[33];
+  test_result res;
+  size_t i, gap = 0;
+
+  for (i = 0; i <= t; i++)
+    {
+      count[i] = 0;
+      prob[i] = (i < t) ? beta * pow (1.0 - beta, (double) i)
+                        : pow (1.0 - beta, (double) t);
+    }
+
+  i = 0;
+
+  while (i < n)
+    {
+      if (gsl_rng_uniform (r) < beta)
+        {
+          count[(gap < t) ? gap : t]++;
+          gap = 0;
+          i++;
+        }
+      else
+        {
+          gap++;
+        }
+    }
+
+  res.stat = chisq_stat (count, prob, t + 1, (double) n);
+  res.p = chisq_q (res.stat, (unsigned int) t);
+
+  return res;
+}
+
+static test_result
+test_maxoft (gsl_rng * r)
+{
+  const size_t k = 256, t = 8, n = 1UL << 17;
+  double count[256];
+  size_t i, j;
+
+  for (i = 0; i < k; i++)
+    count[i] = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      double m = 0.0;
+
+      for (j = 0; j < t; j++)
+        {
+          const double u = gsl_rng_uniform (r);
+          if (u > m)
+            m = u;
+        }
+
+      /* m^t is uniform on [0,1) */
+      count[(size_t) (pow (m, (double) t) * k)]++;
+    }
+
+  return chisq_equal (count, k, (double) n);
+}
+
+static int
+compare_ulong (const void *a, const void *b)
+{
+  const unsigned long int x = *(const unsigned long int *) a;
+  const unsigned long int y = *(const unsigned long int *) b;
+
+  return (x > y) - (x < y);
+}
+
+static test_result
+test_birthday (gsl_rng * r)
+{
+  const size_t n = 1UL << 11, reps = 100;
+  const double lambda = (double) n * n * n / (4.0 * 1073741824.0);
+  unsigned long int *x = malloc (n * sizeof (unsigned long int));
+  test_result res;
+  size_t rep, i, y = 0;
+
+  for (rep = 0; rep < reps; rep++)
+    {
+      for (i = 0; i < n; i++)
+        {
+          unsigned long int c = 0;
+          int j;
+
+          for (j = 0; j < 3; j++)
+            c = (c << 10) | (unsigned long int) (gsl_rng_uniform (r) * 1024.0);
+
+          x[i] = c;
+        }
+
+      qsort (x, n, sizeof (unsigned long int), compare_ulong);
+
+      /* spacings between the sorted points */
+      for (i = n - 1; i > 0; i--)
+        x[i] -= x[i - 1];
+
+      qsort (x, n, sizeof (unsigned long int), compare_ulong);
+
+      for (i = 1; i < n; i++)
+        y += (x[i] == x[i - 1]);
+    }
+
+  free (x);
+
+  /* y is approximately Poisson with mean reps * lambda */
+  res.stat = (double) y;
+  res.p = normal_q ((y - 0.5 - reps * lambda) / sqrt (reps * lambda));
+
+  return res;
+}
+
+/* rank over GF(2) of a 32 x 32 matrix stored as rows of bits */
+static int
+binary_rank (unsigned long int *row)
+{
+  int rank = 0, col, i;
+
+  for (col = 31; col >= 0 && rank < 32; col--)
+    {
+      const unsigned long int bit = 1UL << col;
+
+      for (i = rank; i < 32; i++)
+        {
+          if (row[i] & bit)
+            break;
+        }
+
+      if (i == 32)
+        continue;
+
+      {
+        unsigned long int tmp = row[i];
+        row[i] = row[rank];
+        row[rank] = tmp;
+      }
+
+      for (i = rank + 1; i < 32; i++)
+        {
+          if (row[i] & bit)
+            row[i] ^= row[rank];
+        }
+
+      rank++;
+    }
+
+  return rank;
+}
+
+static test_result
+test_rank (gsl_rng * r)
+{
+  /* limiting probabilities of rank 32, 31, 30 and <= 29 */
+  static const double prob[4] = { 0.288788, 0.577576, 0.128350, 0.005286 };
+  const size_t n = 1UL << 14;
+  double count[4] = { 0, 0, 0, 0 };
+  unsigned long int row[32];
+  test_result res;
+  size_t i;
+  int j;
+
+  for (i = 0; i < n; i++)
+    {
+      int rank;
+
+      /* use only the leading 16 bits of each value, so that
+         generators with fewer than 32 bits are not rejected */
+      for (j = 0; j < 32; j++)
+        {
+          const unsigned long int hi = (unsigned long int) (gsl_rng_uniform (r) * 65536.0);
+          const unsigned long int lo = (unsigned long int) (gsl_rng_uniform (r) * 65536.0);
+
+          row[j] = (hi << 16) | lo;
+        }
+
+      rank = binary_rank (row);
+      count[(rank >= 29) ? 32 - rank : 3]++;
+    }
+
+  res.stat = chisq_stat (count, prob, 4, (double) n);
+  res.p = chisq_q (res.stat, 3);
+
+  return res;
+}
+
+typedef struct
+{
+  const char *name;
+  test_result (*run) (gsl_rng * r);
+} quality_test;
+
+static const quality_test quality_tests[] = {
+  {"frequency", test_frequency},
+  {"serial", test_serial},
+  {"gap", test_gap},
+  {"maxoft", test_maxoft},
+  {"birthday", test_birthday},
+  {"rank", test_rank},
+  {0, 0}
+};
+
+static const char *
+quality_flag (double p)
+{
+  if (p < 1.0e-10 || p > 1.0 - 1.0e-10)
+    return "FAIL";
+  else if (p < 1.0e-3 || p > 1.0 - 1.0e-3)
+    return "suspect";
+  else
+    return "pass";
+}
+
+/* Output */
+
+static void
+print_header (int format, int quality)
+{
+  if (format == OUTPUT_CSV)
+    {
+      if (quality)
+        printf ("generator,test,statistic,p_value,result\n");
+      else
+        printf ("generator,method,threads,ns_per_number,speedup\n");
+    }
+  else if (format == OUTPUT_JSON)
+    {
+      printf ("[\n");
+    }
+  else
+    {
+      if (quality)
+        printf ("%-20s %-10s %14s %12s %s\n", "generator", "test",
+                "statistic", "p-value", "result");
+      else
+        printf ("%-20s %-14s %7s %13s %8s\n", "generator", "method",
+                "threads", "ns/number", "speedup");
+    }
+}
+
+static void
+print_speed (int format, int first, const char *generator,
+             const char *method, int threads, double ns, double speedup)
+{
+  if (format == OUTPUT_CSV)
+    {
+      printf ("%s,%s,%d,%.4f,%.3f\n", generator, method, threads, ns,
+              speedup);
+    }
+  else if (format == OUTPUT_JSON)
+    {
+      printf ("%s  {\"generator\": \"%s\", \"method\": \"%s\", "
+              "\"threads\": %d, \"ns_per_number\": %.4f, "
+              "\"speedup\": %.3f}",
+              first ? "" : ",\n", generator, method, threads, ns, speedup);
+    }
+  else
+    {
+      printf ("%-20s %-14s %7d %13.3f %8.2f\n", generator, method,
+              threads, ns, speedup);
+    }
+
+  fflush (stdout);
+}
+
+static void
+print_quality (int format, int first, const char *generator,
+               const char *test, test_result res)
+{
+  if (format == OUTPUT_CSV)
+    {
+      printf ("%s,%s,%.6g,%.6e,%s\n", generator, test, res.stat, res.p,
+              quality_flag (res.p));
+    }
+  else if (format == OUTPUT_JSON)
+    {
+      printf ("%s  {\"generator\": \"%s\", \"test\": \"%s\", "
+              "\"statistic\": %.6g, \"p_value\": %.6e, \"result\": \"%s\"}",
+              first ? "" : ",\n", generator, test, res.stat, res.p,
+              quality_flag (res.p));
+    }
+  else
+    {
+      printf ("%-20s %-10s %14.6g %12.4e %s\n", generator, test, res.stat,
+              res.p, quality_flag (res.p));
+    }
+
+  fflush (stdout);
+}
+
+static void
+usage (void)
+{
+  fprintf (stderr, "usage: benchmark [--csv | --json] [--min-time SECONDS] "
+           "[--threads N] [--quality] [NAME ...]\n");
+  exit (EXIT_FAILURE);
+}
+
+static const gsl_rng_type *
+find_type (const char *name)
+{
+  const gsl_rng_type **t;
+
+  for (t = gsl_rng_types_setup (); *t != 0; t++)
+    {
+      if (strcmp ((*t)->name, name) == 0)
+        return *t;
+    }
+
+  fprintf (stderr, "unknown generator %s\n", name);
+  exit (EXIT_FAILURE);
+}
+
+int
+main (int argc, char *argv[])
+{
+  const gsl_rng_type **all = gsl_rng_types_setup ();
+  const gsl_rng_type **types = malloc ((argc + 1) * sizeof (gsl_rng_type *));
+  int format = OUTPUT_TABLE, quality = 0, max_threads = 1;
+  double min_time = 0.1;
+  int ntypes = 0, first = 1, a, i;
+
+  for (a = 1; a < argc; a++)
+    {
+      if (strcmp (argv[a], "--csv") == 0)
+        {
+          format = OUTPUT_CSV;
+        }
+      else if (strcmp (argv[a], "--json") == 0)
+        {
+          format = OUTPUT_JSON;
+        }
+      else if (strcmp (argv[a], "--min-time") == 0 && a + 1 < argc)
+        {
+          min_time = strtod (argv[++a], NULL);
+        }
+      else if (strcmp (argv[a], "--threads") == 0 && a + 1 < argc)
+        {
+          max_threads = atoi (argv[++a]);
+
+          if (max_threads < 1)
+            usage ();
+        }
+      else if (strcmp (argv[a], "--quality") == 0)
+        {
+          quality = 1;
+        }
+      else if (argv[a][0] == '-')
+        {
+          usage ();
+        }
+      else
+        {
+          types[ntypes++] = find_type (argv[a]);
+        }
+    }
+
+#ifndef _OPENMP
+  if (max_threads > 1)
+    {
+      fprintf (stderr, "benchmark: built without OpenMP, "
+               "ignoring --threads\n");
+      max_threads = 1;
+    }
+#endif
+
+  if (ntypes == 0)
+    {
+      free (types);
+      types = all;
+
+      while (types[ntypes] != 0)
+        ntypes++;
+    }
+
+  /* gsl_rng_split reports generators without jump-ahead */
+  gsl_set_error_handler_off ();
+
+  print_header (format, quality);
+
+  for (i = 0; i < ntypes; i++)
+    {
+      gsl_rng *r = gsl_rng_alloc (types[i]);
+
+      if (quality)
+        {
+          const quality_test *q;
+
+          for (q = quality_tests; q->name != 0; q++)
+            {
+              gsl_rng_set (r, gsl_rng_default_seed);
+              print_quality (format, first, gsl_rng_name (r), q->name,
+                             q->run (r));
+              first = 0;
+            }
+        }
+      else
+        {
+          const bench_method *m;
+          double ns1 = 0.0;
+          int nt;
+
+          for (m = bench_methods; m->name != 0; m++)
+            {
+              const double ns = bench_time (m, r, min_time);
+
+              print_speed (format, first, gsl_rng_name (r), m->name, 1,
+                           ns, 1.0);
+              first = 0;
+
+              if (m->run == run_uniform_array)
+                ns1 = ns;
+            }
+
+          /* 2, 4, 8, ... threads, ending with max_threads */
+          for (nt = 2; nt <= max_threads; nt *= 2)
+            {
+              const int n = (2 * nt > max_threads) ? max_threads : nt;
+              const double ns = bench_threads (types[i], n, min_time);
+
+              print_speed (format, first, gsl_rng_name (r), "uniform_array",
+                           n, ns, ns1 / ns);
+
+              if (n == max_threads)
+                break;
+            }
+        }
+
+      gsl_rng_free (r);
+    }
+
+  if (format == OUTPUT_JSON)
+    printf ("\n]\n");
+
+  if (types != all)
+    free (types);
+
+  return 0;
 }
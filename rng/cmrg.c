@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "schrage.c"
 
 /* This is a combined multiple recursive generator. The sequence is,
 
@@ -69,11 +70,15 @@
    This is available on the net from L'Ecuyer's home page,
 
    http://www.iro.umontreal.ca/~lecuyer/myftp/papers/combmrg.ps
-   ftp://ftp.iro.umontreal.ca/pub/simulation/lecuyer/papers/combmrg.ps */
+   ftp://ftp.iro.umontreal.ca/pub/simulation/lecuyer/papers/combmrg.ps
+
+   The jump function advances both components by 2^127 steps, using
+   the 127th squares of their transition matrices. */
 
 static inline unsigned long int cmrg_get (void *vstate);
 static double cmrg_get_double (void *vstate);
 static void cmrg_set (void *state, unsigned long int s);
+static int cmrg_jump (void *vstate);
 
 static const long int m1 = 2147483647, m2 = 2145483479;
 
@@ -185,6 +190,72 @@ cmrg_set (void *vstate, unsigned long int s)
   cmrg_get (state);
 }
 
+/* transition matrices of the two components raised to the power
+   2^127, acting on the state vectors (x1, x2, x3) and (y1, y2, y3) */
+
+static const unsigned long int cmrg_jump_a[3][3] = {
+  {83541387UL, 1399925808UL, 1376926929UL},
+  {718659068UL, 83541387UL, 1120194206UL},
+  {45725407UL, 718659068UL, 107431187UL}
+};
+
+static const unsigned long int cmrg_jump_b[3][3] = {
+  {1962229272UL, 497957599UL, 381991093UL},
+  {2122592917UL, 1094519147UL, 497957599UL},
+  {735341107UL, 1795944242UL, 1094519147UL}
+};
+
+static void
+cmrg_jump_component (const unsigned long int a[3][3], long int *x,
+                     unsigned long int m, unsigned long int sqrtm)
+{
+  unsigned long int v[3];
+  int i, j;
+
+  for (i = 0; i < 3; i++)
+    {
+      v[i] = 0;
+
+      for (j = 0; j < 3; j++)
+        {
+          v[i] += schrage_mult (a[i][j], x[j], m, sqrtm);
+          if (v[i] >= m)
+            v[i] -= m;
+        }
+    }
+
+  for (i = 0; i < 3; i++)
+    x[i] = v[i];
+}
+
+static int
+cmrg_jump (void *vstate)
+{
+  cmrg_state_t *state = (cmrg_state_t *) vstate;
+  long int x[3], y[3];
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+
+  y[0] = state->y1;
+  y[1] = state->y2;
+  y[2] = state->y3;
+
+  cmrg_jump_component (cmrg_jump_a, x, m1, 46341UL);
+  cmrg_jump_component (cmrg_jump_b, y, m2, 46320UL);
+
+  state->x1 = x[0];
+  state->x2 = x[1];
+  state->x3 = x[2];
+
+  state->y1 = y[0];
+  state->y2 = y[1];
+  state->y3 = y[2];
+
+  return GSL_SUCCESS;
+}
+
 static const gsl_rng_type cmrg_type =
 {"cmrg",                        /* name */
  2147483646,                    /* RAND_MAX */
@@ -192,6 +263,9 @@ static const gsl_rng_type cmrg_type =
  sizeof (cmrg_state_t),
  &cmrg_set,
  &cmrg_get,
- &cmrg_get_double};
+ &cmrg_get_double,
+ 0,
+ 0,
+ &cmrg_jump};
 
 const gsl_rng_type *gsl_rng_cmrg = &cmrg_type;
@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdlib.h>
 #include <gsl/gsl_rng.h>
+#include "schrage.c"
 
 /* This is a fifth-order multiple recursive generator. The sequence is,
 
@@ -48,11 +49,15 @@
 
    From: P. L'Ecuyer, F. Blouin, and R. Coutre, "A search for good
    multiple recursive random number generators", ACM Transactions on
-   Modeling and Computer Simulation 3, 87-98 (1993). */
+   Modeling and Computer Simulation 3, 87-98 (1993).
+
+   The jump function advances the generator by 2^127 steps, using the
+   127th square of its transition matrix. */
 
 static inline unsigned long int mrg_get (void *vstate);
 static double mrg_get_double (void *vstate);
 static void mrg_set (void *state, unsigned long int s);
+static int mrg_jump (void *vstate);
 
 static const long int m = 2147483647;
 static const long int a1 = 107374182, q1 = 20, r1 = 7;
@@ -137,6 +142,51 @@ mrg_set (void *vstate, unsigned long int s)
   return;
 }
 
+/* transition matrix raised to the power 2^127, acting on the state
+   vector (x1, ..., x5) */
+
+static const unsigned long int mrg_jump_a[5][5] = {
+  {1544850582UL, 1393264000UL, 619205839UL, 330899533UL, 245959373UL},
+  {1969508772UL, 945688464UL, 1393264000UL, 619205839UL, 330899533UL},
+  {867814299UL, 233134312UL, 945688464UL, 1393264000UL, 619205839UL},
+  {788930743UL, 821817512UL, 233134312UL, 945688464UL, 1393264000UL},
+  {1881116928UL, 588328209UL, 821817512UL, 233134312UL, 945688464UL}
+};
+
+static int
+mrg_jump (void *vstate)
+{
+  mrg_state_t *state = (mrg_state_t *) vstate;
+  unsigned long int x[5], v[5];
+  int i, j;
+
+  x[0] = state->x1;
+  x[1] = state->x2;
+  x[2] = state->x3;
+  x[3] = state->x4;
+  x[4] = state->x5;
+
+  for (i = 0; i < 5; i++)
+    {
+      v[i] = 0;
+
+      for (j = 0; j < 5; j++)
+        {
+          v[i] += schrage_mult (mrg_jump_a[i][j], x[j], m, 46341UL);
+          if (v[i] >= (unsigned long int) m)
+            v[i] -= m;
+        }
+    }
+
+  state->x1 = v[0];
+  state->x2 = v[1];
+  state->x3 = v[2];
+  state->x4 = v[3];
+  state->x5 = v[4];
+
+  return GSL_SUCCESS;
+}
+
 static const gsl_rng_type mrg_type =
 {"mrg",                         /* name */
  2147483646,                    /* RAND_MAX */
@@ -144,6 +194,9 @@ static const gsl_rng_type mrg_type =
  sizeof (mrg_state_t),
  &mrg_set,
  &mrg_get,
- &mrg_get_double};
+ &mrg_get_double,
+ 0,
+ 0,
+ &mrg_jump};
 
 const gsl_rng_type *gsl_rng_mrg = &mrg_type;
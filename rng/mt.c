@@ -58,6 +58,9 @@
 static inline unsigned long int mt_get (void *vstate);
 static double mt_get_double (void *vstate);
 static void mt_set (void *state, unsigned long int s);
+static void mt_fill (void *vstate, unsigned long int *x, size_t n);
+static void mt_fill_double (void *vstate, double *x, size_t n);
+static int mt_jump (void *vstate);
 
 #define N 624   /* Period parameters */
 #define M 397
@@ -75,47 +78,58 @@ typedef struct
   }
 mt_state_t;
 
-static inline unsigned long
-mt_get (void *vstate)
-{
-  mt_state_t *state = (mt_state_t *) vstate;
+#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
 
-  unsigned long k ;
-  unsigned long int *const mt = state->mt;
+/* generate N words at one time */
 
-#define MAGIC(y) (((y)&0x1) ? 0x9908b0dfUL : 0)
+static inline void
+mt_generate (mt_state_t * state)
+{
+  unsigned long int *const mt = state->mt;
+  int kk;
 
-  if (state->mti >= N)
-    {   /* generate N words at one time */
-      int kk;
-
-      for (kk = 0; kk < N - M; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
-        }
-      for (; kk < N - 1; kk++)
-        {
-          unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
-          mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
-        }
-
-      {
-        unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
-        mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
-      }
-
-      state->mti = 0;
+  for (kk = 0; kk < N - M; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + M] ^ (y >> 1) ^ MAGIC(y);
     }
+  for (; kk < N - 1; kk++)
+    {
+      unsigned long y = (mt[kk] & UPPER_MASK) | (mt[kk + 1] & LOWER_MASK);
+      mt[kk] = mt[kk + (M - N)] ^ (y >> 1) ^ MAGIC(y);
+    }
+
+  {
+    unsigned long y = (mt[N - 1] & UPPER_MASK) | (mt[0] & LOWER_MASK);
+    mt[N - 1] = mt[M - 1] ^ (y >> 1) ^ MAGIC(y);
+  }
+
+  state->mti = 0;
+}
 
-  /* Tempering */
-  
-  k = mt[state->mti];
+static inline unsigned long
+mt_temper (unsigned long k)
+{
   k ^= (k >> 11);
   k ^= (k << 7) & 0x9d2c5680UL;
   k ^= (k << 15) & 0xefc60000UL;
   k ^= (k >> 18);
 
+  return k;
+}
+
+static inline unsigned long
+mt_get (void *vstate)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+
+  unsigned long k ;
+
+  if (state->mti >= N)
+    mt_generate (state);
+
+  k = mt_temper (state->mt[state->mti]);
+
   state->mti++;
 
   return k;
@@ -127,6 +141,65 @@ mt_get_double (void * vstate)
   return mt_get (vstate) / 4294967296.0 ;
 }
 
+/* The bulk routines regenerate the state a block at a time and temper
+   contiguous runs of it, which the compiler can vectorize. */
+
+static void
+mt_fill (void *vstate, unsigned long int *x, size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+
+  while (n > 0)
+    {
+      const unsigned long int *mt;
+      size_t i, m;
+
+      if (state->mti >= N)
+        mt_generate (state);
+
+      mt = state->mt + state->mti;
+      m = N - state->mti;
+      if (m > n)
+        m = n;
+
+      for (i = 0; i < m; i++)
+        x[i] = mt_temper (mt[i]);
+
+      state->mti += m;
+      x += m;
+      n -= m;
+    }
+}
+
+static void
+mt_fill_double (void *vstate, double *x, size_t n)
+{
+  mt_state_t *state = (mt_state_t *) vstate;
+
+  while (n > 0)
+    {
+      const unsigned long int *mt;
+      size_t i, m;
+
+      if (state->mti >= N)
+        mt_generate (state);
+
+      mt = state->mt + state->mti;
+      m = N - state->mti;
+      if (m > n)
+        m = n;
+
+      for (i = 0; i < m; i++)
+        x[i] = mt_temper (mt[i]) / 4294967296.0;
+
+      state->mti += m;
+      x += m;
+      n -= m;
+    }
+}
+
+#include "mt_jump.c"
+
 static void
 mt_set (void *vstate, unsigned long int s)
 {
@@ -211,7 +284,10 @@ static const gsl_rng_type mt_type =
  sizeof (mt_state_t),
  &mt_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_fill,
+ &mt_fill_double,
+ &mt_jump};
 
 static const gsl_rng_type mt_1999_type =
 {"mt19937_1999",                /* name */
@@ -220,7 +296,10 @@ static const gsl_rng_type mt_1999_type =
  sizeof (mt_state_t),
  &mt_1999_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_fill,
+ &mt_fill_double,
+ &mt_jump};
 
 static const gsl_rng_type mt_1998_type =
 {"mt19937_1998",                /* name */
@@ -229,7 +308,10 @@ static const gsl_rng_type mt_1998_type =
  sizeof (mt_state_t),
  &mt_1998_set,
  &mt_get,
- &mt_get_double};
+ &mt_get_double,
+ &mt_fill,
+ &mt_fill_double,
+ &mt_jump};
 
 const gsl_rng_type *gsl_rng_mt19937 = &mt_type;
 const gsl_rng_type *gsl_rng_mt19937_1999 = &mt_1999_type;
@@ -0,0 +1,171 @@
+/* rng/pcg.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the PCG64 generator (pcg64, or PCG XSL RR 128/64) of
+   O'Neill.  The state is a 128-bit linear congruential generator,
+
+   s_{n+1} = (a s_n + c) mod 2^128
+
+   with a = 47026247687942121848144207491837523525 and the default
+   increment c = 117397592171526113268558934119004209487 of the
+   reference implementation.  Each 64-bit output is obtained from the
+   new state by xoring its two halves and rotating right by the top 6
+   bits of the state.  The period is 2^128.
+
+   The seed s is used as the initial state in the same way as
+   pcg64_srandom_r (s_0 = c + s, advanced by one step).  The jump
+   function advances the state by 2^64 steps, which for a fixed
+   increment is a single multiply-add with precomputed constants.
+
+   Reference: M. E. O'Neill, "PCG: A Family of Simple Fast
+   Space-Efficient Statistically Good Algorithms for Random Number
+   Generation", Harvey Mudd College technical report HMC-CS-2014-0905
+   (2014). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include "u64.c"
+
+static inline unsigned long int pcg_get (void *vstate);
+static double pcg_get_double (void *vstate);
+static void pcg_set (void *state, unsigned long int s);
+static void pcg_fill (void *vstate, unsigned long int *x, size_t n);
+static void pcg_fill_double (void *vstate, double *x, size_t n);
+static int pcg_jump (void *vstate);
+
+typedef struct
+{
+  u64_t hi, lo;
+}
+pcg_state_t;
+
+/* s = (a s + c) mod 2^128 */
+
+static inline void
+pcg_muladd (pcg_state_t * state, const u64_t a_hi, const u64_t a_lo,
+            const u64_t c_hi, const u64_t c_lo)
+{
+  u64_t lo = u64_mul (state->lo, a_lo);
+  u64_t hi = u64_add (u64_mulhi (state->lo, a_lo),
+                      u64_add (u64_mul (state->hi, a_lo),
+                               u64_mul (state->lo, a_hi)));
+  const u64_t sum = u64_add (lo, c_lo);
+
+  hi = u64_add (hi, c_hi);
+
+  if (u64_lt (sum, lo))
+    hi = u64_add (hi, u64_make (0, 1));
+
+  state->hi = hi;
+  state->lo = sum;
+}
+
+static inline u64_t
+pcg_next (pcg_state_t * state)
+{
+  pcg_muladd (state,
+              u64_make (0x2360ed05UL, 0x1fc65da4UL),
+              u64_make (0x4385df64UL, 0x9fccf645UL),
+              u64_make (0x5851f42dUL, 0x4c957f2dUL),
+              u64_make (0x14057b7eUL, 0xf767814fUL));
+
+  return u64_rotr (u64_xor (state->hi, state->lo),
+                   (int) (u64_hi (state->hi) >> 26));
+}
+
+static inline unsigned long int
+pcg_get (void *vstate)
+{
+  return u64_get (pcg_next ((pcg_state_t *) vstate));
+}
+
+static double
+pcg_get_double (void *vstate)
+{
+  return u64_to_double (pcg_next ((pcg_state_t *) vstate));
+}
+
+static void
+pcg_fill (void *vstate, unsigned long int *x, size_t n)
+{
+  pcg_state_t *state = (pcg_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = u64_get (pcg_next (state));
+}
+
+static void
+pcg_fill_double (void *vstate, double *x, size_t n)
+{
+  pcg_state_t *state = (pcg_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = u64_to_double (pcg_next (state));
+}
+
+static void
+pcg_set (void *vstate, unsigned long int s)
+{
+  pcg_state_t *state = (pcg_state_t *) vstate;
+  const u64_t seed = u64_make ((s >> 16 >> 16) & 0xffffffffUL,
+                               s & 0xffffffffUL);
+
+  state->hi = u64_make (0, 0);
+  state->lo = u64_make (0, 0);
+  pcg_next (state);
+
+  state->lo = u64_add (state->lo, seed);
+  if (u64_lt (state->lo, seed))
+    state->hi = u64_add (state->hi, u64_make (0, 1));
+
+  pcg_next (state);
+}
+
+static int
+pcg_jump (void *vstate)
+{
+  pcg_state_t *state = (pcg_state_t *) vstate;
+
+  /* a^(2^64) and c (a^(2^64) - 1) / (a - 1) modulo 2^128 */
+
+  pcg_muladd (state,
+              u64_make (0x5f0ba18cUL, 0x53cd8fbcUL),
+              u64_make (0x00000000UL, 0x00000001UL),
+              u64_make (0x3c5eabcaUL, 0x8bcf2d31UL),
+              u64_make (0x00000000UL, 0x00000000UL));
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type pcg_type =
+{"pcg64",                       /* name */
+ ULONG_MAX,                     /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (pcg_state_t),
+ &pcg_set,
+ &pcg_get,
+ &pcg_get_double,
+ &pcg_fill,
+ &pcg_fill_double,
+ &pcg_jump};
+
+const gsl_rng_type *gsl_rng_pcg64 = &pcg_type;
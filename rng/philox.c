@@ -0,0 +1,194 @@
+/* rng/philox.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the Philox4x32-10 counter-based generator.  Each block of
+   four 32-bit outputs is a keyed bijection of a 128-bit counter
+   (c0, c1, c2, c3),
+
+   (x0, x1, x2, x3) = f_k(c0, c1, c2, c3)
+
+   where f consists of 10 rounds of
+
+   (x0, x1, x2, x3) <- (hi(M1 x2) ^ x1 ^ k0, lo(M1 x2),
+                        hi(M0 x0) ^ x3 ^ k1, lo(M0 x0))
+
+   with multipliers M0 = 0xD2511F53, M1 = 0xCD9E8D57, and hi/lo the
+   upper and lower 32 bits of the 64-bit product.  The 64-bit key
+   (k0, k1) is incremented by the Weyl constants (0x9E3779B9,
+   0xBB67AE85) between rounds.
+
+   The seed sets the key (the low and high 32 bits of the seed) and
+   the counter starts at zero.  The sequence is produced by
+   incrementing (c0, c1) as a 64-bit integer, so each key provides
+   2^64 blocks before (c2, c3) is changed.  The jump function
+   increments (c2, c3), which advances the sequence by 2^66 outputs.
+
+   Reference: J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw,
+   "Parallel random numbers: as easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing,
+   Networking, Storage and Analysis (SC11), 2011. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_rng.h>
+
+#define MASK 0xffffffffUL
+
+static const unsigned long int PHILOX_M0 = 0xD2511F53UL;
+static const unsigned long int PHILOX_M1 = 0xCD9E8D57UL;
+static const unsigned long int PHILOX_W0 = 0x9E3779B9UL;
+static const unsigned long int PHILOX_W1 = 0xBB67AE85UL;
+
+static inline unsigned long int philox_get (void *vstate);
+static double philox_get_double (void *vstate);
+static void philox_set (void *state, unsigned long int s);
+static int philox_jump (void *vstate);
+
+typedef struct
+{
+  unsigned long int ctr[4];
+  unsigned long int key[2];
+  unsigned long int out[4];
+  int idx;
+}
+philox_state_t;
+
+/* compute the upper and lower 32 bits of the product of two 32-bit
+   values */
+
+static inline void
+philox_mulhilo (unsigned long int a, unsigned long int b,
+                unsigned long int *hi, unsigned long int *lo)
+{
+#if ULONG_MAX > 0xffffffffUL
+  unsigned long int p = a * b;
+
+  *hi = p >> 32;
+  *lo = p & MASK;
+#else
+  unsigned long int a0 = a & 0xffffUL, a1 = a >> 16;
+  unsigned long int b0 = b & 0xffffUL, b1 = b >> 16;
+  unsigned long int p00 = a0 * b0, p01 = a0 * b1;
+  unsigned long int p10 = a1 * b0, p11 = a1 * b1;
+  unsigned long int mid = (p00 >> 16) + (p01 & 0xffffUL) + (p10 & 0xffffUL);
+
+  *hi = p11 + (p01 >> 16) + (p10 >> 16) + (mid >> 16);
+  *lo = (p00 & 0xffffUL) | ((mid & 0xffffUL) << 16);
+#endif
+}
+
+static void
+philox_block (philox_state_t * state)
+{
+  unsigned long int x0 = state->ctr[0], x1 = state->ctr[1];
+  unsigned long int x2 = state->ctr[2], x3 = state->ctr[3];
+  unsigned long int k0 = state->key[0], k1 = state->key[1];
+  int r;
+
+  for (r = 0; r < 10; r++)
+    {
+      unsigned long int hi0, lo0, hi1, lo1;
+
+      philox_mulhilo (PHILOX_M0, x0, &hi0, &lo0);
+      philox_mulhilo (PHILOX_M1, x2, &hi1, &lo1);
+
+      x0 = hi1 ^ x1 ^ k0;
+      x1 = lo1;
+      x2 = hi0 ^ x3 ^ k1;
+      x3 = lo0;
+
+      k0 = (k0 + PHILOX_W0) & MASK;
+      k1 = (k1 + PHILOX_W1) & MASK;
+    }
+
+  state->out[0] = x0;
+  state->out[1] = x1;
+  state->out[2] = x2;
+  state->out[3] = x3;
+}
+
+static inline unsigned long int
+philox_get (void *vstate)
+{
+  philox_state_t *state = (philox_state_t *) vstate;
+
+  if (state->idx == 4)
+    {
+      state->ctr[0] = (state->ctr[0] + 1) & MASK;
+      if (state->ctr[0] == 0)
+        state->ctr[1] = (state->ctr[1] + 1) & MASK;
+
+      philox_block (state);
+      state->idx = 0;
+    }
+
+  return state->out[state->idx++];
+}
+
+static double
+philox_get_double (void *vstate)
+{
+  return philox_get (vstate) / 4294967296.0;
+}
+
+static void
+philox_set (void *vstate, unsigned long int s)
+{
+  philox_state_t *state = (philox_state_t *) vstate;
+
+  state->key[0] = s & MASK;
+  state->key[1] = (s >> 16 >> 16) & MASK;
+
+  state->ctr[0] = 0;
+  state->ctr[1] = 0;
+  state->ctr[2] = 0;
+  state->ctr[3] = 0;
+
+  philox_block (state);
+  state->idx = 0;
+}
+
+static int
+philox_jump (void *vstate)
+{
+  philox_state_t *state = (philox_state_t *) vstate;
+
+  state->ctr[2] = (state->ctr[2] + 1) & MASK;
+  if (state->ctr[2] == 0)
+    state->ctr[3] = (state->ctr[3] + 1) & MASK;
+
+  philox_block (state);
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type philox_type =
+{"philox4x32",                  /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (philox_state_t),
+ &philox_set,
+ &philox_get,
+ &philox_get_double,
+ 0,
+ 0,
+ &philox_jump};
+
+const gsl_rng_type *gsl_rng_philox4x32 = &philox_type;
@@ -130,6 +130,95 @@ gsl_rng_state (const gsl_rng * r)
   return r->state;
 }
 
+/* Fill an array with n values, equivalent to n calls of gsl_rng_get
+   or gsl_rng_uniform.  Generators which provide bulk routines avoid
+   the indirect call per value. */
+
+void
+gsl_rng_get_array (const gsl_rng * r, unsigned long int * x, size_t n)
+{
+  if (r->type->fill)
+    {
+      (r->type->fill) (r->state, x, n);
+    }
+  else
+    {
+      unsigned long int (*get) (void *) = r->type->get;
+      void *state = r->state;
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        x[i] = get (state);
+    }
+}
+
+void
+gsl_rng_uniform_array (const gsl_rng * r, double * x, size_t n)
+{
+  if (r->type->fill_double)
+    {
+      (r->type->fill_double) (r->state, x, n);
+    }
+  else
+    {
+      double (*get_double) (void *) = r->type->get_double;
+      void *state = r->state;
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        x[i] = get_double (state);
+    }
+}
+
+/* Advance the generator by the fixed jump distance of its type, which
+   is large enough that the streams between successive jumps do not
+   overlap in practice. */
+
+int
+gsl_rng_jump (gsl_rng * r)
+{
+  if (r->type->jump == 0)
+    {
+      GSL_ERROR ("generator does not support jump ahead", GSL_EUNIMPL);
+    }
+
+  return (r->type->jump) (r->state);
+}
+
+/* Return a new generator which continues the current stream of r, and
+   jump r ahead to the start of the next stream.  Repeated calls give
+   a reproducible sequence of non-overlapping streams, e.g. one per
+   thread. */
+
+gsl_rng *
+gsl_rng_split (gsl_rng * r)
+{
+  gsl_rng *child;
+  int status;
+
+  if (r->type->jump == 0)
+    {
+      GSL_ERROR_NULL ("generator does not support jump ahead", GSL_EUNIMPL);
+    }
+
+  child = gsl_rng_clone (r);
+
+  if (child == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for rng", GSL_ENOMEM);
+    }
+
+  status = (r->type->jump) (r->state);
+
+  if (status)
+    {
+      gsl_rng_free (child);
+      GSL_ERROR_NULL ("failed to jump generator", status);
+    }
+
+  return child;
+}
+
 void
 gsl_rng_print_state (const gsl_rng * r)
 {
@@ -0,0 +1,280 @@
+/* rng/sfmt.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the SIMD-oriented Fast Mersenne Twister SFMT19937 of Saito
+   and Matsumoto.  The state consists of N = 156 128-bit words w_i,
+   each stored as four 32-bit words with the least significant first,
+   and the recursion is
+
+   w_{i+N} = w_i ^ (w_i <<< 8) ^ ((w_{i+POS1} >> 11) & MSK)
+             ^ (w_{i+N-2} >>> 8) ^ (w_{i+N-1} << 18)
+
+   where <<< and >>> are shifts of the whole 128-bit word, << and >>
+   are shifts of each 32-bit word, POS1 = 122 and MSK = (0xdfffffef,
+   0xddfecb7f, 0xbffaffff, 0xbffffff6).  The period is a multiple of
+   2^19937 - 1.  All of the operations act on four 32-bit lanes, so
+   that a block of 624 words is generated with vector instructions by
+   a compiler which supports them.
+
+   Consecutive pairs of 32-bit words are combined into 64-bit outputs
+   as in the gen_rand64 function of the reference implementation.
+   The generator is seeded with init_gen_rand, using the lower 32 bits
+   of the seed, followed by the period certification of the reference
+   implementation.
+
+   Reference: M. Saito and M. Matsumoto, "SIMD-oriented Fast Mersenne
+   Twister: a 128-bit Pseudorandom Number Generator", Monte Carlo and
+   Quasi-Monte Carlo Methods 2006, Springer (2008), 607--622. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <gsl/gsl_rng.h>
+#include "u64.c"
+
+#define SFMT_N 156              /* number of 128-bit words */
+#define SFMT_N32 624            /* number of 32-bit words */
+#define SFMT_POS1 122
+#define SFMT_SL1 18
+#define SFMT_SR1 11
+
+/* use 32-bit words where available, so that the recursion maps
+   directly onto 4 x 32-bit vector registers */
+
+#if UINT_MAX == 0xffffffffUL
+typedef unsigned int sfmt_word_t;
+#define MASK32(x) (x)
+#else
+typedef unsigned long int sfmt_word_t;
+#define MASK32(x) ((x) & 0xffffffffUL)
+#endif
+
+static const sfmt_word_t sfmt_msk[4] =
+  { 0xdfffffefUL, 0xddfecb7fUL, 0xbffaffffUL, 0xbffffff6UL };
+
+static const unsigned long int sfmt_parity[4] =
+  { 0x00000001UL, 0x00000000UL, 0x00000000UL, 0x13c9e684UL };
+
+static inline unsigned long int sfmt_get (void *vstate);
+static double sfmt_get_double (void *vstate);
+static void sfmt_set (void *state, unsigned long int s);
+static void sfmt_fill (void *vstate, unsigned long int *x, size_t n);
+static void sfmt_fill_double (void *vstate, double *x, size_t n);
+
+typedef struct
+{
+  sfmt_word_t w[SFMT_N32];
+  int idx;
+}
+sfmt_state_t;
+
+/* compute one 128-bit word of the recursion, r may be the same as a.
+   All inputs are loaded before any output is stored, so that the
+   compiler can treat the four lanes as a single vector operation. */
+
+static inline void
+sfmt_recursion (sfmt_word_t * r, const sfmt_word_t * a,
+                const sfmt_word_t * b, const sfmt_word_t * c,
+                const sfmt_word_t * d)
+{
+  sfmt_word_t x[4], y[4], t[4];
+  int k;
+
+  for (k = 0; k < 4; k++)
+    {
+      x[k] = a[k];
+      y[k] = (b[k] >> SFMT_SR1) & sfmt_msk[k];
+      t[k] = (c[k] >> 8) ^ (d[k] << SFMT_SL1);
+    }
+
+  t[0] ^= c[1] << 24;
+  t[1] ^= c[2] << 24;
+  t[2] ^= c[3] << 24;
+
+  r[0] = MASK32 (x[0] ^ (x[0] << 8) ^ y[0] ^ t[0]);
+  r[1] = MASK32 (x[1] ^ (x[1] << 8) ^ (x[0] >> 24) ^ y[1] ^ t[1]);
+  r[2] = MASK32 (x[2] ^ (x[2] << 8) ^ (x[1] >> 24) ^ y[2] ^ t[2]);
+  r[3] = MASK32 (x[3] ^ (x[3] << 8) ^ (x[2] >> 24) ^ y[3] ^ t[3]);
+}
+
+/* generate SFMT_N32 words at one time */
+
+static void
+sfmt_generate (sfmt_state_t * state)
+{
+  sfmt_word_t *const w = state->w;
+  const sfmt_word_t *r1 = w + 4 * (SFMT_N - 2);
+  const sfmt_word_t *r2 = w + 4 * (SFMT_N - 1);
+  int i;
+
+  for (i = 0; i < SFMT_N - SFMT_POS1; i++)
+    {
+      sfmt_recursion (w + 4 * i, w + 4 * i, w + 4 * (i + SFMT_POS1), r1, r2);
+      r1 = r2;
+      r2 = w + 4 * i;
+    }
+
+  for (; i < SFMT_N; i++)
+    {
+      sfmt_recursion (w + 4 * i, w + 4 * i, w + 4 * (i + SFMT_POS1 - SFMT_N),
+                      r1, r2);
+      r1 = r2;
+      r2 = w + 4 * i;
+    }
+
+  state->idx = 0;
+}
+
+static inline u64_t
+sfmt_next (sfmt_state_t * state)
+{
+  u64_t k;
+
+  if (state->idx >= SFMT_N32)
+    sfmt_generate (state);
+
+  k = u64_make (state->w[state->idx + 1], state->w[state->idx]);
+  state->idx += 2;
+
+  return k;
+}
+
+static inline unsigned long int
+sfmt_get (void *vstate)
+{
+  return u64_get (sfmt_next ((sfmt_state_t *) vstate));
+}
+
+static double
+sfmt_get_double (void *vstate)
+{
+  return u64_to_double (sfmt_next ((sfmt_state_t *) vstate));
+}
+
+/* The bulk routines convert contiguous runs of the state array after
+   each block is generated. */
+
+static void
+sfmt_fill (void *vstate, unsigned long int *x, size_t n)
+{
+  sfmt_state_t *state = (sfmt_state_t *) vstate;
+
+  while (n > 0)
+    {
+      const sfmt_word_t *w;
+      size_t i, m;
+
+      if (state->idx >= SFMT_N32)
+        sfmt_generate (state);
+
+      w = state->w + state->idx;
+      m = (SFMT_N32 - state->idx) / 2;
+      if (m > n)
+        m = n;
+
+      for (i = 0; i < m; i++)
+        x[i] = u64_get (u64_make (w[2 * i + 1], w[2 * i]));
+
+      state->idx += 2 * m;
+      x += m;
+      n -= m;
+    }
+}
+
+static void
+sfmt_fill_double (void *vstate, double *x, size_t n)
+{
+  sfmt_state_t *state = (sfmt_state_t *) vstate;
+
+  while (n > 0)
+    {
+      const sfmt_word_t *w;
+      size_t i, m;
+
+      if (state->idx >= SFMT_N32)
+        sfmt_generate (state);
+
+      w = state->w + state->idx;
+      m = (SFMT_N32 - state->idx) / 2;
+      if (m > n)
+        m = n;
+
+      for (i = 0; i < m; i++)
+        x[i] = u64_to_double (u64_make (w[2 * i + 1], w[2 * i]));
+
+      state->idx += 2 * m;
+      x += m;
+      n -= m;
+    }
+}
+
+static void
+sfmt_set (void *vstate, unsigned long int s)
+{
+  sfmt_state_t *state = (sfmt_state_t *) vstate;
+  sfmt_word_t *const w = state->w;
+  unsigned long int inner = 0;
+  int i, j;
+
+  w[0] = MASK32 (s);
+
+  for (i = 1; i < SFMT_N32; i++)
+    w[i] = MASK32 (1812433253UL * (w[i - 1] ^ (w[i - 1] >> 30)) + i);
+
+  state->idx = SFMT_N32;
+
+  /* period certification: the state must not lie in the subspace
+     orthogonal to the parity vector, otherwise flip one bit */
+
+  for (i = 0; i < 4; i++)
+    inner ^= w[i] & sfmt_parity[i];
+
+  for (i = 16; i > 0; i >>= 1)
+    inner ^= inner >> i;
+
+  if ((inner & 1) == 0)
+    {
+      for (i = 0; i < 4; i++)
+        {
+          for (j = 0; j < 32; j++)
+            {
+              const unsigned long int bit = 1UL << j;
+
+              if (bit & sfmt_parity[i])
+                {
+                  w[i] ^= bit;
+                  return;
+                }
+            }
+        }
+    }
+}
+
+static const gsl_rng_type sfmt_type =
+{"sfmt19937",                   /* name */
+ ULONG_MAX,                     /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (sfmt_state_t),
+ &sfmt_set,
+ &sfmt_get,
+ &sfmt_get_double,
+ &sfmt_fill,
+ &sfmt_fill_double};
+
+const gsl_rng_type *gsl_rng_sfmt19937 = &sfmt_type;
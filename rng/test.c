@@ -21,6 +21,7 @@
 #include <stdlib.h>
 #include <stdio.h>
 #include <math.h>
+#include <limits.h>
 #include <gsl/gsl_rng.h>
 #include <gsl/gsl_test.h>
 #include <gsl/gsl_ieee_utils.h>
@@ -31,6 +32,10 @@ void rng_float_test (const gsl_rng_type * T);
 void generic_rng_test (const gsl_rng_type * T);
 void rng_state_test (const gsl_rng_type * T);
 void rng_parallel_state_test (const gsl_rng_type * T);
+void rng_array_test (const gsl_rng_type * T);
+void rng_jump_test (const gsl_rng_type * T, unsigned long int seed,
+                    unsigned long int result);
+void rng_split_test (const gsl_rng_type * T);
 void rng_read_write_test (const gsl_rng_type * T);
 int rng_max_test (gsl_rng * r, unsigned long int *kmax, unsigned long int ran_max) ;
 int rng_min_test (gsl_rng * r, unsigned long int *kmin, unsigned long int ran_min, unsigned long int ran_max) ;
@@ -181,6 +186,49 @@ main (void)
   rng_test (gsl_rng_ranf, 0, 10000, 2152890433UL);
   rng_test (gsl_rng_ranf, 2, 10000, 339327233);
 
+  /* Known answers for a zero key and counter from the Random123
+     library */
+
+  rng_test (gsl_rng_philox4x32, 0, 1, 0x6627e8d5UL);
+  rng_test (gsl_rng_philox4x32, 0, 4, 0x9b00dbd8UL);
+  rng_test (gsl_rng_threefry4x32, 0, 1, 0x9c6ca96aUL);
+  rng_test (gsl_rng_threefry4x32, 0, 4, 0x5256a7d8UL);
+
+  /* Generators with 64-bit output return the upper 32 bits when
+     unsigned long is 32 bits.  The values were computed with
+     independent implementations, and for sfmt19937 agree with the
+     32-bit outputs of the reference implementation for seed 1234. */
+
+#if ULONG_MAX > 0xffffffffUL
+  rng_test (gsl_rng_xoshiro256ss, 1, 1000, 13281533337853546835UL);
+  rng_test (gsl_rng_pcg64, 1, 1000, 234483844705118544UL);
+  rng_test (gsl_rng_sfmt19937, 1234, 1, 6721611276080709682UL);
+  rng_test (gsl_rng_sfmt19937, 1234, 1000, 3759890378494670015UL);
+#else
+  rng_test (gsl_rng_xoshiro256ss, 1, 1000, 3092347955UL);
+  rng_test (gsl_rng_pcg64, 1, 1000, 54595024UL);
+  rng_test (gsl_rng_sfmt19937, 1234, 1, 1564997079UL);
+  rng_test (gsl_rng_sfmt19937, 1234, 1000, 875417696UL);
+#endif
+
+  /* First value after one jump.  The values for mt19937, cmrg and mrg
+     were computed independently from the characteristic polynomial
+     and transition matrices of the recurrences. */
+
+  rng_jump_test (gsl_rng_mt19937, 0, 3370777927UL);
+  rng_jump_test (gsl_rng_mt19937, 1, 3531178415UL);
+  rng_jump_test (gsl_rng_cmrg, 1, 562848953UL);
+  rng_jump_test (gsl_rng_mrg, 1, 1819446320UL);
+  rng_jump_test (gsl_rng_philox4x32, 0, 2219120097UL);
+  rng_jump_test (gsl_rng_threefry4x32, 0, 1173979062UL);
+#if ULONG_MAX > 0xffffffffUL
+  rng_jump_test (gsl_rng_xoshiro256ss, 0, 3990776330815198764UL);
+  rng_jump_test (gsl_rng_pcg64, 0, 2939204958348551485UL);
+#else
+  rng_jump_test (gsl_rng_xoshiro256ss, 0, 929175021UL);
+  rng_jump_test (gsl_rng_pcg64, 0, 684336982UL);
+#endif
+
   /* Test constant relationship between int and double functions */
 
   for (r = rngs ; *r != 0; r++)
@@ -197,6 +245,17 @@ main (void)
   for (r = rngs ; *r != 0; r++)
     rng_read_write_test (*r);
 
+  /* Test bulk generation against single values */
+
+  for (r = rngs ; *r != 0; r++)
+    rng_array_test (*r);
+
+  /* Test stream splitting for generators which can jump ahead */
+
+  for (r = rngs ; *r != 0; r++)
+    if ((*r)->jump)
+      rng_split_test (*r);
+
   /* generic statistical tests (these are just to make sure that we
      don't get any crazy results back from the generator, i.e. they
      aren't a test of the algorithm, just the implementation) */
@@ -247,7 +306,7 @@ rng_test (const gsl_rng_type * T, unsigned long int seed, unsigned int n,
     }
 
   status = (k != result);
-  gsl_test (status, "%s, %u steps (%u observed vs %u expected)",
+  gsl_test (status, "%s, %u steps (%lu observed vs %lu expected)",
             gsl_rng_name (r), n, k, result);
 
   gsl_rng_free (r);
@@ -382,6 +441,99 @@ rng_parallel_state_test (const gsl_rng_type * T)
 
 }
 
+void
+rng_array_test (const gsl_rng_type * T)
+{
+  /* block lengths chosen to cross the internal buffer boundaries of
+     generators such as mt19937 (624 words) */
+  const size_t lengths[] = { 1, 5, 623, 624, 625, 1500, 0 };
+  unsigned long int test_a[N], test_b[N];
+  double test_c[N], test_d[N];
+  int status = 0;
+  size_t k, i;
+
+  gsl_rng *r1 = gsl_rng_alloc (T);
+  gsl_rng *r2 = gsl_rng_alloc (T);
+
+  for (k = 0; lengths[k] != 0; k++)
+    {
+      const size_t n = lengths[k];
+
+      gsl_rng_get_array (r1, test_a, n);
+
+      for (i = 0; i < n; ++i)
+        test_b[i] = gsl_rng_get (r2);
+
+      gsl_rng_uniform_array (r1, test_c, n);
+
+      for (i = 0; i < n; ++i)
+        test_d[i] = gsl_rng_uniform (r2);
+
+      for (i = 0; i < n; ++i)
+        {
+          status |= (test_a[i] != test_b[i]);
+          status |= (test_c[i] != test_d[i]);
+        }
+    }
+
+  gsl_test (status, "%s, bulk generation matches single values",
+            gsl_rng_name (r1));
+
+  gsl_rng_free (r1);
+  gsl_rng_free (r2);
+}
+
+void
+rng_jump_test (const gsl_rng_type * T, unsigned long int seed,
+               unsigned long int result)
+{
+  gsl_rng *r = gsl_rng_alloc (T);
+  unsigned long int k;
+
+  gsl_rng_set (r, seed);
+  gsl_rng_jump (r);
+  k = gsl_rng_get (r);
+
+  gsl_test (k != result,
+            "%s, jump ahead from seed %lu (%lu observed vs %lu expected)",
+            gsl_rng_name (r), seed, k, result);
+
+  gsl_rng_free (r);
+}
+
+void
+rng_split_test (const gsl_rng_type * T)
+{
+  int status = 0;
+  size_t i;
+
+  gsl_rng *r = gsl_rng_alloc (T);
+  gsl_rng *expected_child, *expected_parent, *child;
+
+  for (i = 0; i < 10; ++i)
+    gsl_rng_get (r);
+
+  expected_child = gsl_rng_clone (r);
+  expected_parent = gsl_rng_clone (r);
+  gsl_rng_jump (expected_parent);
+
+  child = gsl_rng_split (r);
+
+  for (i = 0; i < 1000; ++i)
+    {
+      status |= (gsl_rng_get (child) != gsl_rng_get (expected_child));
+      status |= (gsl_rng_get (r) != gsl_rng_get (expected_parent));
+    }
+
+  gsl_test (status, "%s, split streams match clone and jump",
+            gsl_rng_name (r));
+
+  gsl_rng_free (r);
+  gsl_rng_free (child);
+  gsl_rng_free (expected_child);
+  gsl_rng_free (expected_parent);
+}
+
 void
 rng_read_write_test (const gsl_rng_type * T)
 {
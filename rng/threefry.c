@@ -0,0 +1,186 @@
+/* rng/threefry.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the Threefry4x32-20 counter-based generator, a simplified
+   form of the Threefish block cipher.  Each block of four 32-bit
+   outputs is obtained from a 128-bit counter (c0, c1, c2, c3) by 20
+   rounds of additions, rotations and exclusive-ors, with the key
+   schedule
+
+   ks_i = k_i (i = 0..3),  ks_4 = 0x1BD11BDA ^ k0 ^ k1 ^ k2 ^ k3
+
+   injected after every 4 rounds.  The rotation constants are those of
+   the Random123 library.
+
+   The seed sets the key (k0, k1) to the low and high 32 bits of the
+   seed, with k2 = k3 = 0, and the counter starts at zero.  As for
+   philox4x32 the sequence increments (c0, c1) and the jump function
+   increments (c2, c3), advancing the sequence by 2^66 outputs.
+
+   Reference: J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw,
+   "Parallel random numbers: as easy as 1, 2, 3", Proceedings of the
+   International Conference for High Performance Computing,
+   Networking, Storage and Analysis (SC11), 2011. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+
+#define MASK 0xffffffffUL
+#define ROTL(x,n) ((((x) << (n)) | ((x) >> (32 - (n)))) & MASK)
+
+static const unsigned long int THREEFRY_PARITY = 0x1BD11BDAUL;
+
+static const int threefry_rot[8][2] = {
+  {10, 26}, {11, 21}, {13, 27}, {23, 5},
+  {6, 20}, {17, 11}, {25, 10}, {18, 20}
+};
+
+static inline unsigned long int threefry_get (void *vstate);
+static double threefry_get_double (void *vstate);
+static void threefry_set (void *state, unsigned long int s);
+static int threefry_jump (void *vstate);
+
+typedef struct
+{
+  unsigned long int ctr[4];
+  unsigned long int key[2];
+  unsigned long int out[4];
+  int idx;
+}
+threefry_state_t;
+
+static void
+threefry_block (threefry_state_t * state)
+{
+  unsigned long int ks[5];
+  unsigned long int x[4];
+  int r, i;
+
+  ks[0] = state->key[0];
+  ks[1] = state->key[1];
+  ks[2] = 0;
+  ks[3] = 0;
+  ks[4] = THREEFRY_PARITY ^ ks[0] ^ ks[1] ^ ks[2] ^ ks[3];
+
+  for (i = 0; i < 4; i++)
+    x[i] = (state->ctr[i] + ks[i]) & MASK;
+
+  for (r = 0; r < 20; r++)
+    {
+      const int *R = threefry_rot[r % 8];
+
+      if (r % 2 == 0)
+        {
+          x[0] = (x[0] + x[1]) & MASK;
+          x[1] = ROTL (x[1], R[0]) ^ x[0];
+          x[2] = (x[2] + x[3]) & MASK;
+          x[3] = ROTL (x[3], R[1]) ^ x[2];
+        }
+      else
+        {
+          x[0] = (x[0] + x[3]) & MASK;
+          x[3] = ROTL (x[3], R[0]) ^ x[0];
+          x[2] = (x[2] + x[1]) & MASK;
+          x[1] = ROTL (x[1], R[1]) ^ x[2];
+        }
+
+      if (r % 4 == 3)
+        {
+          const int s = r / 4 + 1;
+
+          for (i = 0; i < 4; i++)
+            x[i] = (x[i] + ks[(s + i) % 5]) & MASK;
+
+          x[3] = (x[3] + s) & MASK;
+        }
+    }
+
+  for (i = 0; i < 4; i++)
+    state->out[i] = x[i];
+}
+
+static inline unsigned long int
+threefry_get (void *vstate)
+{
+  threefry_state_t *state = (threefry_state_t *) vstate;
+
+  if (state->idx == 4)
+    {
+      state->ctr[0] = (state->ctr[0] + 1) & MASK;
+      if (state->ctr[0] == 0)
+        state->ctr[1] = (state->ctr[1] + 1) & MASK;
+
+      threefry_block (state);
+      state->idx = 0;
+    }
+
+  return state->out[state->idx++];
+}
+
+static double
+threefry_get_double (void *vstate)
+{
+  return threefry_get (vstate) / 4294967296.0;
+}
+
+static void
+threefry_set (void *vstate, unsigned long int s)
+{
+  threefry_state_t *state = (threefry_state_t *) vstate;
+
+  state->key[0] = s & MASK;
+  state->key[1] = (s >> 16 >> 16) & MASK;
+
+  state->ctr[0] = 0;
+  state->ctr[1] = 0;
+  state->ctr[2] = 0;
+  state->ctr[3] = 0;
+
+  threefry_block (state);
+  state->idx = 0;
+}
+
+static int
+threefry_jump (void *vstate)
+{
+  threefry_state_t *state = (threefry_state_t *) vstate;
+
+  state->ctr[2] = (state->ctr[2] + 1) & MASK;
+  if (state->ctr[2] == 0)
+    state->ctr[3] = (state->ctr[3] + 1) & MASK;
+
+  threefry_block (state);
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type threefry_type =
+{"threefry4x32",                /* name */
+ 0xffffffffUL,                  /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (threefry_state_t),
+ &threefry_set,
+ &threefry_get,
+ &threefry_get_double,
+ 0,
+ 0,
+ &threefry_jump};
+
+const gsl_rng_type *gsl_rng_threefry4x32 = &threefry_type;
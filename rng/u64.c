@@ -0,0 +1,291 @@
+/* rng/u64.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Unsigned 64-bit arithmetic modulo 2^64 for the generators with
+   64-bit output (xoshiro256ss, pcg64).
+
+   When unsigned long has at least 64 bits a u64_t is an unsigned long
+   and the functions below reduce to single instructions.  Otherwise a
+   u64_t is a pair of 32-bit halves, so that the generators produce the
+   same sequence on all platforms.  In that case gsl_rng_get returns
+   the upper 32 bits of each 64-bit output (u64_get), while
+   gsl_rng_uniform is unchanged. */
+
+#include <limits.h>
+
+#if ULONG_MAX > 0xffffffffUL
+
+typedef unsigned long int u64_t;
+
+#define U64_MASK 0xffffffffffffffffUL
+
+static inline u64_t
+u64_make (unsigned long int hi, unsigned long int lo)
+{
+  return (hi << 32) | lo;
+}
+
+static inline unsigned long int
+u64_hi (u64_t a)
+{
+  return a >> 32;
+}
+
+static inline unsigned long int
+u64_lo (u64_t a)
+{
+  return a & 0xffffffffUL;
+}
+
+static inline u64_t
+u64_xor (u64_t a, u64_t b)
+{
+  return a ^ b;
+}
+
+static inline u64_t
+u64_add (u64_t a, u64_t b)
+{
+  return (a + b) & U64_MASK;
+}
+
+/* returns 1 if a < b */
+static inline int
+u64_lt (u64_t a, u64_t b)
+{
+  return a < b;
+}
+
+static inline u64_t
+u64_shl (u64_t a, int n)
+{
+  return (a << n) & U64_MASK;
+}
+
+static inline u64_t
+u64_shr (u64_t a, int n)
+{
+  return a >> n;
+}
+
+/* rotations require 0 <= n < 64 */
+
+static inline u64_t
+u64_rotl (u64_t a, int n)
+{
+  return ((a << n) | (a >> ((64 - n) & 63))) & U64_MASK;
+}
+
+static inline u64_t
+u64_rotr (u64_t a, int n)
+{
+  return ((a >> n) | (a << ((64 - n) & 63))) & U64_MASK;
+}
+
+/* lower 64 bits of the product a*b */
+static inline u64_t
+u64_mul (u64_t a, u64_t b)
+{
+  return (a * b) & U64_MASK;
+}
+
+/* upper 64 bits of the product a*b */
+static inline u64_t
+u64_mulhi (u64_t a, u64_t b)
+{
+#if defined(__SIZEOF_INT128__) && ULONG_MAX == 0xffffffffffffffffUL
+  __extension__ typedef unsigned __int128 u128_t;
+
+  return (u64_t) (((u128_t) a * b) >> 64);
+#else
+  const unsigned long int a0 = a & 0xffffffffUL, a1 = a >> 32;
+  const unsigned long int b0 = b & 0xffffffffUL, b1 = b >> 32;
+  const unsigned long int p00 = a0 * b0, p01 = a0 * b1;
+  const unsigned long int p10 = a1 * b0, p11 = a1 * b1;
+  const unsigned long int mid =
+    (p00 >> 32) + (p01 & 0xffffffffUL) + (p10 & 0xffffffffUL);
+
+  return (p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32)) & U64_MASK;
+#endif
+}
+
+static inline unsigned long int
+u64_get (u64_t a)
+{
+  return a;
+}
+
+/* convert the upper 53 bits to a double in [0,1) */
+static inline double
+u64_to_double (u64_t a)
+{
+  return (double) (long int) (a >> 11) / 9007199254740992.0;
+}
+
+#else /* 32-bit unsigned long */
+
+typedef struct
+{
+  unsigned long int hi, lo;
+}
+u64_t;
+
+#define U64_MASK 0xffffffffUL
+
+static inline u64_t
+u64_make (unsigned long int hi, unsigned long int lo)
+{
+  u64_t r;
+  r.hi = hi;
+  r.lo = lo;
+  return r;
+}
+
+static inline unsigned long int
+u64_hi (u64_t a)
+{
+  return a.hi;
+}
+
+static inline unsigned long int
+u64_lo (u64_t a)
+{
+  return a.lo;
+}
+
+static inline u64_t
+u64_xor (u64_t a, u64_t b)
+{
+  return u64_make (a.hi ^ b.hi, a.lo ^ b.lo);
+}
+
+static inline u64_t
+u64_add (u64_t a, u64_t b)
+{
+  const unsigned long int lo = (a.lo + b.lo) & U64_MASK;
+  const unsigned long int carry = (lo < a.lo);
+
+  return u64_make ((a.hi + b.hi + carry) & U64_MASK, lo);
+}
+
+static inline int
+u64_lt (u64_t a, u64_t b)
+{
+  return (a.hi < b.hi) || (a.hi == b.hi && a.lo < b.lo);
+}
+
+static inline u64_t
+u64_shl (u64_t a, int n)
+{
+  if (n == 0)
+    return a;
+  else if (n < 32)
+    return u64_make (((a.hi << n) | (a.lo >> (32 - n))) & U64_MASK,
+                     (a.lo << n) & U64_MASK);
+  else
+    return u64_make ((a.lo << (n - 32)) & U64_MASK, 0);
+}
+
+static inline u64_t
+u64_shr (u64_t a, int n)
+{
+  if (n == 0)
+    return a;
+  else if (n < 32)
+    return u64_make (a.hi >> n,
+                     ((a.lo >> n) | (a.hi << (32 - n))) & U64_MASK);
+  else
+    return u64_make (0, a.hi >> (n - 32));
+}
+
+static inline u64_t
+u64_rotl (u64_t a, int n)
+{
+  u64_t l, r;
+
+  if (n == 0)
+    return a;
+
+  l = u64_shl (a, n);
+  r = u64_shr (a, 64 - n);
+
+  return u64_make (l.hi | r.hi, l.lo | r.lo);
+}
+
+static inline u64_t
+u64_rotr (u64_t a, int n)
+{
+  return (n == 0) ? a : u64_rotl (a, 64 - n);
+}
+
+/* full 64-bit product of two 32-bit values */
+static inline u64_t
+u64_mul32 (unsigned long int a, unsigned long int b)
+{
+  const unsigned long int a0 = a & 0xffffUL, a1 = a >> 16;
+  const unsigned long int b0 = b & 0xffffUL, b1 = b >> 16;
+  const unsigned long int p00 = a0 * b0, p01 = a0 * b1;
+  const unsigned long int p10 = a1 * b0, p11 = a1 * b1;
+  const unsigned long int mid =
+    (p00 >> 16) + (p01 & 0xffffUL) + (p10 & 0xffffUL);
+
+  return u64_make ((p11 + (p01 >> 16) + (p10 >> 16) + (mid >> 16)) & U64_MASK,
+                   ((p00 & 0xffffUL) | (mid << 16)) & U64_MASK);
+}
+
+static inline u64_t
+u64_mul (u64_t a, u64_t b)
+{
+  u64_t p = u64_mul32 (a.lo, b.lo);
+
+  p.hi = (p.hi + a.hi * b.lo + a.lo * b.hi) & U64_MASK;
+
+  return p;
+}
+
+static inline u64_t
+u64_mulhi (u64_t a, u64_t b)
+{
+  const u64_t p00 = u64_mul32 (a.lo, b.lo), p01 = u64_mul32 (a.lo, b.hi);
+  const u64_t p10 = u64_mul32 (a.hi, b.lo), p11 = u64_mul32 (a.hi, b.hi);
+  u64_t mid, r;
+
+  mid = u64_add (u64_make (0, p00.hi), u64_make (0, p01.lo));
+  mid = u64_add (mid, u64_make (0, p10.lo));
+
+  r = u64_add (p11, u64_make (0, p01.hi));
+  r = u64_add (r, u64_make (0, p10.hi));
+  r = u64_add (r, u64_make (0, mid.hi));
+
+  return r;
+}
+
+static inline unsigned long int
+u64_get (u64_t a)
+{
+  return a.hi;
+}
+
+static inline double
+u64_to_double (u64_t a)
+{
+  return (a.hi * 2097152.0 + (a.lo >> 11)) / 9007199254740992.0;
+}
+
+#endif
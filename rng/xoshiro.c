@@ -0,0 +1,185 @@
+/* rng/xoshiro.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* This is the xoshiro256** generator of Blackman and Vigna.  The state
+   is four 64-bit words s0..s3, updated by the F2-linear transformation
+
+   t = s1 << 17
+   s2 ^= s0, s3 ^= s1, s1 ^= s2, s0 ^= s3, s2 ^= t, s3 = rotl(s3, 45)
+
+   and the output is the scrambled value rotl(5 s1, 7) * 9 computed
+   from s1 before the update.  The period is 2^256 - 1.
+
+   The generator is seeded by filling the state with four successive
+   outputs of the splitmix64 generator started from the seed, as
+   recommended by the authors.  The jump function advances the state
+   by 2^128 steps using the published jump polynomial.
+
+   Reference: D. Blackman and S. Vigna, "Scrambled linear pseudorandom
+   number generators", ACM Transactions on Mathematical Software 47,
+   36 (2021). */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_rng.h>
+#include "u64.c"
+
+static inline unsigned long int xoshiro_get (void *vstate);
+static double xoshiro_get_double (void *vstate);
+static void xoshiro_set (void *state, unsigned long int s);
+static void xoshiro_fill (void *vstate, unsigned long int *x, size_t n);
+static void xoshiro_fill_double (void *vstate, double *x, size_t n);
+static int xoshiro_jump (void *vstate);
+
+typedef struct
+{
+  u64_t s[4];
+}
+xoshiro_state_t;
+
+static inline u64_t
+xoshiro_next (xoshiro_state_t * state)
+{
+  u64_t *s = state->s;
+  const u64_t result = u64_mul (u64_rotl (u64_mul (s[1], u64_make (0, 5)), 7),
+                                u64_make (0, 9));
+  const u64_t t = u64_shl (s[1], 17);
+
+  s[2] = u64_xor (s[2], s[0]);
+  s[3] = u64_xor (s[3], s[1]);
+  s[1] = u64_xor (s[1], s[2]);
+  s[0] = u64_xor (s[0], s[3]);
+  s[2] = u64_xor (s[2], t);
+  s[3] = u64_rotl (s[3], 45);
+
+  return result;
+}
+
+static inline unsigned long int
+xoshiro_get (void *vstate)
+{
+  return u64_get (xoshiro_next ((xoshiro_state_t *) vstate));
+}
+
+static double
+xoshiro_get_double (void *vstate)
+{
+  return u64_to_double (xoshiro_next ((xoshiro_state_t *) vstate));
+}
+
+static void
+xoshiro_fill (void *vstate, unsigned long int *x, size_t n)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = u64_get (xoshiro_next (state));
+}
+
+static void
+xoshiro_fill_double (void *vstate, double *x, size_t n)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    x[i] = u64_to_double (xoshiro_next (state));
+}
+
+static void
+xoshiro_set (void *vstate, unsigned long int s)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+  const u64_t gamma = u64_make (0x9e3779b9UL, 0x7f4a7c15UL);
+  const u64_t m1 = u64_make (0xbf58476dUL, 0x1ce4e5b9UL);
+  const u64_t m2 = u64_make (0x94d049bbUL, 0x133111ebUL);
+  u64_t x = u64_make ((s >> 16 >> 16) & 0xffffffffUL, s & 0xffffffffUL);
+  int i;
+
+  /* splitmix64 */
+
+  for (i = 0; i < 4; i++)
+    {
+      u64_t z;
+
+      x = u64_add (x, gamma);
+      z = x;
+      z = u64_mul (u64_xor (z, u64_shr (z, 30)), m1);
+      z = u64_mul (u64_xor (z, u64_shr (z, 27)), m2);
+      state->s[i] = u64_xor (z, u64_shr (z, 31));
+    }
+}
+
+/* coefficients of the jump polynomial for 2^128 steps, as pairs of
+   32-bit halves of the four 64-bit words */
+
+static const unsigned long int xoshiro_jump_poly[4][2] = {
+  {0x180ec6d3UL, 0x3cfd0abaUL},
+  {0xd5a61266UL, 0xf0c9392cUL},
+  {0xa9582618UL, 0xe03fc9aaUL},
+  {0x39abdc45UL, 0x29b1661cUL}
+};
+
+static int
+xoshiro_jump (void *vstate)
+{
+  xoshiro_state_t *state = (xoshiro_state_t *) vstate;
+  u64_t acc[4];
+  int i, j, b;
+
+  for (j = 0; j < 4; j++)
+    acc[j] = u64_make (0, 0);
+
+  for (i = 0; i < 4; i++)
+    {
+      for (b = 0; b < 64; b++)
+        {
+          const unsigned long int w =
+            xoshiro_jump_poly[i][b < 32 ? 1 : 0];
+
+          if ((w >> (b % 32)) & 1)
+            {
+              for (j = 0; j < 4; j++)
+                acc[j] = u64_xor (acc[j], state->s[j]);
+            }
+
+          xoshiro_next (state);
+        }
+    }
+
+  for (j = 0; j < 4; j++)
+    state->s[j] = acc[j];
+
+  return GSL_SUCCESS;
+}
+
+static const gsl_rng_type xoshiro_type =
+{"xoshiro256ss",                /* name */
+ ULONG_MAX,                     /* RAND_MAX */
+ 0,                             /* RAND_MIN */
+ sizeof (xoshiro_state_t),
+ &xoshiro_set,
+ &xoshiro_get,
+ &xoshiro_get_double,
+ &xoshiro_fill,
+ &xoshiro_fill_double,
+ &xoshiro_jump};
+
+const gsl_rng_type *gsl_rng_xoshiro256ss = &xoshiro_type;
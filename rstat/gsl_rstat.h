@@ -1,6 +1,7 @@
 /* rstat/gsl_rstat.h
  * 
  * Copyright (C) 2015 Patrick Alken
+ * Copyright (C) 2026 The GSL Team
  * 
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -20,6 +21,8 @@
 #ifndef __GSL_RSTAT_H__
 #define __GSL_RSTAT_H__
 
+#include <stdio.h>
+
 #undef __BEGIN_DECLS
 #undef __END_DECLS
 #ifdef __cplusplus
@@ -48,6 +51,34 @@ int gsl_rstat_quantile_reset(gsl_rstat_quantile_workspace *w);
 int gsl_rstat_quantile_add(const double x, gsl_rstat_quantile_workspace *w);
 double gsl_rstat_quantile_get(gsl_rstat_quantile_workspace *w);
 
+typedef struct
+{
+  double delta;           /* compression parameter */
+  size_t max_centroids;   /* maximum number of centroids */
+  size_t max_buffer;      /* maximum number of unmerged points */
+  size_t ncentroids;      /* number of centroids */
+  size_t nbuffer;         /* number of unmerged points */
+  double *mean;           /* centroid means, in increasing order */
+  double *weight;         /* centroid weights */
+  double *buffer_mean;    /* unmerged points, with room for the centroids */
+  double *buffer_weight;
+  double W;               /* total weight of centroids and buffer */
+  double min;             /* minimum value added */
+  double max;             /* maximum value added */
+  size_t n;               /* number of data added */
+} gsl_rstat_tdigest_workspace;
+
+gsl_rstat_tdigest_workspace *gsl_rstat_tdigest_alloc(const double delta);
+void gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w);
+size_t gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                            const gsl_rstat_tdigest_workspace *src);
+double gsl_rstat_tdigest_quantile(const double p, gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_fwrite(FILE *stream, const gsl_rstat_tdigest_workspace *w);
+int gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w);
+
 typedef struct
 {
   double min;      /* minimum value added */
@@ -56,6 +87,9 @@ typedef struct
   double M2;       /* M_k = sum_{i=1..n} [ x_i - mean_n ]^k */
   double M3;
   double M4;
+  double W;        /* sum of weights */
+  double W2;       /* sum of squared weights */
+  double lambda;   /* forgetting factor applied before each point */
   size_t n;        /* number of data points added */
   gsl_rstat_quantile_workspace *median_workspace_p; /* median workspace */
 } gsl_rstat_workspace;
@@ -64,6 +98,11 @@ gsl_rstat_workspace *gsl_rstat_alloc(void);
 void gsl_rstat_free(gsl_rstat_workspace *w);
 size_t gsl_rstat_n(const gsl_rstat_workspace *w);
 int gsl_rstat_add(const double x, gsl_rstat_workspace *w);
+int gsl_rstat_wadd(const double x, const double wt, gsl_rstat_workspace *w);
+int gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                        gsl_rstat_workspace *w);
+int gsl_rstat_merge(gsl_rstat_workspace *dest, const gsl_rstat_workspace *src);
+int gsl_rstat_set_decay(const double lambda, gsl_rstat_workspace *w);
 double gsl_rstat_min(const gsl_rstat_workspace *w);
 double gsl_rstat_max(const gsl_rstat_workspace *w);
 double gsl_rstat_mean(const gsl_rstat_workspace *w);
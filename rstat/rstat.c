@@ -1,6 +1,7 @@
 /* rstat/rstat.c
  * 
  * Copyright (C) 2015 Patrick Alken
+ * Copyright (C) 2026 The GSL Team
  * 
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -24,6 +25,17 @@
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_rstat.h>
 
+/* number of points whose moments are found before merging them into
+   the totals in gsl_rstat_add_array() */
+#define RSTAT_BLOCK 64
+
+static void rstat_merge_moments(const double Wb, const double mean_b,
+                                const double M2b, const double M3b,
+                                const double M4b, gsl_rstat_workspace *w);
+static void rstat_decay(gsl_rstat_workspace *w);
+static void rstat_merge_median(gsl_rstat_quantile_workspace *dest,
+                               const gsl_rstat_quantile_workspace *src);
+
 gsl_rstat_workspace *
 gsl_rstat_alloc(void)
 {
@@ -44,6 +56,8 @@ gsl_rstat_alloc(void)
                       GSL_ENOMEM);
     }
 
+  w->lambda = 1.0;
+
   gsl_rstat_reset(w);
 
   return w;
@@ -68,8 +82,21 @@ gsl_rstat_n(const gsl_rstat_workspace *w)
 int
 gsl_rstat_add(const double x, gsl_rstat_workspace *w)
 {
-  double delta = x - w->mean;
-  double delta_n, delta_nsq, term1, n;
+  return gsl_rstat_wadd(x, 1.0, w);
+} /* gsl_rstat_add() */
+
+/* add a data point with weight wt to the running totals */
+int
+gsl_rstat_wadd(const double x, const double wt, gsl_rstat_workspace *w)
+{
+  if (wt < 0.0)
+    {
+      GSL_ERROR ("weight must be non-negative", GSL_EDOM);
+    }
+  else if (wt == 0.0)
+    {
+      return GSL_SUCCESS;
+    }
 
   /* update min and max */
   if (w->n == 0)
@@ -85,22 +112,126 @@ gsl_rstat_add(const double x, gsl_rstat_workspace *w)
         w->max = x;
     }
 
-  /* update mean and variance */
-  n = (double) ++(w->n);
-  delta_n = delta / n;
-  delta_nsq = delta_n * delta_n;
-  term1 = delta * delta_n * (n - 1.0);
-  w->mean += delta_n;
-  w->M4 += term1 * delta_nsq * (n * n - 3.0 * n + 3.0) +
-           6.0 * delta_nsq * w->M2 - 4.0 * delta_n * w->M3;
-  w->M3 += term1 * delta_n * (n - 2.0) - 3.0 * delta_n * w->M2;
-  w->M2 += term1;
+  /* update mean and higher moments */
+  rstat_decay(w);
+  rstat_merge_moments(wt, x, 0.0, 0.0, 0.0, w);
+  w->W2 += wt * wt;
+  ++(w->n);
 
   /* update median */
   gsl_rstat_quantile_add(x, w->median_workspace_p);
 
   return GSL_SUCCESS;
-} /* gsl_rstat_add() */
+} /* gsl_rstat_wadd() */
+
+/* add the n data points x[i*stride] to the running totals */
+int
+gsl_rstat_add_array(const double x[], const size_t stride, const size_t n,
+                    gsl_rstat_workspace *w)
+{
+  size_t i0, i;
+
+  if (w->lambda != 1.0)
+    {
+      /* the weights differ between points, so add them one at a time */
+      for (i = 0; i < n; ++i)
+        gsl_rstat_add(x[i * stride], w);
+
+      return GSL_SUCCESS;
+    }
+
+  /* find the moments of each block about its own mean with two short
+     loops, and merge them into the totals */
+  for (i0 = 0; i0 < n; i0 += RSTAT_BLOCK)
+    {
+      const size_t nb = GSL_MIN(RSTAT_BLOCK, n - i0);
+      const double *xb = x + i0 * stride;
+      double sum = 0.0, mean_b, M2b = 0.0, M3b = 0.0, M4b = 0.0;
+
+      if (w->n == 0)
+        {
+          w->min = xb[0];
+          w->max = xb[0];
+        }
+
+      for (i = 0; i < nb; ++i)
+        {
+          const double xi = xb[i * stride];
+
+          sum += xi;
+
+          if (xi < w->min)
+            w->min = xi;
+          if (xi > w->max)
+            w->max = xi;
+        }
+
+      mean_b = sum / nb;
+
+      for (i = 0; i < nb; ++i)
+        {
+          const double d = xb[i * stride] - mean_b;
+          const double d2 = d * d;
+
+          M2b += d2;
+          M3b += d2 * d;
+          M4b += d2 * d2;
+        }
+
+      rstat_merge_moments((double) nb, mean_b, M2b, M3b, M4b, w);
+      w->W2 += (double) nb;
+      w->n += nb;
+
+      for (i = 0; i < nb; ++i)
+        gsl_rstat_quantile_add(xb[i * stride], w->median_workspace_p);
+    }
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_add_array() */
+
+/* combine the data of src into dest, as if they had been added to dest */
+int
+gsl_rstat_merge(gsl_rstat_workspace *dest, const gsl_rstat_workspace *src)
+{
+  if (src->n == 0)
+    return GSL_SUCCESS;
+
+  if (dest->n == 0)
+    {
+      dest->min = src->min;
+      dest->max = src->max;
+    }
+  else
+    {
+      if (src->min < dest->min)
+        dest->min = src->min;
+      if (src->max > dest->max)
+        dest->max = src->max;
+    }
+
+  rstat_merge_moments(src->W, src->mean, src->M2, src->M3, src->M4, dest);
+  dest->W2 += src->W2;
+  dest->n += src->n;
+
+  rstat_merge_median(dest->median_workspace_p, src->median_workspace_p);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_merge() */
+
+/* set the factor by which the weights of earlier data are multiplied
+   each time a point is added, giving exponentially decaying statistics */
+int
+gsl_rstat_set_decay(const double lambda, gsl_rstat_workspace *w)
+{
+  if (!(lambda > 0.0 && lambda <= 1.0))
+    {
+      GSL_ERROR ("lambda must be in (0,1]", GSL_EDOM);
+    }
+
+  w->lambda = lambda;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_set_decay() */
 
 double
 gsl_rstat_min(const gsl_rstat_workspace *w)
@@ -125,8 +256,8 @@ gsl_rstat_variance(const gsl_rstat_workspace *w)
 {
   if (w->n > 1)
     {
-      double n = (double) w->n;
-      return (w->M2 / (n - 1.0));
+      /* equal to M2 / (n - 1) for unit weights */
+      return (w->M2 * w->W / (w->W * w->W - w->W2));
     }
   else
     return 0.0;
@@ -148,23 +279,21 @@ gsl_rstat_rms(const gsl_rstat_workspace *w)
   if (w->n > 0)
     {
       double mean = gsl_rstat_mean(w);
-      double sigma = gsl_rstat_sd(w);
-      double n = (double) w->n;
-      double a = sqrt((n - 1.0) / n);
-      rms = gsl_hypot(mean, a * sigma);
+      rms = gsl_hypot(mean, sqrt(w->M2 / w->W));
     }
 
   return rms;
 }
 
-/* standard deviation of the mean: sigma / sqrt(n) */
+/* standard deviation of the mean: sigma / sqrt(n_eff), where the
+   effective number of points n_eff = W^2 / W2 is n for unit weights */
 double
 gsl_rstat_sd_mean(const gsl_rstat_workspace *w)
 {
   if (w->n > 0)
     {
       double sd = gsl_rstat_sd(w);
-      return (sd / sqrt((double) w->n));
+      return (sd * sqrt(w->W2) / w->W);
     }
   else
     return 0.0;
@@ -181,9 +310,8 @@ gsl_rstat_skew(const gsl_rstat_workspace *w)
 {
   if (w->n > 0)
     {
-      double n = (double) w->n;
-      double fac = pow(n - 1.0, 1.5) / n;
-      return ((fac * w->M3) / pow(w->M2, 1.5));
+      double var = gsl_rstat_variance(w);
+      return ((w->M3 / w->W) / pow(var, 1.5));
     }
   else
     return 0.0;
@@ -194,9 +322,8 @@ gsl_rstat_kurtosis(const gsl_rstat_workspace *w)
 {
   if (w->n > 0)
     {
-      double n = (double) w->n;
-      double fac = ((n - 1.0) / n) * (n - 1.0);
-      return ((fac * w->M4) / (w->M2 * w->M2) - 3.0);
+      double var = gsl_rstat_variance(w);
+      return ((w->M4 / w->W) / (var * var) - 3.0);
     }
   else
     return 0.0;
@@ -213,9 +340,114 @@ gsl_rstat_reset(gsl_rstat_workspace *w)
   w->M2 = 0.0;
   w->M3 = 0.0;
   w->M4 = 0.0;
+  w->W = 0.0;
+  w->W2 = 0.0;
   w->n = 0;
 
   status = gsl_rstat_quantile_reset(w->median_workspace_p);
 
   return status;
 } /* gsl_rstat_reset() */
+
+/* merge a block of total weight Wb, mean mean_b and central moment sums
+   M2b, M3b, M4b into the running totals, using the formulas of
+
+   P. Pebay, "Formulas for robust, one-pass parallel computation of
+   covariances and arbitrary-order statistical moments", Sandia Report
+   SAND2008-6212 (2008)
+
+   For a single point (M2b = M3b = M4b = 0) this is the usual update of
+   Welford's method. */
+
+static void
+rstat_merge_moments(const double Wb, const double mean_b,
+                    const double M2b, const double M3b, const double M4b,
+                    gsl_rstat_workspace *w)
+{
+  const double Wa = w->W;
+  const double W = Wa + Wb;
+  const double delta = mean_b - w->mean;
+  const double delta_W = delta / W;
+  const double delta_Wsq = delta_W * delta_W;
+  const double term1 = delta * delta_W * Wa * Wb;
+
+  w->M4 += M4b + term1 * delta_Wsq * (Wa * Wa - Wa * Wb + Wb * Wb) +
+           6.0 * delta_Wsq * (Wa * Wa * M2b + Wb * Wb * w->M2) +
+           4.0 * delta_W * (Wa * M3b - Wb * w->M3);
+  w->M3 += M3b + term1 * delta_W * (Wa - Wb) +
+           3.0 * delta_W * (Wa * M2b - Wb * w->M2);
+  w->M2 += M2b + term1;
+  w->mean += delta_W * Wb;
+  w->W = W;
+}
+
+/* multiply the weights of all the data so far by the forgetting factor */
+static void
+rstat_decay(gsl_rstat_workspace *w)
+{
+  const double lambda = w->lambda;
+
+  if (lambda != 1.0)
+    {
+      w->W *= lambda;
+      w->W2 *= lambda * lambda;
+      w->M2 *= lambda;
+      w->M3 *= lambda;
+      w->M4 *= lambda;
+    }
+}
+
+/* Combine the P^2 markers of two median estimates.  The extreme markers
+   are the overall minimum and maximum, and the middle markers are the
+   averages of those of dest and src weighted by the number of points,
+   at the sum of their positions, so the result is only an estimate.
+   While either workspace holds five points or fewer, which are stored
+   unsorted, those points are added to the other one directly. */
+
+static void
+rstat_merge_median(gsl_rstat_quantile_workspace *dest,
+                   const gsl_rstat_quantile_workspace *src)
+{
+  size_t i;
+
+  if (src->n <= 5)
+    {
+      for (i = 0; i < src->n; ++i)
+        gsl_rstat_quantile_add(src->q[i], dest);
+    }
+  else if (dest->n <= 5)
+    {
+      double q[5];
+      const size_t n = dest->n;
+
+      for (i = 0; i < n; ++i)
+        q[i] = dest->q[i];
+
+      *dest = *src;
+
+      for (i = 0; i < n; ++i)
+        gsl_rstat_quantile_add(q[i], dest);
+    }
+  else
+    {
+      const double na = (double) dest->n;
+      const double nb = (double) src->n;
+      const size_t n = dest->n + src->n;
+
+      for (i = 1; i <= 3; ++i)
+        {
+          dest->q[i] = (na * dest->q[i] + nb * src->q[i]) / (na + nb);
+          dest->npos[i] += src->npos[i];
+        }
+
+      dest->q[0] = GSL_MIN(dest->q[0], src->q[0]);
+      dest->q[4] = GSL_MAX(dest->q[4], src->q[4]);
+      dest->npos[4] = (int) n;
+
+      /* desired positions, as after adding n points */
+      for (i = 0; i < 5; ++i)
+        dest->np[i] = 1.0 + (n - 1.0) * dest->dnp[i];
+
+      dest->n = n;
+    }
+}
@@ -0,0 +1,427 @@
+/* rstat/tdigest.c
+ * 
+ * Copyright (C) 2026 The GSL Team
+ * 
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ * 
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ * 
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#include <config.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_block.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_rstat.h>
+
+/*
+ * Streaming quantile estimation with a merging t-digest, based on
+ *
+ * [1] T. Dunning and O. Ertl, "Computing extremely accurate quantiles
+ *     using t-digests", arXiv:1902.04023 (2019)
+ *
+ * The data are summarized by centroids (mean, weight) sorted by mean.
+ * New points are stored in a buffer, and when it is full the buffer and
+ * the centroids are sorted together and swept from left to right,
+ * merging neighbours as long as the merged centroid spans at most one
+ * unit of the scale function
+ *
+ *   k(q) = (delta / Z) log(q / (1 - q)),  Z = 4 log(n / delta) + 24
+ *
+ * which allows large centroids near the median and single points at
+ * the extremes, so that the relative accuracy of a quantile is about
+ * the same in the tails as in the middle.  Adjacent pairs of centroids
+ * span more than one unit of k, and with this normalization there are
+ * fewer than delta + 2 centroids.
+ */
+
+static void tdigest_compress(gsl_rstat_tdigest_workspace *w);
+static void tdigest_push(const double x, const double wt,
+                         gsl_rstat_tdigest_workspace *w);
+
+gsl_rstat_tdigest_workspace *
+gsl_rstat_tdigest_alloc(const double delta)
+{
+  gsl_rstat_tdigest_workspace *w;
+  size_t nmax;
+
+  if (!(delta >= 1.0))
+    {
+      GSL_ERROR_NULL ("compression delta must be at least 1", GSL_EDOM);
+    }
+
+  w = calloc(1, sizeof(gsl_rstat_tdigest_workspace));
+  if (w == 0)
+    {
+      GSL_ERROR_NULL ("failed to allocate space for workspace", GSL_ENOMEM);
+    }
+
+  w->delta = delta;
+  w->max_centroids = 2 * (size_t) ceil(delta) + 2;
+  w->max_buffer = 5 * (size_t) ceil(delta);
+
+  nmax = w->max_centroids + w->max_buffer;
+
+  w->mean = malloc(w->max_centroids * sizeof(double));
+  w->weight = malloc(w->max_centroids * sizeof(double));
+  w->buffer_mean = malloc(nmax * sizeof(double));
+  w->buffer_weight = malloc(nmax * sizeof(double));
+
+  if (w->mean == 0 || w->weight == 0 ||
+      w->buffer_mean == 0 || w->buffer_weight == 0)
+    {
+      gsl_rstat_tdigest_free(w);
+      GSL_ERROR_NULL ("failed to allocate space for centroids", GSL_ENOMEM);
+    }
+
+  gsl_rstat_tdigest_reset(w);
+
+  return w;
+} /* gsl_rstat_tdigest_alloc() */
+
+void
+gsl_rstat_tdigest_free(gsl_rstat_tdigest_workspace *w)
+{
+  if (w->mean)
+    free(w->mean);
+
+  if (w->weight)
+    free(w->weight);
+
+  if (w->buffer_mean)
+    free(w->buffer_mean);
+
+  if (w->buffer_weight)
+    free(w->buffer_weight);
+
+  free(w);
+} /* gsl_rstat_tdigest_free() */
+
+int
+gsl_rstat_tdigest_reset(gsl_rstat_tdigest_workspace *w)
+{
+  w->ncentroids = 0;
+  w->nbuffer = 0;
+  w->W = 0.0;
+  w->min = 0.0;
+  w->max = 0.0;
+  w->n = 0;
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_reset() */
+
+size_t
+gsl_rstat_tdigest_n(const gsl_rstat_tdigest_workspace *w)
+{
+  return w->n;
+} /* gsl_rstat_tdigest_n() */
+
+int
+gsl_rstat_tdigest_add(const double x, gsl_rstat_tdigest_workspace *w)
+{
+  if (gsl_isnan(x))
+    {
+      GSL_ERROR ("invalid input argument x", GSL_EINVAL);
+    }
+
+  if (w->n == 0)
+    {
+      w->min = x;
+      w->max = x;
+    }
+  else
+    {
+      if (x < w->min)
+        w->min = x;
+      if (x > w->max)
+        w->max = x;
+    }
+
+  ++(w->n);
+  tdigest_push(x, 1.0, w);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_add() */
+
+/* add the centroids and unmerged points of src to dest */
+int
+gsl_rstat_tdigest_merge(gsl_rstat_tdigest_workspace *dest,
+                        const gsl_rstat_tdigest_workspace *src)
+{
+  size_t i;
+
+  if (src->n == 0)
+    return GSL_SUCCESS;
+
+  if (dest->n == 0)
+    {
+      dest->min = src->min;
+      dest->max = src->max;
+    }
+  else
+    {
+      if (src->min < dest->min)
+        dest->min = src->min;
+      if (src->max > dest->max)
+        dest->max = src->max;
+    }
+
+  dest->n += src->n;
+
+  for (i = 0; i < src->ncentroids; ++i)
+    tdigest_push(src->mean[i], src->weight[i], dest);
+
+  for (i = 0; i < src->nbuffer; ++i)
+    tdigest_push(src->buffer_mean[i], src->buffer_weight[i], dest);
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_merge() */
+
+/*
+gsl_rstat_tdigest_quantile()
+  Estimate the p-quantile, with the definition of
+gsl_stats_quantile_from_sorted_data(), by linear interpolation of the
+rank (p (n-1), counting from 0) between the centres of the centroids.
+A centroid of weight w whose first point has rank r has its centre at
+r + (w - 1)/2, so the result is exact while all the centroids are
+single points.  Below the first and above the last centre the
+interpolation is to the minimum and maximum.
+*/
+
+double
+gsl_rstat_tdigest_quantile(const double p, gsl_rstat_tdigest_workspace *w)
+{
+  const double *mean = w->mean;
+  const double *weight = w->weight;
+  double index, c0, c1, cum;
+  size_t i, nc;
+
+  if (!(p >= 0.0 && p <= 1.0))
+    {
+      GSL_ERROR_VAL ("p must be in [0,1]", GSL_EDOM, GSL_NAN);
+    }
+
+  if (w->n == 0)
+    return 0.0;
+
+  if (w->nbuffer > 0)
+    tdigest_compress(w);
+
+  nc = w->ncentroids;
+  index = p * (w->W - 1.0);
+
+  c0 = 0.5 * (weight[0] - 1.0);
+
+  if (index <= c0)
+    {
+      if (c0 <= 0.0)
+        return mean[0];
+
+      return w->min + (mean[0] - w->min) * (index / c0);
+    }
+
+  cum = weight[0];
+
+  for (i = 1; i < nc; ++i)
+    {
+      c1 = cum + 0.5 * (weight[i] - 1.0);
+
+      if (index < c1)
+        {
+          const double t = (index - c0) / (c1 - c0);
+          return mean[i - 1] + t * (mean[i] - mean[i - 1]);
+        }
+
+      c0 = c1;
+      cum += weight[i];
+    }
+
+  /* beyond the centre of the last centroid */
+  {
+    const double last = w->W - 1.0;
+
+    if (last <= c0)
+      return mean[nc - 1];
+
+    return mean[nc - 1] + (w->max - mean[nc - 1]) * ((index - c0) / (last - c0));
+  }
+} /* gsl_rstat_tdigest_quantile() */
+
+/*
+gsl_rstat_tdigest_fwrite()
+  Write the digest to a stream in binary format, as the compression,
+number of points, minimum, maximum, and numbers of centroids and
+unmerged points, followed by their means and weights
+*/
+
+int
+gsl_rstat_tdigest_fwrite(FILE *stream, const gsl_rstat_tdigest_workspace *w)
+{
+  double header[6];
+  int status;
+
+  header[0] = w->delta;
+  header[1] = (double) w->n;
+  header[2] = w->min;
+  header[3] = w->max;
+  header[4] = (double) w->ncentroids;
+  header[5] = (double) w->nbuffer;
+
+  status = gsl_block_raw_fwrite(stream, header, 6, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite(stream, w->mean, w->ncentroids, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite(stream, w->weight, w->ncentroids, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite(stream, w->buffer_mean, w->nbuffer, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fwrite(stream, w->buffer_weight, w->nbuffer, 1);
+
+  return status;
+} /* gsl_rstat_tdigest_fwrite() */
+
+int
+gsl_rstat_tdigest_fread(FILE *stream, gsl_rstat_tdigest_workspace *w)
+{
+  double header[6];
+  size_t i;
+  int status;
+
+  status = gsl_block_raw_fread(stream, header, 6, 1);
+  if (status)
+    return status;
+
+  if (header[0] != w->delta)
+    {
+      GSL_ERROR ("compression of stored digest does not match workspace",
+                 GSL_EBADLEN);
+    }
+
+  if (header[4] > w->max_centroids || header[5] > w->max_buffer)
+    {
+      GSL_ERROR ("stored digest is too large for workspace", GSL_EBADLEN);
+    }
+
+  w->n = (size_t) header[1];
+  w->min = header[2];
+  w->max = header[3];
+  w->ncentroids = (size_t) header[4];
+  w->nbuffer = (size_t) header[5];
+
+  status = gsl_block_raw_fread(stream, w->mean, w->ncentroids, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fread(stream, w->weight, w->ncentroids, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fread(stream, w->buffer_mean, w->nbuffer, 1);
+  if (status)
+    return status;
+
+  status = gsl_block_raw_fread(stream, w->buffer_weight, w->nbuffer, 1);
+  if (status)
+    return status;
+
+  w->W = 0.0;
+
+  for (i = 0; i < w->ncentroids; ++i)
+    w->W += w->weight[i];
+
+  for (i = 0; i < w->nbuffer; ++i)
+    w->W += w->buffer_weight[i];
+
+  return GSL_SUCCESS;
+} /* gsl_rstat_tdigest_fread() */
+
+/* add a point or centroid to the buffer, compressing it when full */
+static void
+tdigest_push(const double x, const double wt, gsl_rstat_tdigest_workspace *w)
+{
+  w->buffer_mean[w->nbuffer] = x;
+  w->buffer_weight[w->nbuffer] = wt;
+  ++(w->nbuffer);
+  w->W += wt;
+
+  if (w->nbuffer == w->max_buffer)
+    tdigest_compress(w);
+}
+
+/* merge the buffer into the centroids */
+static void
+tdigest_compress(gsl_rstat_tdigest_workspace *w)
+{
+  const double W = w->W;
+  const double Z = 4.0 * log(GSL_MAX(W / w->delta, 1.0)) + 24.0;
+  const double r = exp(-Z / w->delta);
+  double *bmean = w->buffer_mean;
+  double *bweight = w->buffer_weight;
+  const size_t m = w->nbuffer + w->ncentroids;
+  double wsofar = 0.0, qlimit = 0.0;
+  size_t i, nc = 0;
+
+  /* sort the centroids and buffered points together */
+  for (i = 0; i < w->ncentroids; ++i)
+    {
+      bmean[w->nbuffer + i] = w->mean[i];
+      bweight[w->nbuffer + i] = w->weight[i];
+    }
+
+  gsl_sort2(bmean, 1, bweight, 1, m);
+
+  w->mean[0] = bmean[0];
+  w->weight[0] = bweight[0];
+
+  for (i = 1; i < m; ++i)
+    {
+      const double wcur = w->weight[nc];
+
+      if ((wsofar + wcur + bweight[i]) / W <= qlimit ||
+          nc + 1 == w->max_centroids)
+        {
+          /* merge into the current centroid */
+          const double wnew = wcur + bweight[i];
+
+          w->mean[nc] += (bmean[i] - w->mean[nc]) * (bweight[i] / wnew);
+          w->weight[nc] = wnew;
+        }
+      else
+        {
+          /* start a new centroid at q0, which may extend to the q
+             with k(q) = k(q0) + 1 */
+          const double q0 = GSL_MIN(wsofar + wcur, W) / W;
+
+          wsofar += wcur;
+          qlimit = q0 / (q0 + (1.0 - q0) * r);
+
+          ++nc;
+          w->mean[nc] = bmean[i];
+          w->weight[nc] = bweight[i];
+        }
+    }
+
+  w->ncentroids = nc + 1;
+  w->nbuffer = 0;
+}
@@ -1,6 +1,7 @@
 /* rstat/test.c
  * 
  * Copyright (C) 2015 Patrick Alken
+ * Copyright (C) 2026 The GSL Team
  * 
  * This program is free software; you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -115,6 +116,206 @@ test_quantile(const double p, const double data[], const size_t n,
   gsl_rstat_quantile_free(w);
 }
 
+/* compare the moments of two workspaces */
+void
+test_compare(const gsl_rstat_workspace *w, const gsl_rstat_workspace *expected,
+             const double tol, const char *desc, const size_t n)
+{
+  gsl_test_int(gsl_rstat_n(w), gsl_rstat_n(expected), "%s n n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_min(w), gsl_rstat_min(expected), tol, "%s min n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_max(w), gsl_rstat_max(expected), tol, "%s max n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_mean(w), gsl_rstat_mean(expected), tol, "%s mean n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_variance(w), gsl_rstat_variance(expected), tol, "%s variance n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_rms(w), gsl_rstat_rms(expected), tol, "%s rms n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_skew(w), gsl_rstat_skew(expected), tol, "%s skew n=%zu", desc, n);
+  gsl_test_rel(gsl_rstat_kurtosis(w), gsl_rstat_kurtosis(expected), tol, "%s kurtosis n=%zu", desc, n);
+}
+
+/* add data in a single array, and in shards which are merged, and
+   compare with adding the points one at a time */
+void
+test_merge(const size_t n, const size_t nshards, const double data[],
+           const double tol)
+{
+  gsl_rstat_workspace *w = gsl_rstat_alloc();
+  gsl_rstat_workspace *warray = gsl_rstat_alloc();
+  gsl_rstat_workspace *wmerge = gsl_rstat_alloc();
+  gsl_rstat_workspace *wshard = gsl_rstat_alloc();
+  size_t i, k;
+
+  for (i = 0; i < n; ++i)
+    gsl_rstat_add(data[i], w);
+
+  gsl_rstat_add_array(data, 1, n, warray);
+  test_compare(warray, w, tol, "add_array", n);
+  gsl_test_abs(gsl_rstat_median(warray), gsl_rstat_median(w), 1.0e-12,
+               "add_array median n=%zu", n);
+
+  for (k = 0; k < nshards; ++k)
+    {
+      const size_t lo = n * k / nshards, hi = n * (k + 1) / nshards;
+
+      gsl_rstat_reset(wshard);
+      gsl_rstat_add_array(data + lo, 1, hi - lo, wshard);
+      gsl_rstat_merge(wmerge, wshard);
+    }
+
+  test_compare(wmerge, w, tol, "merge", n);
+
+  if (n > 1000)
+    {
+      /* the merged median is an estimate */
+      gsl_test_abs(gsl_rstat_median(wmerge), gsl_rstat_median(w), 2.0e-2,
+                   "merge median n=%zu shards=%zu", n, nshards);
+    }
+
+  gsl_rstat_free(w);
+  gsl_rstat_free(warray);
+  gsl_rstat_free(wmerge);
+  gsl_rstat_free(wshard);
+}
+
+/* weighted and exponentially decaying statistics, compared with
+   gsl_stats_w* on the equivalent weights */
+void
+test_weighted(const size_t n, const double data[], const double tol)
+{
+  gsl_rstat_workspace *w = gsl_rstat_alloc();
+  double *wts = malloc(n * sizeof(double));
+  const double lambda = 0.999;
+  size_t i;
+
+  for (i = 0; i < n; ++i)
+    {
+      wts[i] = 1.0 + (i % 5);
+      gsl_rstat_wadd(data[i], wts[i], w);
+    }
+
+  gsl_test_rel(gsl_rstat_mean(w), gsl_stats_wmean(wts, 1, data, 1, n), tol,
+               "wadd mean n=%zu", n);
+  gsl_test_rel(gsl_rstat_variance(w), gsl_stats_wvariance(wts, 1, data, 1, n), tol,
+               "wadd variance n=%zu", n);
+  gsl_test_rel(gsl_rstat_skew(w), gsl_stats_wskew(wts, 1, data, 1, n), tol,
+               "wadd skew n=%zu", n);
+  gsl_test_rel(gsl_rstat_kurtosis(w), gsl_stats_wkurtosis(wts, 1, data, 1, n), tol,
+               "wadd kurtosis n=%zu", n);
+
+  gsl_rstat_reset(w);
+  gsl_rstat_set_decay(lambda, w);
+  gsl_rstat_add_array(data, 1, n, w);
+
+  for (i = 0; i < n; ++i)
+    wts[i] = pow(lambda, (double) (n - 1 - i));
+
+  gsl_test_rel(gsl_rstat_mean(w), gsl_stats_wmean(wts, 1, data, 1, n), tol,
+               "decay mean n=%zu", n);
+  gsl_test_rel(gsl_rstat_variance(w), gsl_stats_wvariance(wts, 1, data, 1, n), tol,
+               "decay variance n=%zu", n);
+  gsl_test_rel(gsl_rstat_skew(w), gsl_stats_wskew(wts, 1, data, 1, n), tol,
+               "decay skew n=%zu", n);
+  gsl_test_rel(gsl_rstat_kurtosis(w), gsl_stats_wkurtosis(wts, 1, data, 1, n), tol,
+               "decay kurtosis n=%zu", n);
+
+  free(wts);
+  gsl_rstat_free(w);
+}
+
+/* fraction of the sorted data less than or equal to x */
+double
+rank_fraction(const double x, const double sorted[], const size_t n)
+{
+  size_t lo = 0, hi = n;
+
+  while (lo < hi)
+    {
+      size_t mid = lo + (hi - lo) / 2;
+
+      if (sorted[mid] <= x)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+
+  return (double) lo / (double) n;
+}
+
+/* t-digest quantiles of data added directly, and through shards which
+   are merged and then written and read back, compared with the exact
+   quantiles in terms of rank */
+void
+test_tdigest(const size_t n, const size_t nshards, const double data[],
+             const double delta, const double tol)
+{
+  const double p[] = { 0.0, 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0 };
+  const size_t np = sizeof(p) / sizeof(p[0]);
+  gsl_rstat_tdigest_workspace *w = gsl_rstat_tdigest_alloc(delta);
+  gsl_rstat_tdigest_workspace *wmerge = gsl_rstat_tdigest_alloc(delta);
+  gsl_rstat_tdigest_workspace *wshard = gsl_rstat_tdigest_alloc(delta);
+  gsl_rstat_tdigest_workspace *wread = gsl_rstat_tdigest_alloc(delta);
+  double *sorted = malloc(n * sizeof(double));
+  FILE *f = tmpfile();
+  size_t i, k;
+
+  memcpy(sorted, data, n * sizeof(double));
+  gsl_sort(sorted, 1, n);
+
+  for (i = 0; i < n; ++i)
+    gsl_rstat_tdigest_add(data[i], w);
+
+  for (k = 0; k < nshards; ++k)
+    {
+      const size_t lo = n * k / nshards, hi = n * (k + 1) / nshards;
+
+      gsl_rstat_tdigest_reset(wshard);
+
+      for (i = lo; i < hi; ++i)
+        gsl_rstat_tdigest_add(data[i], wshard);
+
+      gsl_rstat_tdigest_merge(wmerge, wshard);
+    }
+
+  gsl_rstat_tdigest_fwrite(f, wmerge);
+  rewind(f);
+  gsl_rstat_tdigest_fread(f, wread);
+  fclose(f);
+
+  gsl_test_int(gsl_rstat_tdigest_n(wmerge), n, "tdigest merge n=%zu", n);
+  gsl_test_int(gsl_rstat_tdigest_n(wread), n, "tdigest fread n=%zu", n);
+
+  for (i = 0; i < np; ++i)
+    {
+      const double expected = gsl_stats_quantile_from_sorted_data(sorted, 1, n, p[i]);
+      const double q = gsl_rstat_tdigest_quantile(p[i], w);
+      const double qmerge = gsl_rstat_tdigest_quantile(p[i], wmerge);
+      const double qread = gsl_rstat_tdigest_quantile(p[i], wread);
+
+      if (n <= 10 || p[i] == 0.0 || p[i] == 1.0)
+        {
+          /* exact for a few points and at the ends */
+          gsl_test_rel(q, expected, 1.0e-12, "tdigest n=%zu p=%g", n, p[i]);
+          gsl_test_rel(qmerge, expected, 1.0e-12, "tdigest merge n=%zu p=%g", n, p[i]);
+        }
+      else
+        {
+          /* the tolerance is on the rank, and is tighter in the tails */
+          const double t = tol * 4.0 * sqrt(p[i] * (1.0 - p[i]));
+
+          gsl_test_abs(rank_fraction(q, sorted, n), p[i], t,
+                       "tdigest n=%zu p=%g", n, p[i]);
+          gsl_test_abs(rank_fraction(qmerge, sorted, n), p[i], t,
+                       "tdigest merge n=%zu shards=%zu p=%g", n, nshards, p[i]);
+        }
+
+      gsl_test_abs(qread, qmerge, 0.0, "tdigest fread n=%zu p=%g", n, p[i]);
+    }
+
+  free(sorted);
+  gsl_rstat_tdigest_free(w);
+  gsl_rstat_tdigest_free(wmerge);
+  gsl_rstat_tdigest_free(wshard);
+  gsl_rstat_tdigest_free(wread);
+}
+
 int
 main()
 {
@@ -144,6 +345,20 @@ main()
 
     test_basic(5, data2, tol1);
 
+    test_merge(3, 2, data, tol1);
+    test_merge(1000, 7, data, tol1);
+    test_merge(100000, 16, data, tol1);
+    test_merge(5, 1, data2, tol1);
+
+    test_weighted(1000, data, tol1);
+    test_weighted(10000, data, tol1);
+
+    test_tdigest(1, 1, data, 100.0, 0.0);
+    test_tdigest(10, 3, data, 100.0, 0.0);
+    test_tdigest(100000, 16, data, 100.0, 5.0e-3);
+    test_tdigest(2000000, 200, data, 100.0, 5.0e-3);
+    test_tdigest(2000000, 200, data, 1000.0, 5.0e-4);
+
     free(data);
   }
 
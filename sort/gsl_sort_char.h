@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_char (char * data, const size_t stride, const size_t n);
 void gsl_sort2_char (char * data1, const size_t stride1, char * data2, const size_t stride2, const size_t n);
 void gsl_sort_char_index (size_t * p, const char * data, const size_t stride, const size_t n);
+int gsl_sort_char_radix (char * data, const size_t stride, const size_t n);
+
+void gsl_sort_char_merge (char * dest, const size_t stride, const char * data1, const size_t stride1, const size_t n1, const char * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_char_merge_split (const size_t k, const char * data1, const size_t stride1, const size_t n1, const char * data2, const size_t stride2, const size_t n2);
+void gsl_sort_char_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const char * data, const size_t stride);
+size_t gsl_sort_char_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const char * data, const size_t stride);
 
 int gsl_sort_char_smallest (char * dest, const size_t k, const char * src, const size_t stride, const size_t n);
 int gsl_sort_char_smallest_index (size_t * p, const size_t k, const char * src, const size_t stride, const size_t n);
@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort (double * data, const size_t stride, const size_t n);
 void gsl_sort2 (double * data1, const size_t stride1, double * data2, const size_t stride2, const size_t n);
 void gsl_sort_index (size_t * p, const double * data, const size_t stride, const size_t n);
+int gsl_sort_radix (double * data, const size_t stride, const size_t n);
+
+void gsl_sort_merge (double * dest, const size_t stride, const double * data1, const size_t stride1, const size_t n1, const double * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_merge_split (const size_t k, const double * data1, const size_t stride1, const size_t n1, const double * data2, const size_t stride2, const size_t n2);
+void gsl_sort_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const double * data, const size_t stride);
+size_t gsl_sort_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const double * data, const size_t stride);
 
 int gsl_sort_smallest (double * dest, const size_t k, const double * src, const size_t stride, const size_t n);
 int gsl_sort_smallest_index (size_t * p, const size_t k, const double * src, const size_t stride, const size_t n);
@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_float (float * data, const size_t stride, const size_t n);
 void gsl_sort2_float (float * data1, const size_t stride1, float * data2, const size_t stride2, const size_t n);
 void gsl_sort_float_index (size_t * p, const float * data, const size_t stride, const size_t n);
+int gsl_sort_float_radix (float * data, const size_t stride, const size_t n);
+
+void gsl_sort_float_merge (float * dest, const size_t stride, const float * data1, const size_t stride1, const size_t n1, const float * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_float_merge_split (const size_t k, const float * data1, const size_t stride1, const size_t n1, const float * data2, const size_t stride2, const size_t n2);
+void gsl_sort_float_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const float * data, const size_t stride);
+size_t gsl_sort_float_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const float * data, const size_t stride);
 
 int gsl_sort_float_smallest (float * dest, const size_t k, const float * src, const size_t stride, const size_t n);
 int gsl_sort_float_smallest_index (size_t * p, const size_t k, const float * src, const size_t stride, const size_t n);
@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_int (int * data, const size_t stride, const size_t n);
 void gsl_sort2_int (int * data1, const size_t stride1, int * data2, const size_t stride2, const size_t n);
 void gsl_sort_int_index (size_t * p, const int * data, const size_t stride, const size_t n);
+int gsl_sort_int_radix (int * data, const size_t stride, const size_t n);
+
+void gsl_sort_int_merge (int * dest, const size_t stride, const int * data1, const size_t stride1, const size_t n1, const int * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_int_merge_split (const size_t k, const int * data1, const size_t stride1, const size_t n1, const int * data2, const size_t stride2, const size_t n2);
+void gsl_sort_int_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const int * data, const size_t stride);
+size_t gsl_sort_int_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const int * data, const size_t stride);
 
 int gsl_sort_int_smallest (int * dest, const size_t k, const int * src, const size_t stride, const size_t n);
 int gsl_sort_int_smallest_index (size_t * p, const size_t k, const int * src, const size_t stride, const size_t n);
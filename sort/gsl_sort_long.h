@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_long (long * data, const size_t stride, const size_t n);
 void gsl_sort2_long (long * data1, const size_t stride1, long * data2, const size_t stride2, const size_t n);
 void gsl_sort_long_index (size_t * p, const long * data, const size_t stride, const size_t n);
+int gsl_sort_long_radix (long * data, const size_t stride, const size_t n);
+
+void gsl_sort_long_merge (long * dest, const size_t stride, const long * data1, const size_t stride1, const size_t n1, const long * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_long_merge_split (const size_t k, const long * data1, const size_t stride1, const size_t n1, const long * data2, const size_t stride2, const size_t n2);
+void gsl_sort_long_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const long * data, const size_t stride);
+size_t gsl_sort_long_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const long * data, const size_t stride);
 
 int gsl_sort_long_smallest (long * dest, const size_t k, const long * src, const size_t stride, const size_t n);
 int gsl_sort_long_smallest_index (size_t * p, const size_t k, const long * src, const size_t stride, const size_t n);
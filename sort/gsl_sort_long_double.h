@@ -40,6 +40,11 @@ void gsl_sort_long_double (long double * data, const size_t stride, const size_t
 void gsl_sort2_long_double (long double * data1, const size_t stride1, long double * data2, const size_t stride2, const size_t n);
 void gsl_sort_long_double_index (size_t * p, const long double * data, const size_t stride, const size_t n);
 
+void gsl_sort_long_double_merge (long double * dest, const size_t stride, const long double * data1, const size_t stride1, const size_t n1, const long double * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_long_double_merge_split (const size_t k, const long double * data1, const size_t stride1, const size_t n1, const long double * data2, const size_t stride2, const size_t n2);
+void gsl_sort_long_double_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const long double * data, const size_t stride);
+size_t gsl_sort_long_double_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const long double * data, const size_t stride);
+
 int gsl_sort_long_double_smallest (long double * dest, const size_t k, const long double * src, const size_t stride, const size_t n);
 int gsl_sort_long_double_smallest_index (size_t * p, const size_t k, const long double * src, const size_t stride, const size_t n);
 
@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_short (short * data, const size_t stride, const size_t n);
 void gsl_sort2_short (short * data1, const size_t stride1, short * data2, const size_t stride2, const size_t n);
 void gsl_sort_short_index (size_t * p, const short * data, const size_t stride, const size_t n);
+int gsl_sort_short_radix (short * data, const size_t stride, const size_t n);
+
+void gsl_sort_short_merge (short * dest, const size_t stride, const short * data1, const size_t stride1, const size_t n1, const short * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_short_merge_split (const size_t k, const short * data1, const size_t stride1, const size_t n1, const short * data2, const size_t stride2, const size_t n2);
+void gsl_sort_short_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const short * data, const size_t stride);
+size_t gsl_sort_short_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const short * data, const size_t stride);
 
 int gsl_sort_short_smallest (short * dest, const size_t k, const short * src, const size_t stride, const size_t n);
 int gsl_sort_short_smallest_index (size_t * p, const size_t k, const short * src, const size_t stride, const size_t n);
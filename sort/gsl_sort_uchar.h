@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_uchar (unsigned char * data, const size_t stride, const size_t n);
 void gsl_sort2_uchar (unsigned char * data1, const size_t stride1, unsigned char * data2, const size_t stride2, const size_t n);
 void gsl_sort_uchar_index (size_t * p, const unsigned char * data, const size_t stride, const size_t n);
+int gsl_sort_uchar_radix (unsigned char * data, const size_t stride, const size_t n);
+
+void gsl_sort_uchar_merge (unsigned char * dest, const size_t stride, const unsigned char * data1, const size_t stride1, const size_t n1, const unsigned char * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_uchar_merge_split (const size_t k, const unsigned char * data1, const size_t stride1, const size_t n1, const unsigned char * data2, const size_t stride2, const size_t n2);
+void gsl_sort_uchar_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const unsigned char * data, const size_t stride);
+size_t gsl_sort_uchar_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const unsigned char * data, const size_t stride);
 
 int gsl_sort_uchar_smallest (unsigned char * dest, const size_t k, const unsigned char * src, const size_t stride, const size_t n);
 int gsl_sort_uchar_smallest_index (size_t * p, const size_t k, const unsigned char * src, const size_t stride, const size_t n);
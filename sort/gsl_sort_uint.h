@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_uint (unsigned int * data, const size_t stride, const size_t n);
 void gsl_sort2_uint (unsigned int * data1, const size_t stride1, unsigned int * data2, const size_t stride2, const size_t n);
 void gsl_sort_uint_index (size_t * p, const unsigned int * data, const size_t stride, const size_t n);
+int gsl_sort_uint_radix (unsigned int * data, const size_t stride, const size_t n);
+
+void gsl_sort_uint_merge (unsigned int * dest, const size_t stride, const unsigned int * data1, const size_t stride1, const size_t n1, const unsigned int * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_uint_merge_split (const size_t k, const unsigned int * data1, const size_t stride1, const size_t n1, const unsigned int * data2, const size_t stride2, const size_t n2);
+void gsl_sort_uint_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const unsigned int * data, const size_t stride);
+size_t gsl_sort_uint_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const unsigned int * data, const size_t stride);
 
 int gsl_sort_uint_smallest (unsigned int * dest, const size_t k, const unsigned int * src, const size_t stride, const size_t n);
 int gsl_sort_uint_smallest_index (size_t * p, const size_t k, const unsigned int * src, const size_t stride, const size_t n);
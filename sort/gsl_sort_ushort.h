@@ -39,6 +39,12 @@ __BEGIN_DECLS
 void gsl_sort_ushort (unsigned short * data, const size_t stride, const size_t n);
 void gsl_sort2_ushort (unsigned short * data1, const size_t stride1, unsigned short * data2, const size_t stride2, const size_t n);
 void gsl_sort_ushort_index (size_t * p, const unsigned short * data, const size_t stride, const size_t n);
+int gsl_sort_ushort_radix (unsigned short * data, const size_t stride, const size_t n);
+
+void gsl_sort_ushort_merge (unsigned short * dest, const size_t stride, const unsigned short * data1, const size_t stride1, const size_t n1, const unsigned short * data2, const size_t stride2, const size_t n2);
+size_t gsl_sort_ushort_merge_split (const size_t k, const unsigned short * data1, const size_t stride1, const size_t n1, const unsigned short * data2, const size_t stride2, const size_t n2);
+void gsl_sort_ushort_index_merge (size_t * p, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const unsigned short * data, const size_t stride);
+size_t gsl_sort_ushort_index_merge_split (const size_t k, const size_t * p1, const size_t n1, const size_t * p2, const size_t n2, const unsigned short * data, const size_t stride);
 
 int gsl_sort_ushort_smallest (unsigned short * dest, const size_t k, const unsigned short * src, const size_t stride, const size_t n);
 int gsl_sort_ushort_smallest_index (size_t * p, const size_t k, const unsigned short * src, const size_t stride, const size_t n);
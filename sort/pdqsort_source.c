@@ -0,0 +1,431 @@
+/* sort/pdqsort_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Pattern-defeating quicksort, following O. R. L. Peters,
+   "Pattern-defeating quicksort", arXiv:2106.05123 (2021).
+
+   This is an introsort: quicksort with a median-of-3 pivot (ninther
+   for large ranges), insertion sort for short ranges and heapsort
+   when too many unbalanced partitions have been seen, so that the
+   worst case is O(n log n).  In addition
+
+     - elements equal to the pivot of the previous partition are put
+       into a partition of their own, which makes arrays with many
+       duplicates O(n k) for k distinct values,
+     - a partition which needed no swaps is checked with a bounded
+       insertion sort, which makes sorted and nearly sorted input O(n),
+     - after an unbalanced partition some elements are swapped to break
+       up patterns which defeat the pivot selection.
+
+   The ranges still to be sorted are kept on an explicit stack, with
+   the larger range pushed, so the stack depth is at most log2(n).
+
+   The comparisons need not be consistent (e.g. with NaNs), in which
+   case the order of the result is unspecified but the sort still
+   terminates.
+
+   This file is a template, included with the following macros
+   defined; they are undefined at the end.
+
+     PDQ(name)        name of a function in this instantiation
+     PDQ_PARAMS       parameters describing the array(s)
+     PDQ_ARGS         the same as arguments
+     PDQ_VAR(t)       declare a temporary element t, whose key is t
+     PDQ_GET(t,i)     t = element i
+     PDQ_PUT(i,t)     element i = t
+     PDQ_COPY(j,i)    element j = element i
+     PDQ_SWAP(i,j)    exchange elements i and j
+     PDQ_AT(i)        key of element i
+     PDQ_LT(x,y)      key x is less than key y
+*/
+
+#ifndef PDQ_INSERTION_THRESHOLD
+#define PDQ_INSERTION_THRESHOLD 24      /* insertion sort below this */
+#define PDQ_NINTHER_THRESHOLD 128       /* ninther pivot above this */
+#define PDQ_PARTIAL_INSERTION_LIMIT 8   /* moves in a partial sort */
+#define PDQ_STACK_SIZE 64
+#endif
+
+static inline void
+PDQ (sort2) (PDQ_PARAMS, size_t i, size_t j)
+{
+  if (PDQ_LT (PDQ_AT (j), PDQ_AT (i)))
+    {
+      PDQ_SWAP (i, j);
+    }
+}
+
+static inline void
+PDQ (sort3) (PDQ_PARAMS, size_t i, size_t j, size_t k)
+{
+  PDQ (sort2) (PDQ_ARGS, i, j);
+  PDQ (sort2) (PDQ_ARGS, j, k);
+  PDQ (sort2) (PDQ_ARGS, i, j);
+}
+
+/* sort [lo,hi) by insertion */
+static void
+PDQ (insertion) (PDQ_PARAMS, size_t lo, size_t hi)
+{
+  size_t i, j;
+
+  for (i = lo + 1; i < hi; i++)
+    {
+      if (PDQ_LT (PDQ_AT (i), PDQ_AT (i - 1)))
+        {
+          PDQ_VAR (t);
+
+          PDQ_GET (t, i);
+          j = i;
+
+          do
+            {
+              PDQ_COPY (j, j - 1);
+              j--;
+            }
+          while (j > lo && PDQ_LT (t, PDQ_AT (j - 1)));
+
+          PDQ_PUT (j, t);
+        }
+    }
+}
+
+/* Attempt to sort [lo,hi) by insertion, giving up after a few moves.
+   Returns 1 if the range is sorted. */
+static int
+PDQ (partial_insertion) (PDQ_PARAMS, size_t lo, size_t hi)
+{
+  size_t i, j, moves = 0;
+
+  for (i = lo + 1; i < hi; i++)
+    {
+      if (PDQ_LT (PDQ_AT (i), PDQ_AT (i - 1)))
+        {
+          PDQ_VAR (t);
+
+          PDQ_GET (t, i);
+          j = i;
+
+          do
+            {
+              PDQ_COPY (j, j - 1);
+              j--;
+            }
+          while (j > lo && PDQ_LT (t, PDQ_AT (j - 1)));
+
+          PDQ_PUT (j, t);
+          moves += i - j;
+
+          if (moves > PDQ_PARTIAL_INSERTION_LIMIT)
+            return 0;
+        }
+    }
+
+  return 1;
+}
+
+static void
+PDQ (siftdown) (PDQ_PARAMS, size_t lo, size_t n, size_t k)
+{
+  while (2 * k + 1 < n)
+    {
+      size_t j = 2 * k + 1;
+
+      if (j + 1 < n && PDQ_LT (PDQ_AT (lo + j), PDQ_AT (lo + j + 1)))
+        j++;
+
+      if (!PDQ_LT (PDQ_AT (lo + k), PDQ_AT (lo + j)))
+        break;
+
+      PDQ_SWAP (lo + k, lo + j);
+      k = j;
+    }
+}
+
+/* heapsort of [lo,hi), the fallback which bounds the worst case */
+static void
+PDQ (heapsort) (PDQ_PARAMS, size_t lo, size_t hi)
+{
+  const size_t n = hi - lo;
+  size_t k;
+
+  for (k = n / 2; k-- > 0;)
+    PDQ (siftdown) (PDQ_ARGS, lo, n, k);
+
+  for (k = n; k-- > 1;)
+    {
+      PDQ_SWAP (lo, lo + k);
+      PDQ (siftdown) (PDQ_ARGS, lo, k, 0);
+    }
+}
+
+/* Partition [lo,hi) around the pivot in element lo, with the elements
+   equal to the pivot on the right.  Returns the final position of the
+   pivot, and sets *done if no elements were exchanged. */
+static size_t
+PDQ (partition_right) (PDQ_PARAMS, size_t lo, size_t hi, int *done)
+{
+  size_t first = lo, last = hi, pos;
+  PDQ_VAR (pivot);
+
+  PDQ_GET (pivot, lo);
+
+  do
+    first++;
+  while (first < hi && PDQ_LT (PDQ_AT (first), pivot));
+
+  if (first == lo + 1)
+    {
+      while (first < last && !PDQ_LT (PDQ_AT (last - 1), pivot))
+        last--;
+    }
+  else
+    {
+      while (!PDQ_LT (PDQ_AT (last - 1), pivot))
+        last--;
+    }
+
+  *done = (first >= last);
+
+  /* [lo+1,first) < pivot, [last,hi) >= pivot, and the scans below stop
+     at the elements just exchanged */
+  while (first < last)
+    {
+      PDQ_SWAP (first, last - 1);
+
+      do
+        first++;
+      while (PDQ_LT (PDQ_AT (first), pivot));
+
+      do
+        last--;
+      while (!PDQ_LT (PDQ_AT (last - 1), pivot));
+    }
+
+  pos = first - 1;
+  PDQ_COPY (lo, pos);
+  PDQ_PUT (pos, pivot);
+
+  return pos;
+}
+
+/* Partition [lo,hi) around the pivot in element lo, with the elements
+   equal to the pivot on the left.  Used when the pivot equals the
+   element before lo, which is not greater than any element of the
+   range, so that the left part needs no further sorting. */
+static size_t
+PDQ (partition_left) (PDQ_PARAMS, size_t lo, size_t hi)
+{
+  size_t first = lo, last = hi;
+  PDQ_VAR (pivot);
+
+  PDQ_GET (pivot, lo);
+
+  /* stops at lo at the latest, since the pivot is not less than
+     itself */
+  do
+    last--;
+  while (PDQ_LT (pivot, PDQ_AT (last)));
+
+  if (last + 1 == hi)
+    {
+      while (first < last && !PDQ_LT (pivot, PDQ_AT (first + 1)))
+        first++;
+      first++;
+    }
+  else
+    {
+      do
+        first++;
+      while (!PDQ_LT (pivot, PDQ_AT (first)));
+    }
+
+  while (first < last)
+    {
+      PDQ_SWAP (first, last);
+
+      do
+        last--;
+      while (PDQ_LT (pivot, PDQ_AT (last)));
+
+      do
+        first++;
+      while (!PDQ_LT (pivot, PDQ_AT (first)));
+    }
+
+  PDQ_COPY (lo, last);
+  PDQ_PUT (last, pivot);
+
+  return last;
+}
+
+static void
+PDQ (sort) (PDQ_PARAMS, size_t n)
+{
+  size_t stack_lo[PDQ_STACK_SIZE], stack_hi[PDQ_STACK_SIZE];
+  int stack_bad[PDQ_STACK_SIZE], stack_leftmost[PDQ_STACK_SIZE];
+  size_t top = 0, m;
+  int bad = 0;
+
+  /* allow log2(n) unbalanced partitions before switching to heapsort */
+  for (m = n; m > 1; m >>= 1)
+    bad++;
+
+  stack_lo[0] = 0;
+  stack_hi[0] = n;
+  stack_bad[0] = bad;
+  stack_leftmost[0] = 1;
+  top = 1;
+
+  while (top > 0)
+    {
+      size_t lo, hi;
+      int leftmost;
+
+      top--;
+      lo = stack_lo[top];
+      hi = stack_hi[top];
+      bad = stack_bad[top];
+      leftmost = stack_leftmost[top];
+
+      for (;;)
+        {
+          const size_t size = hi - lo;
+          size_t s2, mid, l_size, r_size;
+          int done;
+
+          if (size < PDQ_INSERTION_THRESHOLD)
+            {
+              PDQ (insertion) (PDQ_ARGS, lo, hi);
+              break;
+            }
+
+          /* move the pivot to lo */
+          s2 = size / 2;
+
+          if (size > PDQ_NINTHER_THRESHOLD)
+            {
+              PDQ (sort3) (PDQ_ARGS, lo, lo + s2, hi - 1);
+              PDQ (sort3) (PDQ_ARGS, lo + 1, lo + s2 - 1, hi - 2);
+              PDQ (sort3) (PDQ_ARGS, lo + 2, lo + s2 + 1, hi - 3);
+              PDQ (sort3) (PDQ_ARGS, lo + s2 - 1, lo + s2, lo + s2 + 1);
+              PDQ_SWAP (lo, lo + s2);
+            }
+          else
+            {
+              PDQ (sort3) (PDQ_ARGS, lo + s2, lo, hi - 1);
+            }
+
+          /* If the pivot equals the element before the range, which is
+             the pivot of an earlier partition, then so do all elements
+             not greater than it and they can be skipped. */
+          if (!leftmost && !PDQ_LT (PDQ_AT (lo - 1), PDQ_AT (lo)))
+            {
+              lo = PDQ (partition_left) (PDQ_ARGS, lo, hi) + 1;
+              continue;
+            }
+
+          mid = PDQ (partition_right) (PDQ_ARGS, lo, hi, &done);
+
+          l_size = mid - lo;
+          r_size = hi - (mid + 1);
+
+          if (l_size < size / 8 || r_size < size / 8)
+            {
+              if (--bad == 0)
+                {
+                  PDQ (heapsort) (PDQ_ARGS, lo, hi);
+                  break;
+                }
+
+              if (l_size >= PDQ_INSERTION_THRESHOLD)
+                {
+                  const size_t q = l_size / 4;
+
+                  PDQ_SWAP (lo, lo + q);
+                  PDQ_SWAP (mid - 1, mid - q);
+
+                  if (l_size > PDQ_NINTHER_THRESHOLD)
+                    {
+                      PDQ_SWAP (lo + 1, lo + q + 1);
+                      PDQ_SWAP (lo + 2, lo + q + 2);
+                      PDQ_SWAP (mid - 2, mid - q - 1);
+                      PDQ_SWAP (mid - 3, mid - q - 2);
+                    }
+                }
+
+              if (r_size >= PDQ_INSERTION_THRESHOLD)
+                {
+                  const size_t q = r_size / 4;
+
+                  PDQ_SWAP (mid + 1, mid + 1 + q);
+                  PDQ_SWAP (hi - 1, hi - q);
+
+                  if (r_size > PDQ_NINTHER_THRESHOLD)
+                    {
+                      PDQ_SWAP (mid + 2, mid + 2 + q);
+                      PDQ_SWAP (mid + 3, mid + 3 + q);
+                      PDQ_SWAP (hi - 2, hi - q - 1);
+                      PDQ_SWAP (hi - 3, hi - q - 2);
+                    }
+                }
+            }
+          else if (done
+                   && PDQ (partial_insertion) (PDQ_ARGS, lo, mid)
+                   && PDQ (partial_insertion) (PDQ_ARGS, mid + 1, hi))
+            {
+              break;
+            }
+
+          /* push the larger part and continue with the smaller */
+          if (l_size > r_size)
+            {
+              stack_lo[top] = lo;
+              stack_hi[top] = mid;
+              stack_bad[top] = bad;
+              stack_leftmost[top] = leftmost;
+              top++;
+
+              lo = mid + 1;
+              leftmost = 0;
+            }
+          else
+            {
+              stack_lo[top] = mid + 1;
+              stack_hi[top] = hi;
+              stack_bad[top] = bad;
+              stack_leftmost[top] = 0;
+              top++;
+
+              hi = mid;
+            }
+        }
+    }
+}
+
+#undef PDQ
+#undef PDQ_PARAMS
+#undef PDQ_ARGS
+#undef PDQ_VAR
+#undef PDQ_GET
+#undef PDQ_PUT
+#undef PDQ_COPY
+#undef PDQ_SWAP
+#undef PDQ_AT
+#undef PDQ_LT
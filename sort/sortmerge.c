@@ -0,0 +1,106 @@
+/* sort/sortmerge.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Merging of sorted arrays and indices, for sorting large arrays in
+   parallel.
+
+   The library does not create threads itself.  Instead the caller
+   sorts blocks of the array independently, e.g. in separate threads
+   with gsl_sort or gsl_sort_index, and combines them with the functions
+   here.  The merge of two blocks can itself be divided between threads:
+   gsl_sort_merge_split finds, by binary search, how many elements of
+   each input make up the first k elements of the output, so that each
+   thread can merge its own part of the output independently.
+
+   The merges are stable, taking equal elements from the first input
+   first.  The index merges use the same order as gsl_sort_index (by
+   value, then by position), so that merging the indices of sorted
+   blocks gives exactly the result of gsl_sort_index on the whole
+   array. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_sort.h>
+
+#define BASE_LONG_DOUBLE
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG_DOUBLE
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+#define BASE_ULONG
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_ULONG
+
+#define BASE_LONG
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG
+
+#define BASE_UINT
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_UINT
+
+#define BASE_INT
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_INT
+
+#define BASE_USHORT
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_USHORT
+
+#define BASE_SHORT
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_SHORT
+
+#define BASE_UCHAR
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_UCHAR
+
+#define BASE_CHAR
+#include "templates_on.h"
+#include "sortmerge_source.c"
+#include "templates_off.h"
+#undef  BASE_CHAR
@@ -0,0 +1,116 @@
+/* sort/sortmerge_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* index order used by gsl_sort_index: by value, then by position */
+#define INDEX_LT(x,y) (data[(x) * stride] < data[(y) * stride] \
+                       || (!(data[(y) * stride] < data[(x) * stride]) && (x) < (y)))
+
+void
+FUNCTION (gsl_sort, merge) (BASE * dest, const size_t stride,
+                            const BASE * data1, const size_t stride1, const size_t n1,
+                            const BASE * data2, const size_t stride2, const size_t n2)
+{
+  size_t i = 0, j = 0, k = 0;
+
+  while (i < n1 && j < n2)
+    {
+      /* equal elements are taken from data1 first */
+      if (data2[j * stride2] < data1[i * stride1])
+        dest[(k++) * stride] = data2[(j++) * stride2];
+      else
+        dest[(k++) * stride] = data1[(i++) * stride1];
+    }
+
+  while (i < n1)
+    dest[(k++) * stride] = data1[(i++) * stride1];
+
+  while (j < n2)
+    dest[(k++) * stride] = data2[(j++) * stride2];
+}
+
+size_t
+FUNCTION (gsl_sort, merge_split) (const size_t k,
+                                  const BASE * data1, const size_t stride1, const size_t n1,
+                                  const BASE * data2, const size_t stride2, const size_t n2)
+{
+  size_t lo = (k > n2) ? k - n2 : 0;
+  size_t hi = (k < n1) ? k : n1;
+
+  /* find the number of elements of data1 among the first k elements of
+     the merged output, i.e. the first i such that data1[i] comes after
+     data2[k-i-1] */
+  while (lo < hi)
+    {
+      const size_t i = lo + (hi - lo) / 2;
+
+      if (data2[(k - i - 1) * stride2] < data1[i * stride1])
+        hi = i;
+      else
+        lo = i + 1;
+    }
+
+  return lo;
+}
+
+void
+FUNCTION (gsl_sort, index_merge) (size_t * p,
+                                  const size_t * p1, const size_t n1,
+                                  const size_t * p2, const size_t n2,
+                                  const BASE * data, const size_t stride)
+{
+  size_t i = 0, j = 0, k = 0;
+
+  while (i < n1 && j < n2)
+    {
+      if (INDEX_LT (p2[j], p1[i]))
+        p[k++] = p2[j++];
+      else
+        p[k++] = p1[i++];
+    }
+
+  while (i < n1)
+    p[k++] = p1[i++];
+
+  while (j < n2)
+    p[k++] = p2[j++];
+}
+
+size_t
+FUNCTION (gsl_sort, index_merge_split) (const size_t k,
+                                        const size_t * p1, const size_t n1,
+                                        const size_t * p2, const size_t n2,
+                                        const BASE * data, const size_t stride)
+{
+  size_t lo = (k > n2) ? k - n2 : 0;
+  size_t hi = (k < n1) ? k : n1;
+
+  while (lo < hi)
+    {
+      const size_t i = lo + (hi - lo) / 2;
+
+      if (INDEX_LT (p2[k - i - 1], p1[i]))
+        hi = i;
+      else
+        lo = i + 1;
+    }
+
+  return lo;
+}
+
+#undef INDEX_LT
@@ -0,0 +1,109 @@
+/* sort/sortradix.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* LSD radix sort of integer and IEEE floating point arrays.
+
+   The keys are sorted one byte at a time, from the least significant
+   byte, with a counting sort into a buffer of n elements.  The counts
+   for all the bytes are found in a single pass over the data, and
+   passes in which every element has the same byte are skipped, so
+   small integers in a wide type cost only the passes they need.  The
+   time is O(n sizeof(BASE)), independent of the order of the input.
+
+   Floating point numbers are sorted by their bit patterns, which is
+   the numerical order except that -0 comes before +0 and NaNs with
+   the sign bit set or clear come first or last respectively.  It is
+   assumed that floating point numbers have the same byte order as
+   integers, as on all current platforms.  There is no radix sort for
+   long double, whose format varies between platforms. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_vector.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_sort_vector.h>
+
+static inline int
+radix_little_endian (void)
+{
+  const unsigned int one = 1;
+
+  return *(const unsigned char *) &one == 1;
+}
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+#define BASE_ULONG
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_ULONG
+
+#define BASE_LONG
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG
+
+#define BASE_UINT
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_UINT
+
+#define BASE_INT
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_INT
+
+#define BASE_USHORT
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_USHORT
+
+#define BASE_SHORT
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_SHORT
+
+#define BASE_UCHAR
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_UCHAR
+
+#define BASE_CHAR
+#include "templates_on.h"
+#include "sortradix_source.c"
+#include "templates_off.h"
+#undef  BASE_CHAR
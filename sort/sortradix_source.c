@@ -0,0 +1,147 @@
+/* sort/sortradix_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#if !defined(BASE_DOUBLE) && !defined(BASE_FLOAT)
+/* 1 if BASE is a signed type, since char may be either */
+static inline int
+FUNCTION (radix, is_signed) (void)
+{
+  const BASE zero = 0;
+
+  return (BASE) (zero - 1) < zero;
+}
+#endif
+
+/* Byte-wise digit of an element for pass b, counting from the least
+   significant byte, transformed so that the unsigned order of the
+   digits is the numerical order of the elements.  For signed integers
+   the sign bit is inverted.  For IEEE floating point numbers the sign
+   bit is inverted for positive numbers and all bits are inverted for
+   negative numbers. */
+
+static inline unsigned int
+FUNCTION (radix, digit) (const BASE * x, const size_t b, const int little)
+{
+  const unsigned char *c = (const unsigned char *) x;
+  const size_t last = sizeof (BASE) - 1;
+  unsigned int d = c[little ? b : last - b];
+
+#if defined(BASE_DOUBLE) || defined(BASE_FLOAT)
+  if (c[little ? last : 0] & 0x80)
+    d ^= 0xff;
+  else if (b == last)
+    d ^= 0x80;
+#else
+  if (b == last && FUNCTION (radix, is_signed) ())
+    d ^= 0x80;
+#endif
+
+  return d;
+}
+
+int
+FUNCTION (gsl_sort, radix) (BASE * data, const size_t stride, const size_t n)
+{
+  const size_t nbytes = sizeof (BASE);
+  const int little = radix_little_endian ();
+  size_t count[sizeof (BASE)][256];
+  BASE *tmp, *src = data, *dst;
+  size_t src_stride = stride, dst_stride = 1;
+  size_t b, i;
+
+  if (n < 2)
+    {
+      return GSL_SUCCESS;
+    }
+
+  tmp = (BASE *) malloc (n * sizeof (BASE));
+
+  if (tmp == 0)
+    {
+      GSL_ERROR ("failed to allocate space for buffer", GSL_ENOMEM);
+    }
+
+  dst = tmp;
+
+  /* histograms of all the digits in a single pass */
+
+  for (b = 0; b < nbytes; b++)
+    {
+      for (i = 0; i < 256; i++)
+        count[b][i] = 0;
+    }
+
+  for (i = 0; i < n; i++)
+    {
+      for (b = 0; b < nbytes; b++)
+        count[b][FUNCTION (radix, digit) (&data[i * stride], b, little)]++;
+    }
+
+  for (b = 0; b < nbytes; b++)
+    {
+      size_t *c = count[b];
+      size_t sum = 0, d;
+
+      /* skip the pass if every element has the same digit */
+      if (c[FUNCTION (radix, digit) (&data[0], b, little)] == n)
+        continue;
+
+      for (d = 0; d < 256; d++)
+        {
+          const size_t t = c[d];
+          c[d] = sum;
+          sum += t;
+        }
+
+      for (i = 0; i < n; i++)
+        {
+          const BASE x = src[i * src_stride];
+          const size_t pos = c[FUNCTION (radix, digit) (&x, b, little)]++;
+
+          dst[pos * dst_stride] = x;
+        }
+
+      /* exchange the roles of the arrays */
+      {
+        BASE *t = src;
+        size_t ts = src_stride;
+
+        src = dst;
+        src_stride = dst_stride;
+        dst = t;
+        dst_stride = ts;
+      }
+    }
+
+  if (src != data)
+    {
+      for (i = 0; i < n; i++)
+        data[i * stride] = src[i];
+    }
+
+  free (tmp);
+
+  return GSL_SUCCESS;
+}
+
+int
+FUNCTION (gsl_sort_vector, radix) (TYPE (gsl_vector) * v)
+{
+  return FUNCTION (gsl_sort, radix) (v->data, v->stride, v->size);
+}
@@ -1,8 +1,8 @@
 /*
- * Implement Heap sort -- direct and indirect sorting
- * Based on descriptions in Sedgewick "Algorithms in C"
+ * Direct sorting of typed arrays
  *
  * Copyright (C) 1999  Thomas Walter
+ * Copyright (C) 2026 The GSL Team
  *
  * 18 February 2000: Modified for GSL by Brian Gough
  *
@@ -17,103 +17,55 @@
  * for more details.
  */
 
-static inline void FUNCTION (my, downheap) (BASE * data, const size_t stride, const size_t N, size_t k);
-static inline void FUNCTION (my, downheap2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t N, size_t k);
-
-static inline void
-FUNCTION (my, downheap) (BASE * data, const size_t stride, const size_t N, size_t k)
-{
-  BASE v = data[k * stride];
-
-  while (k <= N / 2)
-    {
-      size_t j = 2 * k;
-
-      if (j < N && data[j * stride] < data[(j + 1) * stride])
-        {
-          j++;
-        }
-
-      if (!(v < data[j * stride]))  /* avoid infinite loop if nan */
-        {
-          break;
-        }
-
-      data[k * stride] = data[j * stride];
-
-      k = j;
-    }
-
-  data[k * stride] = v;
-}
-
-static inline void
-FUNCTION (my, downheap2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t N, size_t k)
-{
-  BASE v1 = data1[k * stride1];
-  BASE v2 = data2[k * stride2];
-
-  while (k <= N / 2)
-    {
-      size_t j = 2 * k;
-
-      if (j < N && data1[j * stride1] < data1[(j + 1) * stride1])
-        {
-          j++;
-        }
-
-      if (!(v1 < data1[j * stride1]))  /* avoid infinite loop if nan */
-        {
-          break;
-        }
-
-      data1[k * stride1] = data1[j * stride1];
-      data2[k * stride2] = data2[j * stride2];
-
-      k = j;
-    }
-
-  data1[k * stride1] = v1;
-  data2[k * stride2] = v2;
-}
+/* gsl_sort and gsl_sort2 use the pattern-defeating quicksort in
+   pdqsort_source.c.  Contiguous data (stride 1) is handled by a
+   separate instantiation so that the compiler can drop the stride
+   multiplications from the inner loops. */
+
+#define PDQ(name) FUNCTION (pdq, name)
+#define PDQ_PARAMS BASE * data
+#define PDQ_ARGS data
+#define PDQ_VAR(t) BASE t
+#define PDQ_GET(t,i) (t) = data[i]
+#define PDQ_PUT(i,t) data[i] = (t)
+#define PDQ_COPY(j,i) data[j] = data[i]
+#define PDQ_SWAP(i,j) do { BASE tmp_ = data[i]; data[i] = data[j]; data[j] = tmp_; } while (0)
+#define PDQ_AT(i) data[i]
+#define PDQ_LT(x,y) ((x) < (y))
+#include "pdqsort_source.c"
+
+#define PDQ(name) FUNCTION (pdq_stride, name)
+#define PDQ_PARAMS BASE * data, const size_t stride
+#define PDQ_ARGS data, stride
+#define PDQ_VAR(t) BASE t
+#define PDQ_GET(t,i) (t) = data[(i) * stride]
+#define PDQ_PUT(i,t) data[(i) * stride] = (t)
+#define PDQ_COPY(j,i) data[(j) * stride] = data[(i) * stride]
+#define PDQ_SWAP(i,j) do { BASE tmp_ = data[(i) * stride]; data[(i) * stride] = data[(j) * stride]; data[(j) * stride] = tmp_; } while (0)
+#define PDQ_AT(i) data[(i) * stride]
+#define PDQ_LT(x,y) ((x) < (y))
+#include "pdqsort_source.c"
+
+#define PDQ(name) FUNCTION (pdq2, name)
+#define PDQ_PARAMS BASE * data1, const size_t stride1, BASE * data2, const size_t stride2
+#define PDQ_ARGS data1, stride1, data2, stride2
+#define PDQ_VAR(t) BASE t, t##_2
+#define PDQ_GET(t,i) do { (t) = data1[(i) * stride1]; t##_2 = data2[(i) * stride2]; } while (0)
+#define PDQ_PUT(i,t) do { data1[(i) * stride1] = (t); data2[(i) * stride2] = t##_2; } while (0)
+#define PDQ_COPY(j,i) do { data1[(j) * stride1] = data1[(i) * stride1]; data2[(j) * stride2] = data2[(i) * stride2]; } while (0)
+#define PDQ_SWAP(i,j) do { BASE tmp_ = data1[(i) * stride1]; data1[(i) * stride1] = data1[(j) * stride1]; data1[(j) * stride1] = tmp_; \
+    tmp_ = data2[(i) * stride2]; data2[(i) * stride2] = data2[(j) * stride2]; data2[(j) * stride2] = tmp_; } while (0)
+#define PDQ_AT(i) data1[(i) * stride1]
+#define PDQ_LT(x,y) ((x) < (y))
+#include "pdqsort_source.c"
 
 void
 TYPE (gsl_sort) (BASE * data, const size_t stride, const size_t n)
 {
-  size_t N;
-  size_t k;
-
-  if (n == 0)
-    {
-      return;                   /* No data to sort */
-    }
-
-  /* We have n_data elements, last element is at 'n_data-1', first at
-     '0' Set N to the last element number. */
-
-  N = n - 1;
-
-  k = N / 2;
-  k++;                          /* Compensate the first use of 'k--' */
-  do
-    {
-      k--;
-      FUNCTION (my, downheap) (data, stride, N, k);
-    }
-  while (k > 0);
-
-  while (N > 0)
-    {
-      /* first swap the elements */
-      BASE tmp = data[0 * stride];
-      data[0 * stride] = data[N * stride];
-      data[N * stride] = tmp;
-
-      /* then process the heap */
-      N--;
-
-      FUNCTION (my, downheap) (data, stride, N, 0);
-    }
+  if (stride == 1)
+    FUNCTION (pdq, sort) (data, n);
+  else
+    FUNCTION (pdq_stride, sort) (data, stride, n);
 }
 
 void
@@ -125,46 +77,7 @@ TYPE (gsl_sort_vector) (TYPE (gsl_vector) * v)
 void
 TYPE (gsl_sort2) (BASE * data1, const size_t stride1, BASE * data2, const size_t stride2, const size_t n)
 {
-  size_t N;
-  size_t k;
-
-  if (n == 0)
-    {
-      return;                   /* No data to sort */
-    }
-
-  /* We have n_data elements, last element is at 'n_data-1', first at
-     '0' Set N to the last element number. */
-
-  N = n - 1;
-
-  k = N / 2;
-  k++;                          /* Compensate the first use of 'k--' */
-  do
-    {
-      k--;
-      FUNCTION (my, downheap2) (data1, stride1, data2, stride2, N, k);
-    }
-  while (k > 0);
-
-  while (N > 0)
-    {
-      /* first swap the elements */
-      BASE tmp;
-      
-      tmp = data1[0 * stride1];
-      data1[0 * stride1] = data1[N * stride1];
-      data1[N * stride1] = tmp;
-
-      tmp = data2[0 * stride2];
-      data2[0 * stride2] = data2[N * stride2];
-      data2[N * stride2] = tmp;
-
-      /* then process the heap */
-      N--;
-
-      FUNCTION (my, downheap2) (data1, stride1, data2, stride2, N, 0);
-    }
+  FUNCTION (pdq2, sort) (data1, stride1, data2, stride2, n);
 }
 
 void
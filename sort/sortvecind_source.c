@@ -1,8 +1,8 @@
 /*
- * Implement Heap sort -- direct and indirect sorting
- * Based on descriptions in Sedgewick "Algorithms in C"
+ * Indirect sorting of typed arrays
  *
  * Copyright (C) 1999  Thomas Walter
+ * Copyright (C) 2026 The GSL Team
  *
  * 18 February 2000: Modified for GSL by Brian Gough
  *
@@ -17,45 +17,29 @@
  * for more details.
  */
 
-static inline void FUNCTION (index, downheap) (size_t * p, const BASE * data, const size_t stride, const size_t N, size_t k);
-
-static inline void
-FUNCTION (index, downheap) (size_t * p, const BASE * data, const size_t stride, const size_t N, size_t k)
-{
-  const size_t pki = p[k];
-
-  while (k <= N / 2)
-    {
-      size_t j = 2 * k;
-
-      if (j < N && data[p[j] * stride] < data[p[j + 1] * stride])
-        {
-          j++;
-        }
-
-      if (!(data[pki * stride] < data[p[j] * stride])) /* avoid infinite loop if nan */
-        {
-          break;
-        }
-
-      p[k] = p[j];
-
-      k = j;
-    }
-
-  p[k] = pki;
-}
+/* The index is sorted with the pattern-defeating quicksort in
+   pdqsort_source.c, comparing the data and then the original
+   positions.  This is a total order, so the sort gives the same
+   result as a stable sort: equal elements keep their original order
+   in the index. */
+
+#define PDQ(name) FUNCTION (pdq_index, name)
+#define PDQ_PARAMS size_t * p, const BASE * data, const size_t stride
+#define PDQ_ARGS p, data, stride
+#define PDQ_VAR(t) size_t t
+#define PDQ_GET(t,i) (t) = p[i]
+#define PDQ_PUT(i,t) p[i] = (t)
+#define PDQ_COPY(j,i) p[j] = p[i]
+#define PDQ_SWAP(i,j) do { size_t tmp_ = p[i]; p[i] = p[j]; p[j] = tmp_; } while (0)
+#define PDQ_AT(i) p[i]
+#define PDQ_LT(x,y) (data[(x) * stride] < data[(y) * stride] \
+                     || (!(data[(y) * stride] < data[(x) * stride]) && (x) < (y)))
+#include "pdqsort_source.c"
 
 void
 FUNCTION (gsl_sort, index) (size_t * p, const BASE * data, const size_t stride, const size_t n)
 {
-  size_t N;
-  size_t i, k;
-
-  if (n == 0)
-    {
-      return;   /* No data to sort */
-    }
+  size_t i;
 
   /* set permutation to identity */
 
@@ -64,32 +48,7 @@ FUNCTION (gsl_sort, index) (size_t * p, const BASE * data, const size_t stride,
       p[i] = i ;
     }
 
-  /* We have n_data elements, last element is at 'n_data-1', first at
-     '0' Set N to the last element number. */
-
-  N = n - 1;
-
-  k = N / 2;
-  k++;                          /* Compensate the first use of 'k--' */
-  do
-    {
-      k--;
-      FUNCTION (index, downheap) (p, data, stride, N, k);
-    }
-  while (k > 0);
-
-  while (N > 0)
-    {
-      /* first swap the elements */
-      size_t tmp = p[0];
-      p[0] = p[N];
-      p[N] = tmp;
-
-      /* then process the heap */
-      N--;
-
-      FUNCTION (index, downheap) (p, data, stride, N, 0);
-    }
+  FUNCTION (pdq_index, sort) (p, data, stride, n);
 }
 
 int
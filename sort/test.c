@@ -20,6 +20,7 @@
 #include <config.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <gsl/gsl_math.h>
 #include <gsl/gsl_errno.h>
 #include <gsl/gsl_test.h>
@@ -29,6 +30,8 @@
 #include <gsl/gsl_ieee_utils.h>
 
 size_t urand (size_t);
+void test_sort_patterns (size_t n);
+void test_sort_nan (size_t n);
 
 #include "test_heapsort.c"
 
@@ -98,6 +101,161 @@ size_t urand (size_t);
 #include "templates_off.h"
 #undef  BASE_CHAR
 
+/* Compare gsl_sort, gsl_sort_radix, gsl_sort_index and gsl_sort2 on
+   inputs with patterns which are hard for quicksort */
+
+void
+test_sort_patterns (size_t n)
+{
+  const char *desc[] = { "random", "sorted", "reversed", "organ pipe",
+    "equal", "sawtooth", "few values", "nearly sorted", "signed"
+  };
+  const size_t npattern = sizeof (desc) / sizeof (desc[0]);
+  double *x = (double *) malloc (n * sizeof (double));
+  double *a = (double *) malloc (n * sizeof (double));
+  double *b = (double *) malloc (n * sizeof (double));
+  double *c = (double *) malloc (n * sizeof (double));
+  size_t *p = (size_t *) malloc (n * sizeof (size_t));
+  size_t k, i;
+
+  for (k = 0; k < npattern; k++)
+    {
+      int status = 0, status_radix = 0, status_index = 0, status2 = 0;
+
+      for (i = 0; i < n; i++)
+        {
+          switch (k)
+            {
+            case 0: x[i] = urand (n); break;
+            case 1: x[i] = i; break;
+            case 2: x[i] = n - i; break;
+            case 3: x[i] = (i < n / 2) ? i : n - i; break;
+            case 4: x[i] = 1.0; break;
+            case 5: x[i] = i % 64; break;
+            case 6: x[i] = urand (4); break;
+            case 7: x[i] = i; break;
+            case 8: x[i] = ((double) urand (n) - n / 2.0) / 7.0; break;
+            }
+        }
+
+      if (k == 7)
+        {
+          for (i = 0; i < 10; i++)
+            {
+              size_t j1 = urand (n), j2 = urand (n);
+              double tmp = x[j1];
+              x[j1] = x[j2];
+              x[j2] = tmp;
+            }
+        }
+      else if (k == 8 && n > 4)
+        {
+          x[0] = -0.0;
+          x[1] = 0.0;
+          x[2] = GSL_NEGINF;
+          x[3] = GSL_POSINF;
+        }
+
+      memcpy (a, x, n * sizeof (double));
+      gsl_sort (a, 1, n);
+
+      for (i = 1; i < n; i++)
+        {
+          if (a[i] < a[i - 1])
+            status = GSL_FAILURE;
+        }
+
+      gsl_test (status, "sorting, n = %u, %s", n, desc[k]);
+
+      memcpy (b, x, n * sizeof (double));
+      status_radix = gsl_sort_radix (b, 1, n);
+
+      for (i = 0; i < n; i++)
+        {
+          if (b[i] != a[i])
+            status_radix = GSL_FAILURE;
+        }
+
+      gsl_test (status_radix, "radix sorting, n = %u, %s", n, desc[k]);
+
+      gsl_sort_index (p, x, 1, n);
+
+      for (i = 0; i < n; i++)
+        {
+          if (x[p[i]] != a[i] || (i > 0 && a[i] == a[i - 1] && p[i] < p[i - 1]))
+            status_index = GSL_FAILURE;
+        }
+
+      gsl_test (status_index, "indexing, n = %u, %s", n, desc[k]);
+
+      memcpy (b, x, n * sizeof (double));
+
+      for (i = 0; i < n; i++)
+        c[i] = i;
+
+      gsl_sort2 (b, 1, c, 1, n);
+
+      for (i = 0; i < n; i++)
+        {
+          if (b[i] != a[i] || x[(size_t) c[i]] != b[i])
+            status2 = GSL_FAILURE;
+        }
+
+      gsl_test (status2, "sorting2, n = %u, %s", n, desc[k]);
+    }
+
+  free (x);
+  free (a);
+  free (b);
+  free (c);
+  free (p);
+}
+
+/* With NaNs the order is unspecified, but the sorts must terminate and
+   return a permutation of the data */
+
+void
+test_sort_nan (size_t n)
+{
+  double *a = (double *) malloc (n * sizeof (double));
+  size_t *p = (size_t *) malloc (n * sizeof (size_t));
+  size_t i, nnan = 0, nnan_sorted = 0;
+  double sum = 0.0, sum_sorted = 0.0;
+  int status = 0;
+
+  for (i = 0; i < n; i++)
+    {
+      if (urand (4) == 0)
+        {
+          a[i] = GSL_NAN;
+          nnan++;
+        }
+      else
+        {
+          a[i] = urand (n);
+          sum += a[i];
+        }
+    }
+
+  gsl_sort_index (p, a, 1, n);
+  gsl_sort (a, 1, n);
+
+  for (i = 0; i < n; i++)
+    {
+      if (gsl_isnan (a[i]))
+        nnan_sorted++;
+      else
+        sum_sorted += a[i];
+    }
+
+  status = (nnan_sorted != nnan || sum_sorted != sum);
+
+  gsl_test (status, "sorting, n = %u, with NaNs", n);
+
+  free (a);
+  free (p);
+}
+
 int
 main (void)
 {
@@ -110,6 +268,13 @@ main (void)
   for (i = 1; i < 1024; i = (i < 32) ? i + 1 : 2 * i)
     test_heapsort (i);
 
+  for (i = 1; i < 1024; i = (i < 32) ? i + 1 : 2 * i)
+    {
+      test_heapsort_records (i, 12);
+      test_heapsort_records (i, 24);
+      test_heapsort_records (i, 27);
+    }
+
   for (i = 1; i < 1024; i = (i < 32) ? i + 1 : 2 * i)
     {
       for (s = 1; s < 4; s++)
@@ -125,9 +290,38 @@ main (void)
           test_sort_vector_short (i, s);
           test_sort_vector_uchar (i, s);
           test_sort_vector_char (i, s);
+
+          test_sort_index_stable (i, s);
+          test_sort_index_stable_float (i, s);
+          test_sort_index_stable_long_double (i, s);
+          test_sort_index_stable_ulong (i, s);
+          test_sort_index_stable_long (i, s);
+          test_sort_index_stable_uint (i, s);
+          test_sort_index_stable_int (i, s);
+          test_sort_index_stable_ushort (i, s);
+          test_sort_index_stable_short (i, s);
+          test_sort_index_stable_uchar (i, s);
+          test_sort_index_stable_char (i, s);
+
+          test_sort_merge (i, s);
+          test_sort_merge_float (i, s);
+          test_sort_merge_long_double (i, s);
+          test_sort_merge_ulong (i, s);
+          test_sort_merge_long (i, s);
+          test_sort_merge_uint (i, s);
+          test_sort_merge_int (i, s);
+          test_sort_merge_ushort (i, s);
+          test_sort_merge_short (i, s);
+          test_sort_merge_uchar (i, s);
+          test_sort_merge_char (i, s);
         }
     }
 
+  test_sort_patterns (1000);
+  test_sort_patterns (100000);
+  test_sort_nan (1000);
+  test_sort_nan (100000);
+
   exit (gsl_test_summary ());
 }
 
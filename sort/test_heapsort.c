@@ -18,7 +18,9 @@
  */
 
 int cmp_dbl (const void *a, const void *b);
+int cmp_record (const void *a, const void *b);
 void test_heapsort (size_t N);
+void test_heapsort_records (size_t N, size_t size);
 void initialize (double *data, size_t N);
 void cpy (double *dest, double *src, size_t N);
 void randomize (double *data, size_t n);
@@ -82,6 +84,52 @@ test_heapsort (size_t N)
   free (p);
 }
 
+/* Sort records of arbitrary size, with an int key at the start and
+   the rest filled with a pattern derived from the key, to check that
+   whole records are moved. */
+
+void
+test_heapsort_records (size_t N, size_t size)
+{
+  int status = 0;
+  unsigned char *data = (unsigned char *) malloc (N * size);
+  size_t i, j;
+
+  for (i = 0; i < N; i++)
+    {
+      const int key = (int) urand (N);
+      unsigned char *rec = data + i * size;
+
+      memcpy (rec, &key, sizeof (int));
+
+      for (j = sizeof (int); j < size; j++)
+        rec[j] = (unsigned char) (key + j);
+    }
+
+  gsl_heapsort (data, N, size, (gsl_comparison_fn_t) & cmp_record);
+
+  for (i = 0; i < N; i++)
+    {
+      const unsigned char *rec = data + i * size;
+      int key;
+
+      memcpy (&key, rec, sizeof (int));
+
+      if (i > 0 && cmp_record (rec - size, rec) > 0)
+        status = GSL_FAILURE;
+
+      for (j = sizeof (int); j < size; j++)
+        {
+          if (rec[j] != (unsigned char) (key + j))
+            status = GSL_FAILURE;
+        }
+    }
+
+  gsl_test (status, "sorting, records of %u bytes, n = %u, randomized", size, N);
+
+  free (data);
+}
+
 void
 initialize (double *data, size_t N)
 {
@@ -181,3 +229,14 @@ cmp_dbl (const void *a, const void *b)
   else
     return -1;
 }
+
+int
+cmp_record (const void *a, const void *b)
+{
+  int x, y;
+
+  memcpy (&x, a, sizeof (int));
+  memcpy (&y, b, sizeof (int));
+
+  return (x > y) - (x < y);
+}
@@ -18,6 +18,8 @@
  */
 
 void TYPE (test_sort_vector) (size_t N, size_t stride);
+void TYPE (test_sort_index_stable) (size_t N, size_t stride);
+void TYPE (test_sort_merge) (size_t N, size_t stride);
 void FUNCTION (my, initialize) (TYPE (gsl_vector) * v);
 void FUNCTION (my, randomize) (TYPE (gsl_vector) * v);
 int FUNCTION (my, check) (TYPE (gsl_vector) * data, TYPE (gsl_vector) * orig);
@@ -91,6 +93,15 @@ TYPE (test_sort_vector) (size_t N, size_t stride)
   status = FUNCTION (my, check) (data, orig);
   gsl_test (status, "sorting, " NAME (gsl_vector) ", n = %u, stride = %u, reversed", N, stride);
 
+#ifndef BASE_LONG_DOUBLE
+  FUNCTION (gsl_vector, memcpy) (data, orig);
+  FUNCTION (gsl_vector, reverse) (data);
+
+  status = FUNCTION (gsl_sort_vector, radix) (data);
+  status |= FUNCTION (my, check) (data, orig);
+  gsl_test (status, "radix sorting, " NAME (gsl_vector) ", n = %u, stride = %u, reversed", N, stride);
+#endif
+
   FUNCTION (gsl_vector, memcpy) (data, orig);
   FUNCTION (gsl_vector, reverse) (data);
   FUNCTION (gsl_vector, memcpy) (data2, data);
@@ -146,6 +157,14 @@ TYPE (test_sort_vector) (size_t N, size_t stride)
 
   FUNCTION (gsl_vector, memcpy) (data, data2);
 
+#ifndef BASE_LONG_DOUBLE
+  status = FUNCTION (gsl_sort_vector, radix) (data);
+  status |= FUNCTION (my, check) (data, orig);
+  gsl_test (status, "radix sorting, " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
+
+  FUNCTION (gsl_vector, memcpy) (data, data2);
+#endif
+
   FUNCTION (gsl_sort_vector, smallest) (small, k, data);
   status = FUNCTION (my, scheck) (small, k, orig);
   gsl_test (status, "smallest, " NAME (gsl_vector) ", n = %u, stride = %u, randomized", N, stride);
@@ -174,6 +193,150 @@ TYPE (test_sort_vector) (size_t N, size_t stride)
   free (index);
 }
 
+/* gsl_sort_index with many equal elements, which must keep their
+   original order in the index */
+
+void
+TYPE (test_sort_index_stable) (size_t N, size_t stride)
+{
+  int status = 0;
+  size_t i;
+
+  TYPE (gsl_block) * b = FUNCTION (gsl_block, calloc) (N * stride);
+  TYPE (gsl_vector) * v = FUNCTION (gsl_vector, alloc_from_block) (b, 0, N, stride);
+  size_t * p = (size_t *) malloc (N * sizeof (size_t));
+
+  for (i = 0; i < N; i++)
+    {
+      FUNCTION (gsl_vector, set) (v, i, (ATOMIC) urand (5));
+    }
+
+  FUNCTION (gsl_sort, index) (p, v->data, v->stride, N);
+
+  for (i = 1; i < N; i++)
+    {
+      const BASE x = FUNCTION (gsl_vector, get) (v, p[i - 1]);
+      const BASE y = FUNCTION (gsl_vector, get) (v, p[i]);
+
+      if (y < x || (x == y && p[i] < p[i - 1]))
+        status = GSL_FAILURE;
+    }
+
+  gsl_test (status, "indexing " NAME (gsl_vector) ", n = %u, stride = %u, stable with duplicates", N, stride);
+
+  FUNCTION (gsl_vector, free) (v);
+  FUNCTION (gsl_block, free) (b);
+  free (p);
+}
+
+/* Sort two blocks of a vector separately and merge them, in one step
+   and in two parts divided with the split functions, as when sorting
+   in parallel */
+
+void
+TYPE (test_sort_merge) (size_t N, size_t stride)
+{
+  const size_t n1 = N / 3, n2 = N - n1;
+  int status = 0, status_split = 0, status_index = 0, status_isplit = 0;
+  size_t i, k;
+
+  TYPE (gsl_block) * b1 = FUNCTION (gsl_block, calloc) (N * stride);
+  TYPE (gsl_block) * b2 = FUNCTION (gsl_block, calloc) (N * stride);
+  TYPE (gsl_vector) * orig = FUNCTION (gsl_vector, alloc_from_block) (b1, 0, N, stride);
+  TYPE (gsl_vector) * data = FUNCTION (gsl_vector, alloc_from_block) (b2, 0, N, stride);
+  BASE * dest = (BASE *) malloc (N * sizeof (BASE));
+  size_t * p = (size_t *) malloc (N * sizeof (size_t));
+  size_t * q = (size_t *) malloc (N * sizeof (size_t));
+  size_t * r = (size_t *) malloc (N * sizeof (size_t));
+
+  BASE * data1 = data->data;
+  BASE * data2 = data->data + n1 * stride;
+
+  for (i = 0; i < N; i++)
+    {
+      FUNCTION (gsl_vector, set) (orig, i, (ATOMIC) urand (N / 2 + 1));
+    }
+
+  FUNCTION (gsl_vector, memcpy) (data, orig);
+
+  /* index of the whole array, and of each block */
+
+  FUNCTION (gsl_sort, index) (r, orig->data, stride, N);
+  FUNCTION (gsl_sort, index) (p, data1, stride, n1);
+  FUNCTION (gsl_sort, index) (p + n1, data2, stride, n2);
+
+  for (i = n1; i < N; i++)
+    p[i] += n1;
+
+  FUNCTION (gsl_sort, index_merge) (q, p, n1, p + n1, n2, data->data, stride);
+
+  for (i = 0; i < N; i++)
+    {
+      if (q[i] != r[i])
+        status_index = GSL_FAILURE;
+    }
+
+  gsl_test (status_index, "index merge, " NAME (gsl_vector) ", n = %u, stride = %u", N, stride);
+
+  for (k = 0; k <= N; k += (N / 7 + 1))
+    {
+      const size_t j = FUNCTION (gsl_sort, index_merge_split) (k, p, n1, p + n1, n2, data->data, stride);
+
+      FUNCTION (gsl_sort, index_merge) (q, p, j, p + n1, k - j, data->data, stride);
+      FUNCTION (gsl_sort, index_merge) (q + k, p + j, n1 - j, p + n1 + (k - j), n2 - (k - j), data->data, stride);
+
+      for (i = 0; i < N; i++)
+        {
+          if (q[i] != r[i])
+            status_isplit = GSL_FAILURE;
+        }
+    }
+
+  gsl_test (status_isplit, "index merge split, " NAME (gsl_vector) ", n = %u, stride = %u", N, stride);
+
+  /* direct sort of each block */
+
+  TYPE (gsl_sort) (data1, stride, n1);
+  TYPE (gsl_sort) (data2, stride, n2);
+  TYPE (gsl_sort_vector) (orig);
+
+  FUNCTION (gsl_sort, merge) (dest, 1, data1, stride, n1, data2, stride, n2);
+
+  for (i = 0; i < N; i++)
+    {
+      if (dest[i] != FUNCTION (gsl_vector, get) (orig, i))
+        status = GSL_FAILURE;
+    }
+
+  gsl_test (status, "merge, " NAME (gsl_vector) ", n = %u, stride = %u", N, stride);
+
+  for (k = 0; k <= N; k += (N / 7 + 1))
+    {
+      const size_t j = FUNCTION (gsl_sort, merge_split) (k, data1, stride, n1, data2, stride, n2);
+
+      FUNCTION (gsl_sort, merge) (dest, 1, data1, stride, j, data2, stride, k - j);
+      FUNCTION (gsl_sort, merge) (dest + k, 1, data1 + j * stride, stride, n1 - j,
+                                  data2 + (k - j) * stride, stride, n2 - (k - j));
+
+      for (i = 0; i < N; i++)
+        {
+          if (dest[i] != FUNCTION (gsl_vector, get) (orig, i))
+            status_split = GSL_FAILURE;
+        }
+    }
+
+  gsl_test (status_split, "merge split, " NAME (gsl_vector) ", n = %u, stride = %u", N, stride);
+
+  FUNCTION (gsl_vector, free) (orig);
+  FUNCTION (gsl_vector, free) (data);
+  FUNCTION (gsl_block, free) (b1);
+  FUNCTION (gsl_block, free) (b2);
+  free (dest);
+  free (p);
+  free (q);
+  free (r);
+}
+
 
 void
 FUNCTION (my, initialize) (TYPE (gsl_vector) * v)
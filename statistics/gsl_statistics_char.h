@@ -75,6 +75,13 @@ void gsl_stats_char_minmax_index (size_t * min_index, size_t * max_index, const
 double gsl_stats_char_median_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_char_quantile_from_sorted_data (const char sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+char gsl_stats_char_select (char data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_char_median (char data[], const size_t stride, const size_t n) ;
+double gsl_stats_char_quantile (char data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_char_quantiles (double q[], const double f[], const size_t m, char data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_char_summary (double * mean, double * variance, double * skew, double * kurtosis, char * min, char * max, const char data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_CHAR_H__ */
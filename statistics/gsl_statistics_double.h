@@ -95,6 +95,14 @@ void gsl_stats_minmax_index (size_t * min_index, size_t * max_index, const doubl
 double gsl_stats_median_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_quantile_from_sorted_data (const double sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+double gsl_stats_select (double data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_median (double data[], const size_t stride, const size_t n) ;
+double gsl_stats_quantile (double data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_quantiles (double q[], const double f[], const size_t m, double data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_summary (double * mean, double * variance, double * skew, double * kurtosis, double * min, double * max, const double data[], const size_t stride, const size_t n);
+int gsl_stats_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, double * min, double * max, const double w[], const size_t wstride, const double data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_DOUBLE_H__ */
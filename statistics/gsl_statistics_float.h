@@ -95,6 +95,14 @@ void gsl_stats_float_minmax_index (size_t * min_index, size_t * max_index, const
 double gsl_stats_float_median_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_float_quantile_from_sorted_data (const float sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+float gsl_stats_float_select (float data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_float_median (float data[], const size_t stride, const size_t n) ;
+double gsl_stats_float_quantile (float data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_float_quantiles (double q[], const double f[], const size_t m, float data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_float_summary (double * mean, double * variance, double * skew, double * kurtosis, float * min, float * max, const float data[], const size_t stride, const size_t n);
+int gsl_stats_float_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, float * min, float * max, const float w[], const size_t wstride, const float data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_FLOAT_H__ */
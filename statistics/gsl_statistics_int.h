@@ -75,6 +75,13 @@ void gsl_stats_int_minmax_index (size_t * min_index, size_t * max_index, const i
 double gsl_stats_int_median_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_int_quantile_from_sorted_data (const int sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+int gsl_stats_int_select (int data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_int_median (int data[], const size_t stride, const size_t n) ;
+double gsl_stats_int_quantile (int data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_int_quantiles (double q[], const double f[], const size_t m, int data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_int_summary (double * mean, double * variance, double * skew, double * kurtosis, int * min, int * max, const int data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_INT_H__ */
@@ -75,6 +75,13 @@ void gsl_stats_long_minmax_index (size_t * min_index, size_t * max_index, const
 double gsl_stats_long_median_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_quantile_from_sorted_data (const long sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+long gsl_stats_long_select (long data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_long_median (long data[], const size_t stride, const size_t n) ;
+double gsl_stats_long_quantile (long data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_quantiles (double q[], const double f[], const size_t m, long data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_long_summary (double * mean, double * variance, double * skew, double * kurtosis, long * min, long * max, const long data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_LONG_H__ */
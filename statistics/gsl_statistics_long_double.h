@@ -95,6 +95,14 @@ void gsl_stats_long_double_minmax_index (size_t * min_index, size_t * max_index,
 double gsl_stats_long_double_median_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_long_double_quantile_from_sorted_data (const long double sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+long double gsl_stats_long_double_select (long double data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_long_double_median (long double data[], const size_t stride, const size_t n) ;
+double gsl_stats_long_double_quantile (long double data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_long_double_quantiles (double q[], const double f[], const size_t m, long double data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_long_double_summary (double * mean, double * variance, double * skew, double * kurtosis, long double * min, long double * max, const long double data[], const size_t stride, const size_t n);
+int gsl_stats_long_double_wsummary (double * wmean, double * wvariance, double * wskew, double * wkurtosis, long double * min, long double * max, const long double w[], const size_t wstride, const long double data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_LONG_DOUBLE_H__ */
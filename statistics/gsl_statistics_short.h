@@ -75,6 +75,13 @@ void gsl_stats_short_minmax_index (size_t * min_index, size_t * max_index, const
 double gsl_stats_short_median_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_short_quantile_from_sorted_data (const short sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+short gsl_stats_short_select (short data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_short_median (short data[], const size_t stride, const size_t n) ;
+double gsl_stats_short_quantile (short data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_short_quantiles (double q[], const double f[], const size_t m, short data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_short_summary (double * mean, double * variance, double * skew, double * kurtosis, short * min, short * max, const short data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_SHORT_H__ */
@@ -75,6 +75,13 @@ void gsl_stats_uchar_minmax_index (size_t * min_index, size_t * max_index, const
 double gsl_stats_uchar_median_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uchar_quantile_from_sorted_data (const unsigned char sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+unsigned char gsl_stats_uchar_select (unsigned char data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_uchar_median (unsigned char data[], const size_t stride, const size_t n) ;
+double gsl_stats_uchar_quantile (unsigned char data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uchar_quantiles (double q[], const double f[], const size_t m, unsigned char data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_uchar_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned char * min, unsigned char * max, const unsigned char data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_UCHAR_H__ */
@@ -75,6 +75,13 @@ void gsl_stats_uint_minmax_index (size_t * min_index, size_t * max_index, const
 double gsl_stats_uint_median_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_uint_quantile_from_sorted_data (const unsigned int sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+unsigned int gsl_stats_uint_select (unsigned int data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_uint_median (unsigned int data[], const size_t stride, const size_t n) ;
+double gsl_stats_uint_quantile (unsigned int data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_uint_quantiles (double q[], const double f[], const size_t m, unsigned int data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_uint_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned int * min, unsigned int * max, const unsigned int data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_UINT_H__ */
@@ -75,6 +75,13 @@ void gsl_stats_ulong_minmax_index (size_t * min_index, size_t * max_index, const
 double gsl_stats_ulong_median_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ulong_quantile_from_sorted_data (const unsigned long sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+unsigned long gsl_stats_ulong_select (unsigned long data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_ulong_median (unsigned long data[], const size_t stride, const size_t n) ;
+double gsl_stats_ulong_quantile (unsigned long data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ulong_quantiles (double q[], const double f[], const size_t m, unsigned long data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_ulong_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned long * min, unsigned long * max, const unsigned long data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_ULONG_H__ */
@@ -75,6 +75,13 @@ void gsl_stats_ushort_minmax_index (size_t * min_index, size_t * max_index, cons
 double gsl_stats_ushort_median_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n) ;
 double gsl_stats_ushort_quantile_from_sorted_data (const unsigned short sorted_data[], const size_t stride, const size_t n, const double f) ;
 
+unsigned short gsl_stats_ushort_select (unsigned short data[], const size_t stride, const size_t n, const size_t k) ;
+double gsl_stats_ushort_median (unsigned short data[], const size_t stride, const size_t n) ;
+double gsl_stats_ushort_quantile (unsigned short data[], const size_t stride, const size_t n, const double f) ;
+int gsl_stats_ushort_quantiles (double q[], const double f[], const size_t m, unsigned short data[], const size_t stride, const size_t n) ;
+
+int gsl_stats_ushort_summary (double * mean, double * variance, double * skew, double * kurtosis, unsigned short * min, unsigned short * max, const unsigned short data[], const size_t stride, const size_t n);
+
 __END_DECLS
 
 #endif /* __GSL_STATISTICS_USHORT_H__ */
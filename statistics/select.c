@@ -0,0 +1,113 @@
+/* statistics/select.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Selection of order statistics in expected linear time, for medians
+   and quantiles of unsorted data.
+
+   gsl_stats_select uses the algorithm of R. W. Floyd and R. L. Rivest,
+   "Algorithm 489: The algorithm SELECT -- for finding the ith smallest
+   of n elements", Comm. ACM 18, 173 (1975), which chooses each pivot
+   by a recursive selection from a small sample and needs about
+   n + min(k, n-k) comparisons on average.  As in introselect, if the
+   range fails to shrink too often the rest of it is sorted, so the
+   worst case is O(n log n).
+
+   gsl_stats_quantiles places all the ranks needed for several
+   quantiles by recursively selecting the middle rank and dividing the
+   ranks between the two sides, in O(n log m) time for m quantiles. */
+
+#include <config.h>
+#include <stdlib.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_sort.h>
+#include <gsl/gsl_statistics.h>
+
+#define SELECT_INSERTION_THRESHOLD 16
+#define SELECT_SAMPLE_THRESHOLD 600
+
+#define BASE_LONG_DOUBLE
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG_DOUBLE
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+#define BASE_ULONG
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_ULONG
+
+#define BASE_LONG
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG
+
+#define BASE_UINT
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_UINT
+
+#define BASE_INT
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_INT
+
+#define BASE_USHORT
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_USHORT
+
+#define BASE_SHORT
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_SHORT
+
+#define BASE_UCHAR
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_UCHAR
+
+#define BASE_CHAR
+#include "templates_on.h"
+#include "select_source.c"
+#include "templates_off.h"
+#undef  BASE_CHAR
+
+
+
@@ -0,0 +1,330 @@
+/* statistics/select_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+#define SWAP(i,j) do { const BASE tmp_ = data[(i) * stride]; \
+    data[(i) * stride] = data[(j) * stride]; data[(j) * stride] = tmp_; } while (0)
+#define AT(i) data[(i) * stride]
+
+static void
+FUNCTION (select, insertion) (BASE data[], const size_t stride,
+                              const size_t lo, const size_t hi)
+{
+  size_t i, j;
+
+  for (i = lo + 1; i <= hi; i++)
+    {
+      const BASE x = AT (i);
+
+      for (j = i; j > lo && x < AT (j - 1); j--)
+        AT (j) = AT (j - 1);
+
+      AT (j) = x;
+    }
+}
+
+/* Rearrange data[lo..hi] so that element k is in its sorted position,
+   with no larger elements before it and no smaller elements after it.
+   The pivot of each partition is chosen by selecting from a sample
+   (Floyd and Rivest), and if the range fails to shrink too often the
+   remaining elements are sorted, which bounds the worst case. */
+
+static void
+FUNCTION (select, range) (BASE data[], const size_t stride,
+                          size_t lo, size_t hi, const size_t k)
+{
+  size_t m;
+  int bad = 0;
+
+  for (m = hi - lo + 1; m > 1; m >>= 1)
+    bad++;
+
+  while (hi > lo + SELECT_INSERTION_THRESHOLD)
+    {
+      const size_t size = hi - lo + 1;
+      size_t i, j;
+      int pivot_left;
+      BASE t;
+
+      if (size > SELECT_SAMPLE_THRESHOLD)
+        {
+          /* select from a sample of about n^(2/3) elements around k,
+             chosen so that the k-th element of the range falls inside
+             it with high probability */
+          const double n = (double) size;
+          const double i0 = (double) (k - lo + 1);
+          const double z = log (n);
+          const double s = 0.5 * exp (2.0 * z / 3.0);
+          const double sd = 0.5 * sqrt (z * s * (n - s) / n)
+                                * ((i0 < n / 2) ? -1.0 : 1.0);
+          const double new_lo = k - i0 * s / n + sd;
+          const double new_hi = k + (n - i0) * s / n + sd;
+          const size_t sample_lo = (new_lo > lo) ? (size_t) new_lo : lo;
+          const size_t sample_hi = (new_hi < hi) ? (size_t) new_hi : hi;
+
+          if (sample_lo <= k && k <= sample_hi)
+            FUNCTION (select, range) (data, stride, sample_lo, sample_hi, k);
+        }
+
+      /* partition data[lo..hi] around t = data[k]; the pivot is moved to
+         one end so that every scan below stops at an element already
+         examined */
+      t = AT (k);
+      SWAP (lo, k);
+
+      /* t ends up at the left if the last element is larger,
+         otherwise at the right */
+      pivot_left = (t < AT (hi));
+
+      if (pivot_left)
+        SWAP (lo, hi);
+
+      i = lo;
+      j = hi;
+
+      while (i < j)
+        {
+          SWAP (i, j);
+
+          do
+            i++;
+          while (AT (i) < t);
+
+          do
+            j--;
+          while (t < AT (j));
+        }
+
+      if (pivot_left)
+        {
+          SWAP (lo, j);
+        }
+      else
+        {
+          j++;
+          SWAP (j, hi);
+        }
+
+      /* data[j] is now in its sorted position */
+      if (j == k)
+        return;
+
+      if (4 * (j < k ? hi - j : j - lo) > 3 * size && --bad == 0)
+        {
+          TYPE (gsl_sort) (data + lo * stride, stride, size);
+          return;
+        }
+
+      if (j < k)
+        lo = j + 1;
+      else
+        hi = j - 1;
+    }
+
+  FUNCTION (select, insertion) (data, stride, lo, hi);
+}
+
+/* place each of the sorted distinct ranks k[a..b) in its sorted
+   position within data[lo..hi] */
+static void
+FUNCTION (select, multi) (BASE data[], const size_t stride,
+                          const size_t lo, const size_t hi,
+                          const size_t k[], const size_t a, const size_t b)
+{
+  if (a < b)
+    {
+      const size_t mid = a + (b - a) / 2;
+
+      FUNCTION (select, range) (data, stride, lo, hi, k[mid]);
+
+      if (k[mid] > lo)
+        FUNCTION (select, multi) (data, stride, lo, k[mid] - 1, k, a, mid);
+
+      if (k[mid] < hi)
+        FUNCTION (select, multi) (data, stride, k[mid] + 1, hi, k, mid + 1, b);
+    }
+}
+
+/* smallest element of data[lo..n-1] */
+static BASE
+FUNCTION (select, min) (const BASE data[], const size_t stride,
+                        const size_t lo, const size_t n)
+{
+  BASE min = AT (lo);
+  size_t i;
+
+  for (i = lo + 1; i < n; i++)
+    {
+      if (AT (i) < min)
+        min = AT (i);
+    }
+
+  return min;
+}
+
+BASE
+FUNCTION (gsl_stats, select) (BASE data[], const size_t stride,
+                              const size_t n, const size_t k)
+{
+  if (k >= n)
+    {
+      GSL_ERROR_VAL ("k must be less than n", GSL_EINVAL, 0);
+    }
+
+  FUNCTION (select, range) (data, stride, 0, n - 1, k);
+
+  return AT (k);
+}
+
+double
+FUNCTION (gsl_stats, median) (BASE data[], const size_t stride,
+                              const size_t n)
+{
+  const size_t lhs = (n - 1) / 2;
+  const size_t rhs = n / 2;
+  double median;
+
+  if (n == 0)
+    return 0.0;
+
+  FUNCTION (select, range) (data, stride, 0, n - 1, lhs);
+  median = AT (lhs);
+
+  if (rhs != lhs)
+    {
+      /* the upper middle element is the least of those after lhs */
+      median = (median + FUNCTION (select, min) (data, stride, rhs, n)) / 2.0;
+    }
+
+  return median;
+}
+
+double
+FUNCTION (gsl_stats, quantile) (BASE data[], const size_t stride,
+                                const size_t n, const double f)
+{
+  double index, delta, result;
+  size_t lhs;
+
+  if (!(f >= 0.0 && f <= 1.0))
+    {
+      GSL_ERROR_VAL ("quantile fraction must lie in [0,1]", GSL_EDOM, GSL_NAN);
+    }
+
+  if (n == 0)
+    return 0.0;
+
+  index = f * (n - 1);
+  lhs = (size_t) index;
+  delta = index - lhs;
+
+  FUNCTION (select, range) (data, stride, 0, n - 1, lhs);
+  result = AT (lhs);
+
+  if (lhs < n - 1 && delta > 0)
+    {
+      const double next = FUNCTION (select, min) (data, stride, lhs + 1, n);
+      result = (1 - delta) * result + delta * next;
+    }
+
+  return result;
+}
+
+int
+FUNCTION (gsl_stats, quantiles) (double q[], const double f[], const size_t m,
+                                 BASE data[], const size_t stride,
+                                 const size_t n)
+{
+  size_t *k, nk = 0, i, j;
+
+  for (j = 0; j < m; j++)
+    {
+      if (!(f[j] >= 0.0 && f[j] <= 1.0))
+        {
+          GSL_ERROR ("quantile fractions must lie in [0,1]", GSL_EDOM);
+        }
+    }
+
+  if (m == 0)
+    {
+      return GSL_SUCCESS;
+    }
+  else if (n == 0)
+    {
+      for (j = 0; j < m; j++)
+        q[j] = 0.0;
+
+      return GSL_SUCCESS;
+    }
+
+  k = (size_t *) malloc (2 * m * sizeof (size_t));
+
+  if (k == 0)
+    {
+      GSL_ERROR ("failed to allocate space for ranks", GSL_ENOMEM);
+    }
+
+  /* ranks required by the interpolation of each quantile */
+  for (j = 0; j < m; j++)
+    {
+      const size_t lhs = (size_t) (f[j] * (n - 1));
+
+      k[nk++] = lhs;
+
+      if (lhs < n - 1)
+        k[nk++] = lhs + 1;
+    }
+
+  /* sort the ranks and remove duplicates */
+  for (i = 1; i < nk; i++)
+    {
+      const size_t x = k[i];
+
+      for (j = i; j > 0 && x < k[j - 1]; j--)
+        k[j] = k[j - 1];
+
+      k[j] = x;
+    }
+
+  for (i = 0, j = 0; i < nk; i++)
+    {
+      if (j == 0 || k[i] != k[j - 1])
+        k[j++] = k[i];
+    }
+
+  FUNCTION (select, multi) (data, stride, 0, n - 1, k, 0, j);
+
+  free (k);
+
+  for (j = 0; j < m; j++)
+    {
+      const double index = f[j] * (n - 1);
+      const size_t lhs = (size_t) index;
+      const double delta = index - lhs;
+
+      q[j] = AT (lhs);
+
+      if (lhs < n - 1 && delta > 0)
+        q[j] = (1 - delta) * q[j] + delta * AT (lhs + 1);
+    }
+
+  return GSL_SUCCESS;
+}
+
+#undef SWAP
+#undef AT
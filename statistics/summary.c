@@ -0,0 +1,140 @@
+/* statistics/summary.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* Mean, variance, skewness, kurtosis and extrema of a dataset in a
+   single pass.
+
+   The data are processed in blocks of SUMMARY_BLOCK elements.  The mean
+   of each block and the sums of powers of the deviations from it are
+   found with two short loops over the block, which stays in cache and
+   which the compiler can vectorize, and the block is then combined
+   with the totals for the preceding blocks using the formulas of
+
+     T. F. Chan, G. H. Golub and R. J. LeVeque, "Algorithms for
+     computing the sample variance", Am. Stat. 37, 242 (1983)
+
+     P. Pebay, "Formulas for robust, one-pass parallel computation of
+     covariances and arbitrary-order statistical moments", Sandia
+     Report SAND2008-6212 (2008)
+
+   in long double precision.  The deviations are always taken from a
+   nearby mean, so the results are as accurate as those of the
+   separate two-pass functions. */
+
+#include <config.h>
+#include <math.h>
+#include <gsl/gsl_math.h>
+#include <gsl/gsl_errno.h>
+#include <gsl/gsl_statistics.h>
+
+#define SUMMARY_BLOCK 64
+
+/* combine the weight W, mean and central moment sums M2, M3, M4 of a
+   block b into the running totals s, both stored in that order */
+
+static void
+summary_merge (long double s[5], const long double b[5])
+{
+  const long double wa = s[0], wb = b[0];
+  const long double w = wa + wb;
+  const long double delta = b[1] - s[1];
+  const long double ab = wa * wb;
+  long double d_w, d2;
+
+  if (wb == 0)
+    return;
+
+  d_w = delta / w;
+  d2 = d_w * d_w;
+
+  s[4] += b[4] + delta * d_w * d2 * ab * (wa * wa - ab + wb * wb)
+    + 6 * d2 * (wa * wa * b[2] + wb * wb * s[2])
+    + 4 * d_w * (wa * b[3] - wb * s[3]);
+  s[3] += b[3] + delta * d2 * ab * (wa - wb)
+    + 3 * d_w * (wa * b[2] - wb * s[2]);
+  s[2] += b[2] + delta * d_w * ab;
+  s[1] += d_w * wb;
+  s[0] = w;
+}
+
+#define BASE_LONG_DOUBLE
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG_DOUBLE
+
+#define BASE_DOUBLE
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_DOUBLE
+
+#define BASE_FLOAT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_FLOAT
+
+#define BASE_ULONG
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_ULONG
+
+#define BASE_LONG
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_LONG
+
+#define BASE_UINT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_UINT
+
+#define BASE_INT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_INT
+
+#define BASE_USHORT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_USHORT
+
+#define BASE_SHORT
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_SHORT
+
+#define BASE_UCHAR
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_UCHAR
+
+#define BASE_CHAR
+#include "templates_on.h"
+#include "summary_source.c"
+#include "templates_off.h"
+#undef  BASE_CHAR
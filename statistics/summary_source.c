@@ -0,0 +1,243 @@
+/* statistics/summary_source.c
+ *
+ * Copyright (C) 2026 The GSL Team
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 3 of the License, or (at
+ * your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful, but
+ * WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ * General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ */
+
+/* the block sums use double precision, or long double for long double
+   data, so that the loops can be vectorized */
+#if defined(BASE_LONG_DOUBLE)
+#define REAL long double
+#else
+#define REAL double
+#endif
+
+int
+FUNCTION (gsl_stats, summary) (double * mean, double * variance,
+                               double * skew, double * kurtosis,
+                               BASE * min, BASE * max,
+                               const BASE data[], const size_t stride,
+                               const size_t n)
+{
+  long double s[5] = { 0, 0, 0, 0, 0 };
+  BASE xmin, xmax;
+  size_t i0;
+
+  if (n == 0)
+    {
+      GSL_ERROR ("dataset must not be empty", GSL_EINVAL);
+    }
+
+  xmin = data[0];
+  xmax = data[0];
+
+  for (i0 = 0; i0 < n; i0 += SUMMARY_BLOCK)
+    {
+      const size_t nb = GSL_MIN (SUMMARY_BLOCK, n - i0);
+      const BASE *x = data + i0 * stride;
+      REAL sum = 0, mb, m2 = 0, m3 = 0, m4 = 0;
+      long double b[5];
+      size_t i;
+
+      for (i = 0; i < nb; i++)
+        {
+          const BASE xi = x[i * stride];
+
+          sum += xi;
+
+          if (xi < xmin)
+            xmin = xi;
+
+          if (xi > xmax)
+            xmax = xi;
+        }
+
+      mb = sum / nb;
+
+      for (i = 0; i < nb; i++)
+        {
+          const REAL d = x[i * stride] - mb;
+          const REAL d2 = d * d;
+
+          m2 += d2;
+          m3 += d2 * d;
+          m4 += d2 * d2;
+        }
+
+      b[0] = nb;
+      b[1] = mb;
+      b[2] = m2;
+      b[3] = m3;
+      b[4] = m4;
+
+      summary_merge (s, b);
+    }
+
+#ifdef FP
+  /* a NaN anywhere makes the sums NaN, and is returned as the extrema
+     as by gsl_stats_minmax */
+  if (isnan (s[1]))
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          if (isnan (data[i * stride]))
+            {
+              xmin = data[i * stride];
+              xmax = data[i * stride];
+              break;
+            }
+        }
+    }
+#endif
+
+  {
+    const long double var = s[2] / (n - 1);
+    const long double sd = sqrt (var);
+
+    *mean = s[1];
+    *variance = var;
+    *skew = (s[3] / n) / (sd * sd * sd);
+    *kurtosis = (s[4] / n) / (var * var) - 3.0;
+    *min = xmin;
+    *max = xmax;
+  }
+
+  return GSL_SUCCESS;
+}
+
+#ifdef FP
+int
+FUNCTION (gsl_stats, wsummary) (double * wmean, double * wvariance,
+                                double * wskew, double * wkurtosis,
+                                BASE * min, BASE * max,
+                                const BASE w[], const size_t wstride,
+                                const BASE data[], const size_t stride,
+                                const size_t n)
+{
+  long double s[5] = { 0, 0, 0, 0, 0 };
+  long double W2 = 0;
+  BASE xmin = 0, xmax = 0;
+  int found = 0;
+  size_t i0;
+
+  for (i0 = 0; i0 < n; i0 += SUMMARY_BLOCK)
+    {
+      const size_t nb = GSL_MIN (SUMMARY_BLOCK, n - i0);
+      const BASE *x = data + i0 * stride;
+      const BASE *wx = w + i0 * wstride;
+      REAL wsum = 0, w2sum = 0, sum = 0, mb, m2 = 0, m3 = 0, m4 = 0;
+      long double b[5];
+      size_t i;
+
+      for (i = 0; i < nb; i++)
+        {
+          const BASE wi = wx[i * wstride];
+          const BASE xi = x[i * stride];
+
+          /* elements with zero or negative weight are ignored */
+          if (wi > 0)
+            {
+              wsum += wi;
+              w2sum += wi * wi;
+              sum += wi * xi;
+
+              if (!found)
+                {
+                  xmin = xi;
+                  xmax = xi;
+                  found = 1;
+                }
+
+              if (xi < xmin)
+                xmin = xi;
+
+              if (xi > xmax)
+                xmax = xi;
+            }
+        }
+
+      if (wsum == 0)
+        continue;
+
+      mb = sum / wsum;
+
+      for (i = 0; i < nb; i++)
+        {
+          const BASE wi = wx[i * wstride];
+
+          if (wi > 0)
+            {
+              const REAL d = x[i * stride] - mb;
+              const REAL wd2 = wi * d * d;
+
+              m2 += wd2;
+              m3 += wd2 * d;
+              m4 += wd2 * d * d;
+            }
+        }
+
+      b[0] = wsum;
+      b[1] = mb;
+      b[2] = m2;
+      b[3] = m3;
+      b[4] = m4;
+
+      summary_merge (s, b);
+      W2 += w2sum;
+    }
+
+  if (!found)
+    {
+      GSL_ERROR ("dataset must contain an element of positive weight",
+                 GSL_EINVAL);
+    }
+
+  if (isnan (s[1]))
+    {
+      size_t i;
+
+      for (i = 0; i < n; i++)
+        {
+          if (w[i * wstride] > 0 && isnan (data[i * stride]))
+            {
+              xmin = data[i * stride];
+              xmax = data[i * stride];
+              break;
+            }
+        }
+    }
+
+  {
+    /* the factor W^2/(W^2 - sum w^2) of gsl_stats_wvariance */
+    const long double W = s[0];
+    const long double var = (s[2] / W) * (W * W) / (W * W - W2);
+    const long double sd = sqrt (var);
+
+    *wmean = s[1];
+    *wvariance = var;
+    *wskew = (s[3] / W) / (sd * sd * sd);
+    *wkurtosis = (s[4] / W) / (var * var) - 3.0;
+    *min = xmin;
+    *max = xmax;
+  }
+
+  return GSL_SUCCESS;
+}
+#endif
+
+#undef REAL
@@ -30,6 +30,8 @@
 #include <gsl/gsl_ieee_utils.h>
 
 int test_nist (void);
+void test_select (const size_t n);
+void test_summary (const size_t n);
 
 /* Test program for mean.c.  JimDavies 7.96 */
 
@@ -100,6 +102,132 @@ int test_nist (void);
 #undef  BASE_CHAR
 
 
+/* select and quantiles on larger arrays with various patterns,
+   compared with the sorted data */
+
+void
+test_select (const size_t n)
+{
+  const char *desc[] = { "random", "sorted", "reversed", "equal", "few values" };
+  const double f[] = { 0.0, 0.01, 0.05, 0.25, 0.5, 0.75, 0.95, 0.99, 1.0 };
+  const size_t nf = sizeof (f) / sizeof (f[0]);
+  double *x = (double *) malloc (n * sizeof (double));
+  double *sorted = (double *) malloc (n * sizeof (double));
+  double *work = (double *) malloc (n * sizeof (double));
+  double q[9];
+  unsigned long int seed = 1;
+  size_t p, i, j;
+
+  for (p = 0; p < 5; p++)
+    {
+      int status = 0;
+
+      for (i = 0; i < n; i++)
+        {
+          seed = (1103515245 * seed + 12345) & 0x7fffffffUL;
+
+          switch (p)
+            {
+            case 0: x[i] = seed / 2147483648.0; break;
+            case 1: x[i] = i; break;
+            case 2: x[i] = (double) (n - i); break;
+            case 3: x[i] = 1.0; break;
+            case 4: x[i] = seed % 5; break;
+            }
+        }
+
+      memcpy (sorted, x, n * sizeof (double));
+      gsl_sort (sorted, 1, n);
+
+      for (j = 0; j < 20; j++)
+        {
+          const size_t k = (j * (n - 1)) / 19;
+          memcpy (work, x, n * sizeof (double));
+          status |= (gsl_stats_select (work, 1, n, k) != sorted[k]);
+
+          /* the data must be partitioned around k */
+          for (i = 0; i < n; i++)
+            {
+              if ((i < k && work[i] > work[k]) || (i > k && work[i] < work[k]))
+                status = 1;
+            }
+        }
+
+      gsl_test (status, "gsl_stats_select, n = %u, %s", n, desc[p]);
+
+      memcpy (work, x, n * sizeof (double));
+      gsl_test_rel (gsl_stats_median (work, 1, n),
+                    gsl_stats_median_from_sorted_data (sorted, 1, n), 1e-15,
+                    "gsl_stats_median, n = %u, %s", n, desc[p]);
+
+      memcpy (work, x, n * sizeof (double));
+      gsl_stats_quantiles (q, f, nf, work, 1, n);
+
+      for (j = 0; j < nf; j++)
+        {
+          gsl_test_rel (q[j], gsl_stats_quantile_from_sorted_data (sorted, 1, n, f[j]),
+                        1e-15, "gsl_stats_quantiles, n = %u, %s, f = %g", n, desc[p], f[j]);
+        }
+    }
+
+  free (x);
+  free (sorted);
+  free (work);
+}
+
+/* single pass summary of data spanning several blocks, with a large
+   offset, compared with the separate functions.  The skewness is near
+   zero and is compared in absolute terms. */
+
+void
+test_summary (const size_t n)
+{
+  double *x = (double *) malloc (n * sizeof (double));
+  double *w = (double *) malloc (n * sizeof (double));
+  double mean, var, skew, kurt, min, max, emin, emax;
+  unsigned long int seed = 1;
+  size_t i;
+
+  for (i = 0; i < n; i++)
+    {
+      seed = (1103515245 * seed + 12345) & 0x7fffffffUL;
+      x[i] = 1e6 + seed / 2147483648.0 + (i % 3);
+      w[i] = (i % 7 == 0) ? 0.0 : (double) (i % 5);
+    }
+
+  gsl_stats_summary (&mean, &var, &skew, &kurt, &min, &max, x, 1, n);
+  gsl_stats_minmax (&emin, &emax, x, 1, n);
+
+  gsl_test_rel (mean, gsl_stats_mean (x, 1, n), 1e-15,
+                "gsl_stats_summary mean, n = %u", n);
+  gsl_test_rel (var, gsl_stats_variance (x, 1, n), 1e-10,
+                "gsl_stats_summary variance, n = %u", n);
+  gsl_test_abs (skew, gsl_stats_skew (x, 1, n), 1e-8,
+                "gsl_stats_summary skew, n = %u", n);
+  gsl_test_rel (kurt, gsl_stats_kurtosis (x, 1, n), 1e-8,
+                "gsl_stats_summary kurtosis, n = %u", n);
+  gsl_test (min != emin || max != emax, "gsl_stats_summary minmax, n = %u", n);
+
+  gsl_stats_wsummary (&mean, &var, &skew, &kurt, &min, &max, w, 1, x, 1, n);
+
+  gsl_test_rel (mean, gsl_stats_wmean (w, 1, x, 1, n), 1e-15,
+                "gsl_stats_wsummary wmean, n = %u", n);
+  gsl_test_rel (var, gsl_stats_wvariance (w, 1, x, 1, n), 1e-10,
+                "gsl_stats_wsummary wvariance, n = %u", n);
+  gsl_test_abs (skew, gsl_stats_wskew (w, 1, x, 1, n), 1e-8,
+                "gsl_stats_wsummary wskew, n = %u", n);
+  gsl_test_rel (kurt, gsl_stats_wkurtosis (w, 1, x, 1, n), 1e-8,
+                "gsl_stats_wsummary wkurtosis, n = %u", n);
+
+  x[n / 2] = GSL_NAN;
+  gsl_stats_summary (&mean, &var, &skew, &kurt, &min, &max, x, 1, n);
+  gsl_test (!gsl_isnan (mean) || !gsl_isnan (min) || !gsl_isnan (max),
+            "gsl_stats_summary with NaN, n = %u", n);
+
+  free (x);
+  free (w);
+}
+
 int
 main (void)
 {
@@ -125,6 +253,12 @@ main (void)
       test_char_func (s1,s2);
     }
 
+  test_select (1000);
+  test_select (100001);
+
+  test_summary (1000);
+  test_summary (1000001);
+
   test_nist();
 
   exit (gsl_test_summary ());
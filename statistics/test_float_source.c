@@ -187,6 +187,32 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (wkurt, expected, rel, NAME(gsl_stats) "_wkurtosis");
   }
 
+  {
+    double mean, var, skew, kurt;
+    BASE min, max;
+    int status = FUNCTION(gsl_stats,summary) (&mean, &var, &skew, &kurt, &min, &max, groupa, stridea, na);
+    gsl_test (status, NAME(gsl_stats) "_summary returns success");
+    gsl_test_rel (mean, 0.0728, rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (sqrt (var), 0.0350134479659107, rel, NAME(gsl_stats) "_summary variance");
+    gsl_test_rel (skew, 0.0954642051479004, rel, NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (kurt, -1.38583851548909, rel, NAME(gsl_stats) "_summary kurtosis");
+    gsl_test (min != (BASE)0.0242, NAME(gsl_stats) "_summary min");
+    gsl_test (max != (BASE)0.1331, NAME(gsl_stats) "_summary max");
+  }
+
+  {
+    double wmean, wvar, wskew, wkurt;
+    BASE min, max;
+    int status = FUNCTION(gsl_stats,wsummary) (&wmean, &wvar, &wskew, &wkurt, &min, &max, w, strideb, groupa, stridea, na);
+    gsl_test (status, NAME(gsl_stats) "_wsummary returns success");
+    gsl_test_rel (wmean, 0.0678111523670601, rel, NAME(gsl_stats) "_wsummary wmean");
+    gsl_test_rel (wvar, 0.000769562962860317, rel, NAME(gsl_stats) "_wsummary wvariance");
+    gsl_test_rel (wskew, -0.373631000307076, rel, NAME(gsl_stats) "_wsummary wskew");
+    gsl_test_rel (wkurt, -1.48114233353963, rel, NAME(gsl_stats) "_wsummary wkurtosis");
+    gsl_test (min != (BASE)0.0242, NAME(gsl_stats) "_wsummary min");
+    gsl_test (max != (BASE)0.0999, NAME(gsl_stats) "_wsummary max");
+  }
+
   {
     double c = FUNCTION(gsl_stats,covariance) (groupa, stridea, groupb, strideb, nb);
     double expected = -0.000139021538461539;
@@ -332,6 +358,62 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
 
   }
 
+  /* selection from the sorted data in a scrambled order */
+
+  {
+    const double f[] = { 0.0, 0.1, 0.25, 0.5, 0.5, 0.9, 0.99, 1.0 };
+    const size_t nf = sizeof (f) / sizeof (f[0]);
+    BASE * work = (BASE *) malloc (stridea * na * sizeof (BASE));
+    double q[8];
+    size_t m, k, j;
+
+    for (m = na - 1; m <= na; m++)
+      {
+        int status = 0;
+
+        for (k = 0; k < m; k++)
+          {
+            for (i = 0; i < m; i++)
+              work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+            status |= (FUNCTION(gsl_stats,select) (work, stridea, m, k) != sorted[k * stridea]);
+          }
+
+        gsl_test (status, NAME(gsl_stats) "_select (n = %u)", m);
+
+        for (i = 0; i < m; i++)
+          work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+        gsl_test_rel (FUNCTION(gsl_stats,median) (work, stridea, m),
+                      FUNCTION(gsl_stats,median_from_sorted_data) (sorted, stridea, m),
+                      rel, NAME(gsl_stats) "_median (n = %u)", m);
+
+        for (j = 0; j < nf; j++)
+          {
+            for (i = 0; i < m; i++)
+              work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+            gsl_test_rel (FUNCTION(gsl_stats,quantile) (work, stridea, m, f[j]),
+                          FUNCTION(gsl_stats,quantile_from_sorted_data) (sorted, stridea, m, f[j]),
+                          rel, NAME(gsl_stats) "_quantile (n = %u, f = %g)", m, f[j]);
+          }
+
+        for (i = 0; i < m; i++)
+          work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+        status = FUNCTION(gsl_stats,quantiles) (q, f, nf, work, stridea, m);
+
+        for (j = 0; j < nf; j++)
+          {
+            gsl_test_rel (q[j],
+                          FUNCTION(gsl_stats,quantile_from_sorted_data) (sorted, stridea, m, f[j]),
+                          rel, NAME(gsl_stats) "_quantiles (n = %u, f = %g)", m, f[j]);
+          }
+      }
+
+    free (work);
+  }
+
   /* Test for IEEE handling - set third element to NaN */
 
   groupa [3*stridea] = GSL_NAN;
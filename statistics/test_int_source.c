@@ -115,6 +115,19 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
     gsl_test_rel (kurt, expected, rel, NAME(gsl_stats) "_kurtosis");
   }
 
+  {
+    double mean, var, skew, kurt;
+    BASE min, max;
+    int status = FUNCTION(gsl_stats,summary) (&mean, &var, &skew, &kurt, &min, &max, igroupa, stridea, ina);
+    gsl_test (status, NAME(gsl_stats) "_summary returns success");
+    gsl_test_rel (mean, 17.0, rel, NAME(gsl_stats) "_summary mean");
+    gsl_test_rel (var, 14.4210526315789, rel, NAME(gsl_stats) "_summary variance");
+    gsl_test_rel (skew, -0.909355923168064, rel, NAME(gsl_stats) "_summary skew");
+    gsl_test_rel (kurt, -0.233692524908094, rel, NAME(gsl_stats) "_summary kurtosis");
+    gsl_test (min != 8, NAME(gsl_stats) "_summary min");
+    gsl_test (max != 22, NAME(gsl_stats) "_summary max");
+  }
+
   {
     double c = FUNCTION(gsl_stats,covariance) (igroupa, stridea, igroupb, strideb, inb);
     double expected = 14.5263157894737;
@@ -259,6 +272,62 @@ FUNCTION (test, func) (const size_t stridea, const size_t strideb)
                   NAME(gsl_stats) "_quantile_from_sorted_data (50, odd)");
   }
 
+  /* selection from the sorted data in a scrambled order */
+
+  {
+    const double f[] = { 0.0, 0.1, 0.25, 0.5, 0.5, 0.9, 0.99, 1.0 };
+    const size_t nf = sizeof (f) / sizeof (f[0]);
+    BASE * work = (BASE *) malloc (stridea * ina * sizeof (BASE));
+    double q[8];
+    size_t m, k, j;
+
+    for (m = ina - 1; m <= ina; m++)
+      {
+        int status = 0;
+
+        for (k = 0; k < m; k++)
+          {
+            for (i = 0; i < m; i++)
+              work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+            status |= (FUNCTION(gsl_stats,select) (work, stridea, m, k) != sorted[k * stridea]);
+          }
+
+        gsl_test (status, NAME(gsl_stats) "_select (n = %u)", m);
+
+        for (i = 0; i < m; i++)
+          work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+        gsl_test_rel (FUNCTION(gsl_stats,median) (work, stridea, m),
+                      FUNCTION(gsl_stats,median_from_sorted_data) (sorted, stridea, m),
+                      rel, NAME(gsl_stats) "_median (n = %u)", m);
+
+        for (j = 0; j < nf; j++)
+          {
+            for (i = 0; i < m; i++)
+              work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+            gsl_test_rel (FUNCTION(gsl_stats,quantile) (work, stridea, m, f[j]),
+                          FUNCTION(gsl_stats,quantile_from_sorted_data) (sorted, stridea, m, f[j]),
+                          rel, NAME(gsl_stats) "_quantile (n = %u, f = %g)", m, f[j]);
+          }
+
+        for (i = 0; i < m; i++)
+          work[i * stridea] = sorted[((3 * i + 1) % m) * stridea];
+
+        status = FUNCTION(gsl_stats,quantiles) (q, f, nf, work, stridea, m);
+
+        for (j = 0; j < nf; j++)
+          {
+            gsl_test_rel (q[j],
+                          FUNCTION(gsl_stats,quantile_from_sorted_data) (sorted, stridea, m, f[j]),
+                          rel, NAME(gsl_stats) "_quantiles (n = %u, f = %g)", m, f[j]);
+          }
+      }
+
+    free (work);
+  }
+
   free (sorted);
   free (igroupa);
   free (igroupb);